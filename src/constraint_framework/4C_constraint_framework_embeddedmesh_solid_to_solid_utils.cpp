@@ -167,7 +167,7 @@ void CONSTRAINTS::EMBEDDEDMESH::get_coupling_pairs_and_background_elements(
   cutwizard->check_if_mesh_intersection_and_cut();
 
   // Get the mesh that represents the background mesh
-  Cut::Mesh background_mesh = (cutwizard->get_intersection())->normal_mesh();
+  Cut::Mesh& background_mesh = (cutwizard->get_intersection())->normal_mesh();
 
   // Get the elements inside the background mesh
   const std::map<int, Teuchos::RCP<Cut::Element>> background_elements =
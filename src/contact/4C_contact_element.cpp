@@ -209,7 +209,7 @@ void CONTACT::Element::deriv_normal_at_xi(double* xi, int& i,
     int ndof = mycnode->num_dof();
 
     // derivative weighting matrix for current node
-    static Core::LinAlg::Matrix<3, 3> F;
+    static thread_local Core::LinAlg::Matrix<3, 3> F;
     F(0, 0) = 0.0;
     F(1, 1) = 0.0;
     F(2, 2) = 0.0;
@@ -221,7 +221,7 @@ void CONTACT::Element::deriv_normal_at_xi(double* xi, int& i,
     F(2, 1) = gxi[0] * deriv(n, 1) - geta[0] * deriv(n, 0);
 
     // total weighting matrix
-    static Core::LinAlg::Matrix<3, 3> WF;
+    static thread_local Core::LinAlg::Matrix<3, 3> WF;
     WF.multiply_nn(W, F);
 
     // create directional derivatives
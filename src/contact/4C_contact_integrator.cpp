@@ -1868,8 +1868,8 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane(Mortar::Element& sel
     // evaluate linearizations *******************************************
 
     // evaluate global GP coordinate derivative
-    static Core::LinAlg::Matrix<3, 1> svalcell;
-    static Core::LinAlg::Matrix<3, 2> sderivcell;
+    static thread_local Core::LinAlg::Matrix<3, 1> svalcell;
+    static thread_local Core::LinAlg::Matrix<3, 2> sderivcell;
     cell->evaluate_shape(eta, svalcell, sderivcell);
 
     Core::Gen::Pairedvector<int, Core::LinAlg::Matrix<3, 1>> lingp((nrow + ncol) * ndof);
@@ -2116,8 +2116,8 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_stl(Mortar::Element&
     // evaluate linearizations *******************************************
 
     // evaluate global GP coordinate derivative
-    static Core::LinAlg::Matrix<3, 1> svalcell;
-    static Core::LinAlg::Matrix<3, 2> sderivcell;
+    static thread_local Core::LinAlg::Matrix<3, 1> svalcell;
+    static thread_local Core::LinAlg::Matrix<3, 2> sderivcell;
     cell->evaluate_shape(eta, svalcell, sderivcell);
 
     Core::Gen::Pairedvector<int, Core::LinAlg::Matrix<3, 1>> lingp(100 * (nrow + ncolP) * ndof);
@@ -2377,7 +2377,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_stl(Mortar::Element&
       Mortar::Node* mymrtrnode = dynamic_cast<Mortar::Node*>(mynodes[iter]);
       if (!mymrtrnode) FOUR_C_THROW("Null pointer!");
 
-      static double fac = 0.0;
+      double fac = 0.0;
 
       // get the corresponding map as a reference
       std::map<int, double>& dgmap =
@@ -2507,7 +2507,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_stl(Mortar::Element&
         {
           // global master node ID
           int mgid = mele.nodes()[k]->id();
-          static double fac = 0.0;
+          double fac = 0.0;
 
           // get the correct map as a reference
           std::map<int, double>& dmmap_jk =
@@ -2570,7 +2570,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_stl(Mortar::Element&
         {
           // global master node ID
           int mgid = sele.nodes()[k]->id();
-          static double fac = 0.0;
+          double fac = 0.0;
 
           // get the correct map as a reference
           std::map<int, double>& ddmap_jk =
@@ -2625,7 +2625,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_stl(Mortar::Element&
         {
           // global master node ID
           int mgid = lele.nodes()[k]->id();
-          static double fac = 0.0;
+          double fac = 0.0;
 
           // get the correct map as a reference
           std::map<int, double>& dmmap_jk =
@@ -2888,8 +2888,8 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_lts(Mortar::Element&
     // evaluate linearizations *******************************************
 
     // evaluate global GP coordinate derivative
-    static Core::LinAlg::Matrix<3, 1> svalcell;
-    static Core::LinAlg::Matrix<3, 2> sderivcell;
+    static thread_local Core::LinAlg::Matrix<3, 1> svalcell;
+    static thread_local Core::LinAlg::Matrix<3, 2> sderivcell;
     cell->evaluate_shape(eta, svalcell, sderivcell);
 
     Core::Gen::Pairedvector<int, Core::LinAlg::Matrix<3, 1>> lingp((nrowS + ncol) * ndof + linsize);
@@ -3139,7 +3139,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_lts(Mortar::Element&
 
       if (mymrtrnode->is_on_corner()) continue;
 
-      static double fac = 0.0;
+      double fac = 0.0;
 
       // get the corresponding map as a reference
       std::map<int, double>& dgmap =
@@ -3358,7 +3358,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_lts(Mortar::Element&
           {
             // global master node ID
             int mgid = mele.nodes()[k]->id();
-            static double fac = 0.0;
+            double fac = 0.0;
 
             // get the correct map as a reference
             std::map<int, double>& dmmap_jk =
@@ -3410,7 +3410,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_lts(Mortar::Element&
 
             // global master node ID
             int sgid = mymrtrnode2->id();
-            static double fac = 0.0;
+            double fac = 0.0;
 
             // node k is boundary node
             if (mymrtrnode2->is_on_corner())
@@ -3524,7 +3524,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_lts(Mortar::Element&
           {
             // global master node ID
             int mgid = mele.nodes()[k]->id();
-            static double fac = 0.0;
+            double fac = 0.0;
 
             // get the correct map as a reference
             std::map<int, double>& dmmap_jk =
@@ -3583,7 +3583,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_lts(Mortar::Element&
         {
           // global master node ID
           int mgid = mele.nodes()[k]->id();
-          static double fac = 0.0;
+          double fac = 0.0;
 
           // get the correct map as a reference
           std::map<int, double>& dmmap_jk =
@@ -3625,7 +3625,7 @@ void CONTACT::Integrator::integrate_deriv_cell_3d_aux_plane_lts(Mortar::Element&
         {
           // global master node ID
           int mgid = mynodes[k]->id();
-          static double fac = 0.0;
+          double fac = 0.0;
 
           if (dynamic_cast<Node*>(mynodes[k])->is_on_corner())
           {
@@ -7733,7 +7733,7 @@ void CONTACT::Integrator::gp_g_lin(int& iter, Mortar::Element& sele, Mortar::Ele
 
   if (mymrtrnode->is_on_boundor_ce()) return;
 
-  static double fac = 0.0;
+  double fac = 0.0;
 
   // get the corresponding map as a reference
   std::map<int, double>& dgmap = dynamic_cast<CONTACT::Node*>(mymrtrnode)->data().get_deriv_g();
@@ -7860,7 +7860,7 @@ void CONTACT::Integrator::gp_3d_dm_lin_bound(Mortar::Element& sele, Mortar::Elem
       {
         // global master node ID
         int mgid = mele.nodes()[k]->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // get the correct map as a reference
         std::map<int, double>& dmmap_jk =
@@ -7900,7 +7900,7 @@ void CONTACT::Integrator::gp_3d_dm_lin_bound(Mortar::Element& sele, Mortar::Elem
 
         // global master node ID
         int sgid = mymrtrnode2->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // node k is boundary node
         if (mymrtrnode2->is_on_boundor_ce())
@@ -8008,7 +8008,7 @@ void CONTACT::Integrator::gp_3d_dm_lin_bound(Mortar::Element& sele, Mortar::Elem
       {
         // global master node ID
         int mgid = mele.nodes()[k]->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // get the correct map as a reference
         std::map<int, double>& dmmap_jk =
@@ -8059,7 +8059,7 @@ void CONTACT::Integrator::gp_3d_dm_lin_bound(Mortar::Element& sele, Mortar::Elem
 
         // global master node ID
         int sgid = mymrtrnode2->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // node k is boundary node
         if (mymrtrnode2->is_on_boundor_ce())
@@ -8210,7 +8210,7 @@ void inline CONTACT::Integrator::gp_2d_dm_lin_bound(Mortar::Element& sele, Morta
       {
         // global master node ID
         int mgid = mele.nodes()[k]->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // get the correct map as a reference
         std::map<int, double>& dmmap_jk =
@@ -8250,7 +8250,7 @@ void inline CONTACT::Integrator::gp_2d_dm_lin_bound(Mortar::Element& sele, Morta
 
         // global master node ID
         int sgid = mymrtrnode2->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // node k is boundary node
         if (mymrtrnode2->is_on_boundor_ce())
@@ -8341,7 +8341,7 @@ void inline CONTACT::Integrator::gp_2d_dm_lin_bound(Mortar::Element& sele, Morta
       {
         // global master node ID
         int mgid = mele.nodes()[k]->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // get the correct map as a reference
         std::map<int, double>& dmmap_jk =
@@ -8392,7 +8392,7 @@ void inline CONTACT::Integrator::gp_2d_dm_lin_bound(Mortar::Element& sele, Morta
 
         // global master node ID
         int sgid = mymrtrnode2->id();
-        static double fac = 0.0;
+        double fac = 0.0;
 
         // node k is boundary node
         if (mymrtrnode2->is_on_boundor_ce())
@@ -9047,8 +9047,8 @@ void inline CONTACT::Integrator::gp_3d_dm_quad_lin(bool& duallin, Mortar::Elemen
   if (shape_fcn() == Inpar::Mortar::shape_standard &&
       lag_mult_quad() == Inpar::Mortar::lagmult_quad)
   {
-    static double fac1 = 0.;
-    static double fac2 = 0.;
+    double fac1 = 0.0;
+    double fac2 = 0.0;
     // (1) Lin(Phi) - dual shape functions
     // this vanishes here since there are no deformation-dependent dual functions
 
@@ -9139,7 +9139,7 @@ void inline CONTACT::Integrator::gp_3d_dm_quad_lin(bool& duallin, Mortar::Elemen
         {
           // global master node ID
           int mgid = mele.nodes()[k]->id();
-          static double fac = 0.0;
+          double fac = 0.0;
 
           // get the correct map as a reference
           std::map<int, double>& dmmap_jk =
@@ -9190,7 +9190,7 @@ void inline CONTACT::Integrator::gp_3d_dm_quad_lin(bool& duallin, Mortar::Elemen
 
           // global master node ID
           int sgid = mymrtrnode2->id();
-          static double fac = 0.0;
+          double fac = 0.0;
 
           // node k is boundary node
           if (mymrtrnode2->is_on_bound())
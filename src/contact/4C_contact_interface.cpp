@@ -25,6 +25,7 @@
 #include "4C_linalg_utils_sparse_algebra_create.hpp"
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
 #include "4C_mortar_binarytree.hpp"
+#include "4C_mortar_bounding_volume_search.hpp"
 #include "4C_mortar_defines.hpp"
 #include "4C_mortar_dofset.hpp"
 #include "4C_mortar_projector.hpp"
@@ -727,12 +728,7 @@ void CONTACT::Interface::redistribute()
   //**********************************************************************
   // perform contact search (still with non-optimal distribution)
   initialize();
-  if (search_alg() == Inpar::Mortar::search_bfele)
-    evaluate_search_brute_force(search_param());
-  else if (search_alg() == Inpar::Mortar::search_binarytree)
-    evaluate_search_binarytree();
-  else
-    FOUR_C_THROW("Invalid search algorithm");
+  evaluate_search();
 
   // split slave element row map and build redundant vector of
   // all close / non-close slave node ids on all procs
@@ -1139,12 +1135,16 @@ void CONTACT::Interface::create_search_tree()
   }
 #endif
 
-  // binary tree search
-  if (search_alg() == Inpar::Mortar::search_binarytree)
+  // binary tree or bounding volume hierarchy search
+  if (search_alg() == Inpar::Mortar::search_binarytree ||
+      search_alg() == Inpar::Mortar::search_bvh)
   {
     //*****SELF CONTACT*****
     if (self_contact())
     {
+      if (search_alg() != Inpar::Mortar::search_binarytree)
+        FOUR_C_THROW("Binarytree search needed for self contact");
+
       // set state in interface to intialize all kinds of quantities
       Core::LinAlg::Vector<double> zero(*idiscret_->dof_row_map());
       set_state(Mortar::state_new_displacement, zero);
@@ -1195,6 +1195,7 @@ void CONTACT::Interface::create_search_tree()
         }
       }
 
+      if (search_alg() == Inpar::Mortar::search_binarytree)
       {
         // get update type of binary tree
         auto updatetype = Teuchos::getIntegralValue<Inpar::Mortar::BinaryTreeUpdateType>(
@@ -1206,6 +1207,12 @@ void CONTACT::Interface::create_search_tree()
         // initialize the binary tree
         binarytree_->init();
       }
+      else
+      {
+        // create bounding volume search object for contact search
+        boundingvolumesearch_ = Teuchos::make_rcp<Mortar::BoundingVolumeSearch>(discret(),
+            selecolmap_, melefullmap, n_dim(), search_param(), search_use_aux_pos());
+      }
     }
   }
 
@@ -1529,12 +1536,7 @@ void CONTACT::Interface::pre_evaluate(const int& step, const int& iter)
   //**********************************************************************
   // search algorithm
   //**********************************************************************
-  if (search_alg() == Inpar::Mortar::search_bfele)
-    evaluate_search_brute_force(search_param());
-  else if (search_alg() == Inpar::Mortar::search_binarytree)
-    evaluate_search_binarytree();
-  else
-    FOUR_C_THROW("Invalid search algorithm");
+  evaluate_search();
 
     // TODO: maybe we can remove this debug functionality
 #ifdef MORTARGMSHCELLS
@@ -6116,12 +6118,15 @@ void CONTACT::Interface::evaluate_nts()
  |  Integrate matrix M and gap g on slave/master overlaps     popp 11/08|
  *----------------------------------------------------------------------*/
 bool CONTACT::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Mortar::Element*> mele,
-    const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr)
+    const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr, Teuchos::ParameterList& params)
 {
   // do stuff before the actual coupling is going to be evaluated
   pre_mortar_coupling(sele, mele, mparams_ptr);
 
   // increase counter of slave/master pairs
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp atomic
+#endif
   smpairs_ += (int)mele.size();
 
   // check if quadratic interpolation is involved
@@ -6151,12 +6156,18 @@ bool CONTACT::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Mort
     // interpolation need any special treatment in the 2d case
 
     // create Coupling2dManager
-    CONTACT::Coupling2dManager coup(discret(), n_dim(), quadratic, interface_params(), sele, mele);
+    CONTACT::Coupling2dManager coup(discret(), n_dim(), quadratic, params, sele, mele);
     // evaluate
     coup.evaluate_coupling(mparams_ptr);
 
     // increase counter of slave/master integration pairs and intcells
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp atomic
+#endif
     smintpairs_ += (int)mele.size();
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp atomic
+#endif
     intcells_ += (int)mele.size();
   }
   // ************************************************************** 3D ***
@@ -6166,13 +6177,18 @@ bool CONTACT::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Mort
     if (!quadratic)
     {
       // create Coupling3dManager
-      CONTACT::Coupling3dManager coup(
-          discret(), n_dim(), quadratic, interface_params(), sele, mele);
+      CONTACT::Coupling3dManager coup(discret(), n_dim(), quadratic, params, sele, mele);
       // evaluate
       coup.evaluate_coupling(mparams_ptr);
 
       // increase counter of slave/master integration pairs and intcells
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp atomic
+#endif
       smintpairs_ += (int)mele.size();
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp atomic
+#endif
       intcells_ += coup.integration_cells();
     }
 
@@ -6180,8 +6196,7 @@ bool CONTACT::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Mort
     else
     {
       // create Coupling3dQuadManager
-      CONTACT::Coupling3dQuadManager coup(
-          discret(), n_dim(), quadratic, interface_params(), sele, mele);
+      CONTACT::Coupling3dQuadManager coup(discret(), n_dim(), quadratic, params, sele, mele);
       // evaluate
       coup.evaluate_coupling(mparams_ptr);
     }  // quadratic
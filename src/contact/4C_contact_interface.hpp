@@ -842,7 +842,9 @@ namespace CONTACT
 
     */
     bool mortar_coupling(Mortar::Element* sele, std::vector<Mortar::Element*> mele,
-        const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr) final;
+        const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr,
+        Teuchos::ParameterList& params) final;
+    using Mortar::Interface::mortar_coupling;
 
     /*!
     \brief evaluate coupling terms for nts coupling + lin
@@ -1471,6 +1473,16 @@ namespace CONTACT
     void evaluate_sts(const Epetra_Map& selecolmap,
         const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr) final;
 
+    /*!
+    \brief Return whether mortar_coupling() may be called concurrently
+
+    Non-smooth contact and the two half pass algorithm also write to master nodes.
+    */
+    bool is_mortar_coupling_thread_safe() const override
+    {
+      return not nonSmoothContact_ and not two_half_pass();
+    }
+
     /*!
     \brief export master nodal normals for cpp calculation
 
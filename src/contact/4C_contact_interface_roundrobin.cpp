@@ -391,12 +391,7 @@ void CONTACT::Interface::round_robin_change_ownership()
  *----------------------------------------------------------------------*/
 void CONTACT::Interface::round_robin_detect_ghosting()
 {
-  if (search_alg() == Inpar::Mortar::search_bfele)
-    evaluate_search_brute_force(search_param());
-  else if (search_alg() == Inpar::Mortar::search_binarytree)
-    evaluate_search_binarytree();
-  else
-    FOUR_C_THROW("Invalid search algorithm");
+  evaluate_search();
 
   // first ghosting for std. distribution
   round_robin_extend_ghosting(true);
@@ -426,7 +421,8 @@ void CONTACT::Interface::round_robin_detect_ghosting()
       round_robin_change_ownership();
 
       // build new search tree or do nothing for bruteforce
-      if (search_alg() == Inpar::Mortar::search_binarytree)
+      if (search_alg() == Inpar::Mortar::search_binarytree ||
+          search_alg() == Inpar::Mortar::search_bvh)
         create_search_tree();
       else if (search_alg() != Inpar::Mortar::search_bfele)
         FOUR_C_THROW("Invalid search algorithm");
@@ -434,12 +430,7 @@ void CONTACT::Interface::round_robin_detect_ghosting()
       // evaluate interfaces
       if (proc < (int)(get_comm().NumProc() - 1))
       {
-        if (search_alg() == Inpar::Mortar::search_bfele)
-          evaluate_search_brute_force(search_param());
-        else if (search_alg() == Inpar::Mortar::search_binarytree)
-          evaluate_search_binarytree();
-        else
-          FOUR_C_THROW("Invalid search algorithm");
+        evaluate_search();
 
         // other ghostings per iteration
         round_robin_extend_ghosting(false);
@@ -473,7 +464,8 @@ void CONTACT::Interface::round_robin_detect_ghosting()
   nextendedghosting_ = Teuchos::null;
 
   // build new search tree or do nothing for bruteforce
-  if (search_alg() == Inpar::Mortar::search_binarytree)
+  if (search_alg() == Inpar::Mortar::search_binarytree ||
+      search_alg() == Inpar::Mortar::search_bvh)
     create_search_tree();
   else if (search_alg() != Inpar::Mortar::search_bfele)
     FOUR_C_THROW("Invalid search algorithm");
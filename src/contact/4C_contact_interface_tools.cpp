@@ -1310,7 +1310,7 @@ void CONTACT::Interface::fd_check_normal_cpp_deriv()
     // compute element areas
     set_element_areas();
 
-    evaluate_search_binarytree();
+    evaluate_search();
 
     // now finally get the node we want to apply the FD scheme to
     int gid = snodefullmap->GID(i / dim);
@@ -1521,7 +1521,7 @@ void CONTACT::Interface::fd_check_normal_cpp_deriv()
     // compute element areas
     set_element_areas();
 
-    evaluate_search_binarytree();
+    evaluate_search();
 
     // now finally get the node we want to apply the FD scheme to
     int gid = mnodefullmap->GID(i / dim);
@@ -4393,7 +4393,7 @@ void CONTACT::Interface::fd_check_tang_lm_deriv()
     }
 
     // contact search algorithm
-    evaluate_search_binarytree();
+    evaluate_search();
 
     // loop over proc's slave elements of the interface for integration
     // use standard column map to include processor's ghosted elements
@@ -4595,7 +4595,7 @@ void CONTACT::Interface::fd_check_tang_lm_deriv()
     }
 
     // contact search algorithm
-    evaluate_search_binarytree();
+    evaluate_search();
 
     // loop over proc's slave elements of the interface for integration
     // use standard column map to include processor's ghosted elements
@@ -4768,7 +4768,7 @@ void CONTACT::Interface::fd_check_tang_lm_deriv()
   }
 
   // contact search algorithm
-  evaluate_search_binarytree();
+  evaluate_search();
 
   // loop over proc's slave elements of the interface for integration
   // use standard column map to include processor's ghosted elements
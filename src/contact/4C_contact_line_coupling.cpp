@@ -301,8 +301,8 @@ void CONTACT::LineToSurfaceCoupling3d::consist_dual_shape()
     Core::Gen::Pairedvector<int, Core::LinAlg::Matrix<3, 1>> lingp((nnodes + ncol) * ndof);
 
     // compute global GP coordinate derivative
-    static Core::LinAlg::Matrix<3, 1> svalcell;
-    static Core::LinAlg::Matrix<3, 2> sderivcell;
+    static thread_local Core::LinAlg::Matrix<3, 1> svalcell;
+    static thread_local Core::LinAlg::Matrix<3, 2> sderivcell;
     currcell->evaluate_shape(eta, svalcell, sderivcell);
 
     for (int v = 0; v < 2; ++v)
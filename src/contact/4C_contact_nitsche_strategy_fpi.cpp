@@ -28,7 +28,7 @@ void CONTACT::NitscheStrategyFpi::do_contact_search()
   for (auto& interface : interface_)
   {
     interface->initialize();
-    interface->evaluate_search_binarytree();
+    interface->evaluate_search();
     interface->evaluate_nodal_normals();
     interface->export_nodal_normals();
   }
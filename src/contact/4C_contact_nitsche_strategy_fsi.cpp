@@ -38,7 +38,7 @@ void CONTACT::NitscheStrategyFsi::do_contact_search()
   for (auto& interface : interface_)
   {
     interface->initialize();
-    interface->evaluate_search_binarytree();
+    interface->evaluate_search();
     interface->evaluate_nodal_normals();
     interface->export_nodal_normals();
   }
@@ -169,6 +169,16 @@ namespace Wear
     */
     virtual bool build_active_set_master();
 
+    /*!
+    \brief Return whether mortar_coupling() may be called concurrently
+
+    Wear on both sides is also integrated into the master nodes.
+    */
+    bool is_mortar_coupling_thread_safe() const override
+    {
+      return not wearboth_ and CONTACT::Interface::is_mortar_coupling_thread_safe();
+    }
+
     /*!
     \brief Check mortar wear T derivatives with finite differences
 
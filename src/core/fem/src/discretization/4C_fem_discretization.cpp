@@ -34,7 +34,9 @@ Core::FE::Discretization::Discretization(
       writer_(Teuchos::null),
       filled_(false),
       havedof_(false),
-      n_dim_(n_dim)
+      n_dim_(n_dim),
+      num_evaluate_threads_(1),
+      cache_element_matrices_(false)
 {
   dofsets_.emplace_back(Teuchos::make_rcp<Core::DOFSets::DofSet>());
 }
@@ -10,6 +10,7 @@
 
 #include "4C_config.hpp"
 
+#include "4C_fem_discretization_element_matrix_cache.hpp"
 #include "4C_fem_dofset_interface.hpp"
 #include "4C_fem_general_shape_function_type.hpp"
 #include "4C_linalg_vector.hpp"
@@ -1753,6 +1754,48 @@ namespace Core::FE
 
     virtual void evaluate(const std::function<void(Core::Elements::Element&)>& element_action);
 
+    /*!
+    \brief Set the number of threads used for the element loop in evaluate()
+
+    With more than one thread, the column elements are partitioned into colors such that no two
+    elements of one color share a node (see Core::FE::Utils::build_element_coloring()). The
+    elements of one color are then evaluated and assembled concurrently. The colored loop is only
+    taken if all system matrices handed to evaluate() are Core::LinAlg::SparseMatrix objects that
+    are already filled, i.e. the first assembly that establishes the sparsity pattern and the
+    assembly into block matrices always run in the usual element order. Without OpenMP, the
+    colored loop runs on a single thread.
+
+    \note Only enable this for discretizations whose elements evaluate thread-safe, i.e. do not
+    write to shared scratch memory or to the parameter list during evaluate().
+    */
+    void set_num_evaluate_threads(int num_threads);
+
+    /// Number of threads used for the element loop in evaluate()
+    [[nodiscard]] int num_evaluate_threads() const { return num_evaluate_threads_; }
+
+    /*!
+    \brief Reuse elemat1 of elements with a state-independent tangent in evaluate()
+
+    If enabled, elemat1 of every element that declares it state-independent (see
+    Core::Elements::Element::has_state_independent_tangent()) is stored after its first evaluation
+    and copied from the cache afterwards. The element is still evaluated for all other matrices
+    and vectors, but receives an empty elemat1. Disabling releases the cache.
+
+    The cached matrices are keyed by element id only. They are outdated automatically by
+    fill_complete(), i.e. whenever the elements, nodes or degrees of freedom change. Everything
+    else an element bases has_state_independent_tangent() on is not tracked: the caller has to
+    call invalidate_element_matrix_cache() whenever the reference geometry, the material or its
+    parameters, the element technology or the evaluation parameters that enter elemat1 of such
+    elements change. Otherwise the previously stored matrices are assembled.
+    */
+    void set_element_matrix_caching(bool cache);
+
+    /// Whether elemat1 of elements with a state-independent tangent is reused in evaluate()
+    [[nodiscard]] bool element_matrix_caching() const { return cache_element_matrices_; }
+
+    /// Outdate all cached element matrices, they are recomputed during the next evaluate()
+    void invalidate_element_matrix_cache() { element_matrix_cache_.invalidate(); }
+
     /*!
     \brief Evaluate Neumann boundary conditions
 
@@ -2116,6 +2159,18 @@ namespace Core::FE
     void find_associated_ele_i_ds(
         Core::Conditions::Condition& cond, std::set<int>& VolEleIDs, const std::string& name);
 
+    /*!
+    \brief Thread-parallel element loop over the element colors used by evaluate()
+
+    Each thread owns its element matrices, vectors and location array. The colors are processed
+    one after another, the elements within one color concurrently.
+    */
+    void evaluate_colored(Teuchos::ParameterList& params, Core::FE::AssembleStrategy& strategy,
+        const std::function<void(Core::Elements::Element&, Core::Elements::LocationArray&,
+            Core::LinAlg::SerialDenseMatrix&, Core::LinAlg::SerialDenseMatrix&,
+            Core::LinAlg::SerialDenseVector&, Core::LinAlg::SerialDenseVector&,
+            Core::LinAlg::SerialDenseVector&)>& element_action);
+
    protected:
     /*!
     \brief Build the geometry of lines for a certain line condition
@@ -2274,6 +2329,18 @@ namespace Core::FE
 
     //! number of space dimension
     const unsigned int n_dim_;
+
+    //! number of threads used for the element loop in evaluate()
+    int num_evaluate_threads_;
+
+    //! column element lids grouped by color, built on demand for the threaded element loop
+    std::vector<std::vector<int>> element_colors_;
+
+    //! whether elemat1 of elements with a state-independent tangent is cached
+    bool cache_element_matrices_;
+
+    //! cached elemat1 of elements with a state-independent tangent
+    ElementMatrixCache element_matrix_cache_;
   };  // class Discretization
 }  // namespace Core::FE
 
@@ -0,0 +1,69 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fem_discretization_element_matrix_cache.hpp"
+
+#include "4C_linalg_serialdensematrix.hpp"
+
+#include <algorithm>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::FE::ElementMatrixCache::extract(int eid, Core::LinAlg::SerialDenseMatrix& matrix) const
+{
+  const auto entry = entries_.find(eid);
+  if (entry == entries_.end()) return false;
+
+  const Entry& e = entry->second;
+  if (e.version != version_ or e.num_rows != matrix.numRows() or e.num_cols != matrix.numCols())
+    return false;
+
+  // both the arena and SerialDenseMatrix are column-major
+  const double* values = arena_.data() + e.offset;
+  for (int j = 0; j < e.num_cols; ++j)
+    std::copy_n(values + static_cast<std::size_t>(j) * e.num_rows, e.num_rows, matrix[j]);
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::ElementMatrixCache::store(int eid, const Core::LinAlg::SerialDenseMatrix& matrix)
+{
+  const int num_rows = matrix.numRows();
+  const int num_cols = matrix.numCols();
+
+  auto [entry, inserted] = entries_.try_emplace(eid, Entry{arena_.size(), num_rows, num_cols, 0});
+  Entry& e = entry->second;
+  if (inserted or e.num_rows * e.num_cols < num_rows * num_cols)
+  {
+    e.offset = arena_.size();
+    arena_.resize(arena_.size() + static_cast<std::size_t>(num_rows) * num_cols);
+  }
+  e.num_rows = num_rows;
+  e.num_cols = num_cols;
+  e.version = version_;
+
+  double* values = arena_.data() + e.offset;
+  for (int j = 0; j < num_cols; ++j)
+    std::copy_n(matrix[j], num_rows, values + static_cast<std::size_t>(j) * num_rows);
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::ElementMatrixCache::clear()
+{
+  entries_.clear();
+  arena_.clear();
+  arena_.shrink_to_fit();
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,80 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FEM_DISCRETIZATION_ELEMENT_MATRIX_CACHE_HPP
+#define FOUR_C_FEM_DISCRETIZATION_ELEMENT_MATRIX_CACHE_HPP
+
+#include "4C_config.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::LinAlg
+{
+  class SerialDenseMatrix;
+}
+
+namespace Core::FE
+{
+  /*!
+  \brief Element matrices keyed by element id and state version
+
+  All matrices are stored in one contiguous arena. An entry is only valid in the state version it
+  was stored in. invalidate() advances the version and thereby outdates all entries at once
+  without releasing their memory, storing a matrix of the same size again reuses the old slot.
+  */
+  class ElementMatrixCache
+  {
+   public:
+    /*!
+    \brief Copy the matrix of element @p eid into @p matrix
+
+    @return false if there is no entry of the current version with the dimensions of @p matrix,
+    @p matrix is left untouched in this case
+    */
+    bool extract(int eid, Core::LinAlg::SerialDenseMatrix& matrix) const;
+
+    /// Store the matrix of element @p eid in the current version
+    void store(int eid, const Core::LinAlg::SerialDenseMatrix& matrix);
+
+    /// Outdate all entries
+    void invalidate() { ++version_; }
+
+    /// Release all entries and the arena
+    void clear();
+
+    /// Number of matrix values held by the arena
+    [[nodiscard]] std::size_t arena_size() const { return arena_.size(); }
+
+   private:
+    struct Entry
+    {
+      //! position of the first value in the arena
+      std::size_t offset;
+
+      int num_rows;
+
+      int num_cols;
+
+      //! version the values were stored in
+      unsigned version;
+    };
+
+    std::unordered_map<int, Entry> entries_;
+
+    std::vector<double> arena_;
+
+    unsigned version_ = 0;
+  };
+}  // namespace Core::FE
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
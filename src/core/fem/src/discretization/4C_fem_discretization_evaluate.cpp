@@ -22,6 +22,9 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <exception>
+#include <utility>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------*
@@ -51,8 +54,7 @@ void Core::FE::Discretization::evaluate(
           Core::LinAlg::SerialDenseVector& elevec3)
       {
         const int err =
-            ele.evaluate(params, *this, la, strategy.elematrix1(), strategy.elematrix2(),
-                strategy.elevector1(), strategy.elevector2(), strategy.elevector3());
+            ele.evaluate(params, *this, la, elemat1, elemat2, elevec1, elevec2, elevec3);
         if (err)
           FOUR_C_THROW("Proc %d: Element %d returned err=%d", get_comm().MyPID(), ele.id(), err);
       });
@@ -83,6 +85,30 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
       strategy.systemmatrix1(), strategy.systemmatrix2(), strategy.systemvector1(),
       strategy.systemvector2(), strategy.systemvector3());
 
+  // the threaded element loop relies on a fixed sparsity pattern, since inserting new entries
+  // into a non-filled matrix is not thread-safe. Only SparseMatrix assembles without shared
+  // scratch data, block matrices are assembled serially.
+  const auto can_assemble_threaded = [](const Core::LinAlg::SparseOperator& matrix)
+  {
+    return dynamic_cast<const Core::LinAlg::SparseMatrix*>(&matrix) != nullptr and
+           matrix.filled();
+  };
+  bool evaluate_threaded = num_evaluate_threads_ > 1;
+  if (strategy.assemblemat1() and !can_assemble_threaded(*strategy.systemmatrix1()))
+    evaluate_threaded = false;
+  if (strategy.assemblemat2() and !can_assemble_threaded(*strategy.systemmatrix2()))
+    evaluate_threaded = false;
+
+  if (evaluate_threaded)
+  {
+    evaluate_colored(params, strategy, element_action);
+    return;
+  }
+
+  const bool use_element_matrix_cache = cache_element_matrices_ and strategy.assemblemat1();
+  // handed to elements whose elemat1 is taken from the cache
+  Core::LinAlg::SerialDenseMatrix no_elematrix;
+
   Core::Elements::LocationArray la(dofsets_.size());
 
   // loop over column elements
@@ -95,11 +121,20 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
     // Reshape element matrices and vectors and init to zero
     strategy.clear_element_storage(la[row].size(), la[col].size());
 
+    int eid = actele->id();
+
+    const bool state_independent_tangent =
+        use_element_matrix_cache and actele->has_state_independent_tangent(params);
+    const bool cached =
+        state_independent_tangent and element_matrix_cache_.extract(eid, strategy.elematrix1());
+
     // call the element evaluate method
-    element_action(*actele, la, strategy.elematrix1(), strategy.elematrix2(), strategy.elevector1(),
-        strategy.elevector2(), strategy.elevector3());
+    element_action(*actele, la, cached ? no_elematrix : strategy.elematrix1(),
+        strategy.elematrix2(), strategy.elevector1(), strategy.elevector2(), strategy.elevector3());
+
+    if (state_independent_tangent and not cached)
+      element_matrix_cache_.store(eid, strategy.elematrix1());
 
-    int eid = actele->id();
     strategy.assemble_matrix1(eid, la[row].lm_, la[col].lm_, la[row].lmowner_, la[col].stride_);
     strategy.assemble_matrix2(eid, la[row].lm_, la[col].lm_, la[row].lmowner_, la[col].stride_);
     strategy.assemble_vector1(la[row].lm_, la[row].lmowner_);
@@ -109,6 +144,134 @@ void Core::FE::Discretization::evaluate(Teuchos::ParameterList& params,
 }
 
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::set_num_evaluate_threads(int num_threads)
+{
+  if (num_threads < 1) FOUR_C_THROW("Number of evaluate threads must be positive.");
+  num_evaluate_threads_ = num_threads;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::set_element_matrix_caching(bool cache)
+{
+  cache_element_matrices_ = cache;
+  if (!cache_element_matrices_) element_matrix_cache_.clear();
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::Discretization::evaluate_colored(
+    Teuchos::ParameterList& params, Core::FE::AssembleStrategy& strategy,
+    const std::function<void(Core::Elements::Element&, Core::Elements::LocationArray&,
+        Core::LinAlg::SerialDenseMatrix&, Core::LinAlg::SerialDenseMatrix&,
+        Core::LinAlg::SerialDenseVector&, Core::LinAlg::SerialDenseVector&,
+        Core::LinAlg::SerialDenseVector&)>& element_action)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Core::FE::Discretization::evaluate_colored");
+
+  if (element_colors_.empty()) element_colors_ = Core::FE::Utils::build_element_coloring(*this);
+
+  const int row = strategy.first_dof_set();
+  const int col = strategy.second_dof_set();
+
+  const bool use_element_matrix_cache = cache_element_matrices_ and strategy.assemblemat1();
+
+  // exceptions must not leave a parallel region, so the first one is kept and rethrown afterwards
+  std::exception_ptr exception = nullptr;
+
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp parallel num_threads(num_evaluate_threads_)
+#endif
+  {
+    Core::Elements::LocationArray la(dofsets_.size());
+    Core::LinAlg::SerialDenseMatrix elematrix1;
+    Core::LinAlg::SerialDenseMatrix elematrix2;
+    Core::LinAlg::SerialDenseVector elevector1;
+    Core::LinAlg::SerialDenseVector elevector2;
+    Core::LinAlg::SerialDenseVector elevector3;
+    Core::LinAlg::SerialDenseMatrix no_elematrix;
+
+    // the cache is only read inside the element loop, new entries are stored afterwards
+    std::vector<std::pair<int, Core::LinAlg::SerialDenseMatrix>> new_cache_entries;
+
+    for (const auto& color : element_colors_)
+    {
+      // the implicit barrier at the end of the work-sharing loop separates the colors
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+      for (std::size_t i = 0; i < color.size(); ++i)
+      {
+        try
+        {
+          Core::Elements::Element* actele = elecolptr_[color[i]];
+
+          actele->location_vector(*this, la, false);
+
+          const int rdim = la[row].size();
+          const int cdim = la[col].size();
+          if (strategy.assemblemat1()) elematrix1.shape(rdim, cdim);
+          if (strategy.assemblemat2()) elematrix2.shape(rdim, cdim);
+          if (strategy.assemblevec1()) elevector1.size(rdim);
+          if (strategy.assemblevec2()) elevector2.size(rdim);
+          if (strategy.assemblevec3()) elevector3.size(rdim);
+
+          const int eid = actele->id();
+
+          const bool state_independent_tangent =
+              use_element_matrix_cache and actele->has_state_independent_tangent(params);
+          const bool cached =
+              state_independent_tangent and element_matrix_cache_.extract(eid, elematrix1);
+
+          element_action(*actele, la, cached ? no_elematrix : elematrix1, elematrix2, elevector1,
+              elevector2, elevector3);
+
+          if (state_independent_tangent and not cached)
+            new_cache_entries.emplace_back(eid, elematrix1);
+
+          if (strategy.assemblemat1())
+          {
+            strategy.assemble(*strategy.systemmatrix1(), eid, la[col].stride_, elematrix1,
+                la[row].lm_, la[row].lmowner_, la[col].lm_);
+          }
+          if (strategy.assemblemat2())
+          {
+            strategy.assemble(*strategy.systemmatrix2(), eid, la[col].stride_, elematrix2,
+                la[row].lm_, la[row].lmowner_, la[col].lm_);
+          }
+          if (strategy.assemblevec1())
+            strategy.assemble(*strategy.systemvector1(), elevector1, la[row].lm_, la[row].lmowner_);
+          if (strategy.assemblevec2())
+            strategy.assemble(*strategy.systemvector2(), elevector2, la[row].lm_, la[row].lmowner_);
+          if (strategy.assemblevec3())
+            strategy.assemble(*strategy.systemvector3(), elevector3, la[row].lm_, la[row].lmowner_);
+        }
+        catch (...)
+        {
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp critical(discretization_evaluate_colored_exception)
+#endif
+          if (!exception) exception = std::current_exception();
+        }
+      }
+    }
+
+    // all threads have passed the barrier of the last color, nobody reads the cache anymore
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp critical(discretization_evaluate_colored_cache)
+#endif
+    for (const auto& [eid, elematrix] : new_cache_entries)
+      element_matrix_cache_.store(eid, elematrix);
+  }
+
+  if (exception) std::rethrow_exception(exception);
+}
+
+
 /*----------------------------------------------------------------------*
  |  evaluate (public)                                        u.kue 01/08|
  *----------------------------------------------------------------------*/
@@ -36,6 +36,8 @@ void Core::FE::Discretization::reset(bool killdofs, bool killcond)
   nodecolmap_ = Teuchos::null;
   noderowptr_.clear();
   nodecolptr_.clear();
+  element_colors_.clear();
+  element_matrix_cache_.invalidate();
 
   // delete all old geometries that are attached to any conditions
   // as early as possible
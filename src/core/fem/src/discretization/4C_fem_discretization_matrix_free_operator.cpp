@@ -0,0 +1,192 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_fem_discretization_matrix_free_operator.hpp"
+
+#include "4C_comm_parobjectfactory.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_linalg_serialdensematrix.hpp"
+#include "4C_linalg_serialdensevector.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Epetra_Import.h>
+#include <Epetra_MultiVector.h>
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  /*!
+   * Evaluate the element matrix of every column element and hand it to @p action together with the
+   * location array. The element matrix is evaluated for the first dof set only.
+   */
+  template <typename Action>
+  void for_each_element_matrix(
+      Core::FE::Discretization& discret, Teuchos::ParameterList& params, Action action)
+  {
+    if (!discret.filled()) FOUR_C_THROW("fill_complete() was not called");
+    if (!discret.have_dofs()) FOUR_C_THROW("assign_degrees_of_freedom() was not called");
+
+    Core::Elements::LocationArray la(discret.num_dof_sets());
+    Core::LinAlg::SerialDenseMatrix elemat1;
+    Core::LinAlg::SerialDenseMatrix elemat2;
+    Core::LinAlg::SerialDenseVector elevec1;
+    Core::LinAlg::SerialDenseVector elevec2;
+    Core::LinAlg::SerialDenseVector elevec3;
+
+    for (auto* actele : discret.my_col_element_range())
+    {
+      actele->location_vector(discret, la, false);
+
+      const int dim = la[0].size();
+      elemat1.shape(dim, dim);
+      elevec1.size(dim);
+
+      const int err =
+          actele->evaluate(params, discret, la, elemat1, elemat2, elevec1, elevec2, elevec3);
+      if (err)
+      {
+        FOUR_C_THROW(
+            "Proc %d: Element %d returned err=%d", discret.get_comm().MyPID(), actele->id(), err);
+      }
+
+      action(la[0], elemat1);
+    }
+  }
+}  // namespace
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Core::FE::MatrixFreeOperator::MatrixFreeOperator(Teuchos::RCP<Core::FE::Discretization> discret,
+    const Teuchos::ParameterList& params, Teuchos::RCP<const Epetra_Map> dbcmap)
+    : discret_(discret), params_(params), dbcmap_(dbcmap)
+{
+  if (discret_.is_null()) FOUR_C_THROW("Matrix-free operator needs a discretization.");
+
+  // element types may prepare data for the element loops, as in Discretization::evaluate(). The
+  // state does not change while the operator is applied, so this is done once per operator.
+  Core::Communication::ParObjectFactory::instance().pre_evaluate(*discret_, params_, Teuchos::null,
+      Teuchos::null, Teuchos::null, Teuchos::null, Teuchos::null);
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+int Core::FE::MatrixFreeOperator::Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Core::FE::MatrixFreeOperator::Apply");
+
+  const Epetra_Map& dofrowmap = *discret_->dof_row_map();
+  const Epetra_Map& dofcolmap = *discret_->dof_col_map();
+  if (!X.Map().SameAs(dofrowmap) or !Y.Map().SameAs(dofrowmap))
+    FOUR_C_THROW("Vectors of the matrix-free operator have to be based on the dof row map.");
+  if (X.NumVectors() != Y.NumVectors()) FOUR_C_THROW("Number of vectors does not match.");
+
+  const int numvec = X.NumVectors();
+  const int myrank = Comm().MyPID();
+
+  // X and Y may be the same vector
+  Epetra_MultiVector Xcol(dofcolmap, numvec, false);
+  Xcol.Import(X, Epetra_Import(dofcolmap, dofrowmap), Insert);
+
+  Epetra_MultiVector AX(dofrowmap, numvec, true);
+  std::vector<int> collids;
+
+  for_each_element_matrix(*discret_, params_,
+      [&](const Core::Elements::LocationData& dofs,
+          const Core::LinAlg::SerialDenseMatrix& elemat)
+      {
+        const int dim = dofs.size();
+        collids.resize(dim);
+        for (int j = 0; j < dim; ++j) collids[j] = dofcolmap.LID(dofs.lm_[j]);
+
+        for (int i = 0; i < dim; ++i)
+        {
+          if (dofs.lmowner_[i] != myrank) continue;
+          const int rowlid = dofrowmap.LID(dofs.lm_[i]);
+
+          for (int k = 0; k < numvec; ++k)
+          {
+            double value = 0.0;
+            for (int j = 0; j < dim; ++j) value += elemat(i, j) * Xcol[k][collids[j]];
+            AX[k][rowlid] += value;
+          }
+        }
+      });
+
+  // Dirichlet rows are identity rows
+  if (!dbcmap_.is_null())
+  {
+    for (int i = 0; i < dbcmap_->NumMyElements(); ++i)
+    {
+      const int rowlid = dofrowmap.LID(dbcmap_->GID(i));
+      for (int k = 0; k < numvec; ++k) AX[k][rowlid] = X[k][rowlid];
+    }
+  }
+
+  Y = AX;
+
+  return 0;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::FE::MatrixFreeOperator::extract_diagonal(Epetra_Vector& diagonal) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Core::FE::MatrixFreeOperator::extract_diagonal");
+
+  const Epetra_Map& dofrowmap = *discret_->dof_row_map();
+  if (!diagonal.Map().SameAs(dofrowmap))
+    FOUR_C_THROW("Diagonal of the matrix-free operator has to be based on the dof row map.");
+
+  const int myrank = Comm().MyPID();
+
+  diagonal.PutScalar(0.0);
+
+  for_each_element_matrix(*discret_, params_,
+      [&](const Core::Elements::LocationData& dofs,
+          const Core::LinAlg::SerialDenseMatrix& elemat)
+      {
+        for (int i = 0; i < dofs.size(); ++i)
+          if (dofs.lmowner_[i] == myrank) diagonal[dofrowmap.LID(dofs.lm_[i])] += elemat(i, i);
+      });
+
+  if (!dbcmap_.is_null())
+  {
+    for (int i = 0; i < dbcmap_->NumMyElements(); ++i)
+      diagonal[dofrowmap.LID(dbcmap_->GID(i))] = 1.0;
+  }
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+const Epetra_Comm& Core::FE::MatrixFreeOperator::Comm() const { return discret_->get_comm(); }
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+const Epetra_Map& Core::FE::MatrixFreeOperator::OperatorDomainMap() const
+{
+  return *discret_->dof_row_map();
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+const Epetra_Map& Core::FE::MatrixFreeOperator::OperatorRangeMap() const
+{
+  return *discret_->dof_row_map();
+}
+
+FOUR_C_NAMESPACE_CLOSE
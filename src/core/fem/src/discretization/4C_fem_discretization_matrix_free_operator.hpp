@@ -0,0 +1,101 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_FEM_DISCRETIZATION_MATRIX_FREE_OPERATOR_HPP
+#define FOUR_C_FEM_DISCRETIZATION_MATRIX_FREE_OPERATOR_HPP
+
+#include "4C_config.hpp"
+
+#include <Epetra_Map.h>
+#include <Epetra_Operator.h>
+#include <Epetra_Vector.h>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::FE
+{
+  class Discretization;
+
+  /*!
+  \brief Tangent operator of a discretization that is applied without assembling it
+
+  Every Apply() loops over the column elements, evaluates the element matrix (elemat1) with the
+  given parameter list and multiplies it with the element part of the input vector. Only rows owned
+  by this process are summed up, so no communication besides the import of the input vector is
+  needed. The global matrix is never stored, which trades memory for one element evaluation per
+  Krylov iteration.
+
+  The element action in @p params and all states the elements need have to be set on the
+  discretization by the caller, exactly as for an assembling Discretization::evaluate() call. Rows
+  in the optional Dirichlet map are treated as identity rows, which matches the rows of an
+  assembled matrix after Core::LinAlg::apply_dirichlet_to_system().
+
+  The element types prepare the element loops once in the constructor, so the states must not
+  change during the lifetime of the operator.
+
+  Since the diagonal of the operator is available via extract_diagonal(), the operator can be
+  preconditioned by the Chebyshev preconditioner of the linear solver.
+  */
+  class MatrixFreeOperator : public Epetra_Operator
+  {
+   public:
+    /*!
+    \brief Constructor
+
+    \param discret (in): filled discretization with assigned degrees of freedom
+    \param params (in): parameters handed to the element evaluation
+    \param dbcmap (in): degrees of freedom with Dirichlet conditions, may be null
+    */
+    MatrixFreeOperator(Teuchos::RCP<Core::FE::Discretization> discret,
+        const Teuchos::ParameterList& params, Teuchos::RCP<const Epetra_Map> dbcmap);
+
+    //! Compute Y = A X
+    int Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const override;
+
+    //! Not supported
+    int ApplyInverse(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const override
+    {
+      return -1;
+    }
+
+    //! Only the non-transposed operator is supported
+    int SetUseTranspose(bool UseTranspose) override { return UseTranspose ? -1 : 0; }
+
+    double NormInf() const override { return -1.0; }
+
+    const char* Label() const override { return "Core::FE::MatrixFreeOperator"; }
+
+    bool UseTranspose() const override { return false; }
+
+    bool HasNormInf() const override { return false; }
+
+    const Epetra_Comm& Comm() const override;
+
+    const Epetra_Map& OperatorDomainMap() const override;
+
+    const Epetra_Map& OperatorRangeMap() const override;
+
+    //! Sum up the diagonal entries of the element matrices into @p diagonal (dof row map)
+    void extract_diagonal(Epetra_Vector& diagonal) const;
+
+   private:
+    //! discretization whose elements are evaluated
+    Teuchos::RCP<Core::FE::Discretization> discret_;
+
+    //! parameters of the element evaluation, elements may modify them
+    mutable Teuchos::ParameterList params_;
+
+    //! degrees of freedom with Dirichlet conditions
+    Teuchos::RCP<const Epetra_Map> dbcmap_;
+  };
+}  // namespace Core::FE
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -121,4 +121,49 @@ void Core::FE::Utils::do_initial_field(const Core::Utils::FunctionManager& funct
   }
 }
 
+/*----------------------------------------------------------------------------*
+ *----------------------------------------------------------------------------*/
+std::vector<std::vector<int>> Core::FE::Utils::build_element_coloring(
+    const Core::FE::Discretization& discret)
+{
+  if (!discret.filled()) FOUR_C_THROW("fill_complete() was not called");
+
+  const int numcolele = discret.num_my_col_elements();
+  std::vector<int> element_color(numcolele, -1);
+  std::vector<std::vector<int>> colors;
+
+  // colors already taken by elements sharing a node with the current one, marked with the lid of
+  // the current element to avoid resetting the array in every step
+  std::vector<int> forbidden;
+
+  for (auto* actele : discret.my_col_element_range())
+  {
+    const int lid = actele->lid();
+    Core::Nodes::Node** nodes = actele->nodes();
+    for (int inode = 0; inode < actele->num_node(); ++inode)
+    {
+      Core::Elements::Element** adjacent_elements = nodes[inode]->elements();
+      for (int iele = 0; iele < nodes[inode]->num_element(); ++iele)
+      {
+        const int adjacent_color = element_color[adjacent_elements[iele]->lid()];
+        if (adjacent_color >= 0) forbidden[adjacent_color] = lid;
+      }
+    }
+
+    int color = 0;
+    while (color < static_cast<int>(colors.size()) and forbidden[color] == lid) ++color;
+
+    if (color == static_cast<int>(colors.size()))
+    {
+      colors.emplace_back();
+      forbidden.emplace_back(-1);
+    }
+
+    element_color[lid] = color;
+    colors[color].emplace_back(lid);
+  }
+
+  return colors;
+}
+
 FOUR_C_NAMESPACE_CLOSE
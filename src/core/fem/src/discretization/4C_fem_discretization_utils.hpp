@@ -17,6 +17,7 @@
 #include <Teuchos_RCP.hpp>
 
 #include <set>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -155,6 +156,17 @@ namespace Core::FE
         const Core::FE::Discretization& discret, Core::Conditions::Condition& cond,
         Core::LinAlg::Vector<double>& fieldvector, const std::vector<int>& locids);
 
+    /*!
+    \brief Partition the column elements of @p discret into colors
+
+    Greedy coloring such that no two elements of the same color share a node. Elements of one
+    color thus never write into the same rows of an assembled system matrix or vector and can be
+    evaluated and assembled concurrently.
+
+    \return column element lids grouped by color
+    */
+    std::vector<std::vector<int>> build_element_coloring(const Core::FE::Discretization& discret);
+
     /** \brief Build a Dbc object
      *
      *  The Dbc object is build in dependency of the given discretization.
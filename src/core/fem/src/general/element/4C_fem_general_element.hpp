@@ -1075,6 +1075,23 @@ might become invalid after a redistribution of the discretization.
         Core::LinAlg::SerialDenseMatrix& elemat2, Core::LinAlg::SerialDenseVector& elevec1,
         Core::LinAlg::SerialDenseVector& elevec2, Core::LinAlg::SerialDenseVector& elevec3);
 
+    /*!
+    \brief Return whether elemat1 of evaluate() is independent of the current state
+
+    An element returning true declares that, for the commands given in params, the matrix
+    elemat1 only depends on the reference configuration and the material parameters. The
+    discretization may then reuse a previously computed elemat1 (see
+    Core::FE::Discretization::set_element_matrix_caching()) and passes an empty elemat1 to
+    evaluate(). In this case the element must not touch elemat1 and still compute all other
+    requested matrices and vectors.
+
+    \param params (in) : ParameterList containing the commands for evaluate()
+    */
+    virtual bool has_state_independent_tangent(const Teuchos::ParameterList& params) const
+    {
+      return false;
+    }
+
     /*!
     \brief Evaluate a Neumann boundary condition
 
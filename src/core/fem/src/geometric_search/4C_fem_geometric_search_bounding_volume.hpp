@@ -69,6 +69,7 @@ namespace Core::GeometricSearch
     }
     inline void extend_boundaries(const double offset) {}
     inline void add_point(const Core::LinAlg::Matrix<3, 1, double> &point) {}
+    inline bool contains(const BoundingVolume &other) const { return false; }
 #else
     /*! \brief Constructor initializing the bounding volume corners with numerical limit values.
      */
@@ -104,6 +105,22 @@ namespace Core::GeometricSearch
       }
     }
 
+    /*! \brief Checks whether another bounding volume lies completely inside this one.
+     *
+     * @param other Bounding volume to check
+     * @return True if all slabs of @p other lie within the slabs of this bounding volume
+     */
+    inline bool contains(const BoundingVolume& other) const
+    {
+      for (int i_dir = 0; i_dir < kdop_directions; i_dir++)
+      {
+        if (other.bounding_volume_._min_values[i_dir] < bounding_volume_._min_values[i_dir] or
+            other.bounding_volume_._max_values[i_dir] > bounding_volume_._max_values[i_dir])
+          return false;
+      }
+      return true;
+    }
+
     //! Use an ArborX geometry as internal storage.
     ArborX::Experimental::KDOP<kdop_k> bounding_volume_;
 #endif
@@ -0,0 +1,185 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_discretization_utils.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_utils_sparse_algebra_create.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <Epetra_SerialComm.h>
+
+#include <set>
+#include <utility>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  class ElementColoringTest : public testing::Test
+  {
+   public:
+    ElementColoringTest()
+    {
+      create_material_in_global_problem();
+
+      comm_ = Teuchos::make_rcp<Epetra_SerialComm>();
+      test_discretization_ = Teuchos::make_rcp<Core::FE::Discretization>("dummy", comm_, 3);
+
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+    }
+
+    void create_discretization(int num_intervals)
+    {
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{num_intervals, num_intervals, num_intervals};
+      inputData.node_gid_of_first_new_node_ = 0;
+
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *test_discretization_, inputData, true);
+
+      test_discretization_->fill_complete(false, false, false);
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+   protected:
+    Teuchos::RCP<Core::FE::Discretization> test_discretization_;
+    Teuchos::RCP<Epetra_SerialComm> comm_;
+  };
+
+  TEST_F(ElementColoringTest, AllElementsSharingOneNode)
+  {
+    // 8 elements around the center node need one color each
+    create_discretization(2);
+
+    const auto colors = Core::FE::Utils::build_element_coloring(*test_discretization_);
+
+    EXPECT_EQ(colors.size(), 8u);
+    for (const auto& color : colors) EXPECT_EQ(color.size(), 1u);
+  }
+
+  TEST_F(ElementColoringTest, ColorsAreConflictFree)
+  {
+    create_discretization(5);
+
+    const auto colors = Core::FE::Utils::build_element_coloring(*test_discretization_);
+
+    // a structured hex mesh is colorable with 8 colors, greedy coloring in lexicographic order
+    // should find this as well
+    EXPECT_EQ(colors.size(), 8u);
+
+    std::set<int> colored_elements;
+    for (const auto& color : colors)
+    {
+      std::set<int> nodes_of_color;
+      for (const int lid : color)
+      {
+        EXPECT_TRUE(colored_elements.insert(lid).second);
+
+        const Core::Elements::Element* ele = test_discretization_->l_col_element(lid);
+        for (int inode = 0; inode < ele->num_node(); ++inode)
+          EXPECT_TRUE(nodes_of_color.insert(ele->node_ids()[inode]).second);
+      }
+    }
+
+    EXPECT_EQ(static_cast<int>(colored_elements.size()),
+        test_discretization_->num_my_col_elements());
+  }
+
+  TEST_F(ElementColoringTest, ColoredEvaluateMatchesSerialEvaluate)
+  {
+    create_discretization(4);
+    test_discretization_->fill_complete(true, false, false);
+    const Epetra_Map& dofrowmap = *test_discretization_->dof_row_map();
+
+    // element contributions that only depend on the element id and the local dof indices
+    const auto element_action =
+        [](Core::Elements::Element& ele, Core::Elements::LocationArray& la,
+            Core::LinAlg::SerialDenseMatrix& elemat1, Core::LinAlg::SerialDenseMatrix& elemat2,
+            Core::LinAlg::SerialDenseVector& elevec1, Core::LinAlg::SerialDenseVector& elevec2,
+            Core::LinAlg::SerialDenseVector& elevec3)
+    {
+      for (int i = 0; i < elevec1.length(); ++i)
+      {
+        elevec1(i) = ele.id() + 1.0;
+        for (int j = 0; j < elemat1.numCols(); ++j) elemat1(i, j) = ele.id() + i - j;
+      }
+    };
+
+    const auto assemble = [&](int num_threads)
+    {
+      test_discretization_->set_num_evaluate_threads(num_threads);
+
+      auto matrix = Teuchos::make_rcp<Core::LinAlg::SparseMatrix>(dofrowmap, 81, false, true);
+      auto vector = Core::LinAlg::create_vector(dofrowmap, true);
+      Core::FE::AssembleStrategy strategy(
+          0, 0, matrix, Teuchos::null, vector, Teuchos::null, Teuchos::null);
+      Teuchos::ParameterList params;
+
+      // the first evaluate establishes the sparsity pattern, the second one takes the colored loop
+      test_discretization_->evaluate(params, strategy, element_action);
+      matrix->complete();
+      matrix->zero();
+      vector->PutScalar(0.0);
+      test_discretization_->evaluate(params, strategy, element_action);
+      matrix->complete();
+
+      return std::make_pair(matrix, vector);
+    };
+
+    const auto [serial_matrix, serial_vector] = assemble(1);
+    const auto [colored_matrix, colored_vector] = assemble(4);
+
+    for (int i = 0; i < dofrowmap.NumMyElements(); ++i)
+      EXPECT_EQ((*serial_vector)[i], (*colored_vector)[i]);
+
+    for (int rlid = 0; rlid < dofrowmap.NumMyElements(); ++rlid)
+    {
+      int serial_length, colored_length;
+      double *serial_values, *colored_values;
+      int *serial_indices, *colored_indices;
+      serial_matrix->epetra_matrix()->ExtractMyRowView(
+          rlid, serial_length, serial_values, serial_indices);
+      colored_matrix->epetra_matrix()->ExtractMyRowView(
+          rlid, colored_length, colored_values, colored_indices);
+
+      ASSERT_EQ(serial_length, colored_length);
+      for (int i = 0; i < serial_length; ++i)
+      {
+        EXPECT_EQ(serial_indices[i], colored_indices[i]);
+        EXPECT_EQ(serial_values[i], colored_values[i]);
+      }
+    }
+  }
+}  // namespace
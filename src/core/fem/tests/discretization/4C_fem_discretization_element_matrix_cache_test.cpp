@@ -0,0 +1,69 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_discretization_element_matrix_cache.hpp"
+
+#include "4C_linalg_serialdensematrix.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  Core::LinAlg::SerialDenseMatrix make_matrix(int num_rows, int num_cols, double offset)
+  {
+    Core::LinAlg::SerialDenseMatrix matrix(num_rows, num_cols);
+    for (int i = 0; i < num_rows; ++i)
+      for (int j = 0; j < num_cols; ++j) matrix(i, j) = offset + i + 10.0 * j;
+    return matrix;
+  }
+
+  TEST(ElementMatrixCacheTest, StoreAndExtract)
+  {
+    Core::FE::ElementMatrixCache cache;
+    cache.store(3, make_matrix(4, 3, 0.0));
+    cache.store(7, make_matrix(2, 2, 100.0));
+
+    Core::LinAlg::SerialDenseMatrix matrix(4, 3);
+    ASSERT_TRUE(cache.extract(3, matrix));
+    for (int i = 0; i < 4; ++i)
+      for (int j = 0; j < 3; ++j) EXPECT_DOUBLE_EQ(matrix(i, j), i + 10.0 * j);
+
+    Core::LinAlg::SerialDenseMatrix small(2, 2);
+    ASSERT_TRUE(cache.extract(7, small));
+    EXPECT_DOUBLE_EQ(small(1, 1), 111.0);
+
+    // unknown elements and mismatching dimensions are no hits
+    EXPECT_FALSE(cache.extract(5, small));
+    EXPECT_FALSE(cache.extract(3, small));
+  }
+
+  TEST(ElementMatrixCacheTest, InvalidateReusesArena)
+  {
+    Core::FE::ElementMatrixCache cache;
+    cache.store(0, make_matrix(3, 3, 0.0));
+    cache.store(1, make_matrix(3, 3, 1.0));
+    const std::size_t arena_size = cache.arena_size();
+
+    cache.invalidate();
+    Core::LinAlg::SerialDenseMatrix matrix(3, 3);
+    EXPECT_FALSE(cache.extract(0, matrix));
+    EXPECT_FALSE(cache.extract(1, matrix));
+
+    // storing again in the new version overwrites the old slots
+    cache.store(1, make_matrix(3, 3, 2.0));
+    EXPECT_EQ(cache.arena_size(), arena_size);
+    ASSERT_TRUE(cache.extract(1, matrix));
+    EXPECT_DOUBLE_EQ(matrix(0, 0), 2.0);
+    EXPECT_FALSE(cache.extract(0, matrix));
+
+    cache.clear();
+    EXPECT_EQ(cache.arena_size(), 0u);
+    EXPECT_FALSE(cache.extract(1, matrix));
+  }
+}  // namespace
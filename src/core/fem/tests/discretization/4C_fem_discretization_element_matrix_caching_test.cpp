@@ -0,0 +1,145 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_assemblestrategy.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_vector.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <Epetra_SerialComm.h>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  /*!
+   * Linear solid elements with a St. Venant-Kirchhoff material declare a state-independent
+   * tangent. The element action below stands in for the element evaluation, its matrix entries
+   * only depend on a scale that the test changes between evaluations.
+   */
+  class ElementMatrixCachingTest : public testing::Test
+  {
+   public:
+    ElementMatrixCachingTest()
+    {
+      create_material_in_global_problem();
+
+      comm_ = Teuchos::make_rcp<Epetra_SerialComm>();
+      discretization_ = Teuchos::make_rcp<Core::FE::Discretization>("dummy", comm_, 3);
+
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      Core::IO::GridGenerator::RectangularCuboidInputs inputData{};
+      inputData.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputData.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputData.interval_ = std::array<int, 3>{2, 2, 2};
+      inputData.node_gid_of_first_new_node_ = 0;
+      inputData.elementtype_ = "SOLID";
+      inputData.distype_ = "HEX8";
+      inputData.elearguments_ = "MAT 1 KINEM linear";
+
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(
+          *discretization_, inputData, true);
+      discretization_->fill_complete(true, false, false);
+      discretization_->set_element_matrix_caching(true);
+
+      params_.set("action", "calc_struct_nlnstiff");
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+   protected:
+    //! assemble the element matrices scaled with @p scale and return the first diagonal entry
+    double assemble(double scale)
+    {
+      const auto element_action =
+          [&](Core::Elements::Element& ele, Core::Elements::LocationArray& la,
+              Core::LinAlg::SerialDenseMatrix& elemat1, Core::LinAlg::SerialDenseMatrix& elemat2,
+              Core::LinAlg::SerialDenseVector& elevec1, Core::LinAlg::SerialDenseVector& elevec2,
+              Core::LinAlg::SerialDenseVector& elevec3)
+      {
+        if (elemat1.numRows() == 0) return;
+
+        ++num_element_matrix_evaluations_;
+        for (int i = 0; i < elemat1.numRows(); ++i) elemat1(i, i) = scale;
+      };
+
+      Core::LinAlg::SparseMatrix matrix(*discretization_->dof_row_map(), 81);
+      Core::FE::AssembleStrategy strategy(0, 0, Teuchos::rcpFromRef(matrix), Teuchos::null,
+          Teuchos::null, Teuchos::null, Teuchos::null);
+      discretization_->evaluate(params_, strategy, element_action);
+      matrix.complete();
+
+      Core::LinAlg::Vector<double> diagonal(*discretization_->dof_row_map(), true);
+      matrix.epetra_matrix()->ExtractDiagonalCopy(diagonal);
+      return diagonal[0];
+    }
+
+    Teuchos::RCP<Core::FE::Discretization> discretization_;
+    Teuchos::RCP<Epetra_SerialComm> comm_;
+    Teuchos::ParameterList params_;
+    int num_element_matrix_evaluations_ = 0;
+  };
+
+  TEST_F(ElementMatrixCachingTest, StoredMatricesAreReusedUntilInvalidated)
+  {
+    const int num_elements = discretization_->num_my_col_elements();
+
+    // the first dof belongs to a corner node, i.e. to a single element
+    EXPECT_DOUBLE_EQ(assemble(1.0), 1.0);
+    EXPECT_EQ(num_element_matrix_evaluations_, num_elements);
+
+    // changes the elements do not know about are not tracked, the stored matrices are assembled
+    EXPECT_DOUBLE_EQ(assemble(2.0), 1.0);
+    EXPECT_EQ(num_element_matrix_evaluations_, num_elements);
+
+    discretization_->invalidate_element_matrix_cache();
+    EXPECT_DOUBLE_EQ(assemble(2.0), 2.0);
+    EXPECT_EQ(num_element_matrix_evaluations_, 2 * num_elements);
+  }
+
+  TEST_F(ElementMatrixCachingTest, FillCompleteInvalidates)
+  {
+    const int num_elements = discretization_->num_my_col_elements();
+    assemble(1.0);
+
+    discretization_->fill_complete(false, false, false);
+    EXPECT_DOUBLE_EQ(assemble(3.0), 3.0);
+    EXPECT_EQ(num_element_matrix_evaluations_, 2 * num_elements);
+  }
+
+  TEST_F(ElementMatrixCachingTest, OnlyStateIndependentActionsAreCached)
+  {
+    const int num_elements = discretization_->num_my_col_elements();
+    assemble(1.0);
+
+    // elemat1 is no stiffness matrix for this action
+    params_.set("action", "calc_struct_internalforce");
+    EXPECT_DOUBLE_EQ(assemble(4.0), 4.0);
+    EXPECT_EQ(num_element_matrix_evaluations_, 2 * num_elements);
+  }
+}  // namespace
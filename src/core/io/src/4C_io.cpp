@@ -7,6 +7,7 @@
 
 #include "4C_io.hpp"
 
+#include "4C_comm_pack_buffer.hpp"
 #include "4C_fem_discretization.hpp"
 #include "4C_fem_general_element.hpp"
 #include "4C_fem_general_node.hpp"
@@ -17,10 +18,139 @@
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <Epetra_MpiComm.h>
+#include <Teuchos_TimeMonitor.hpp>
+
 #include <algorithm>
+#include <array>
+#include <numeric>
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * File access property list for a result file that is shared by all processors of @p comm and
+   * accessed via MPI-IO. The caller is responsible for closing the property list.
+   */
+  hid_t create_collective_file_access(const Epetra_Comm& comm)
+  {
+#ifdef H5_HAVE_PARALLEL
+    const auto* mpicomm = dynamic_cast<const Epetra_MpiComm*>(&comm);
+    if (!mpicomm) FOUR_C_THROW("dynamic cast to Epetra_MpiComm failed!");
+
+    hid_t plist = H5Pcreate(H5P_FILE_ACCESS);
+    if (plist < 0) FOUR_C_THROW("Failed to create file access list");
+    const herr_t status = H5Pset_fapl_mpio(plist, mpicomm->Comm(), MPI_INFO_NULL);
+    if (status < 0) FOUR_C_THROW("Failed to set MPI-IO file access");
+    return plist;
+#else
+    FOUR_C_THROW("Collective binary output requires HDF5 with MPI support.");
+#endif
+  }
+
+  /*!
+   * Create the dataset @p name with @p columns columns in the shared result file and write the
+   * @p rows rows of this processor into it collectively. The rows of all processors are stored one
+   * after another in the order of the processors. Their offsets are attached to the dataset as
+   * attribute "writer_offsets", such that the data of each writing processor can still be found.
+   *
+   * A dataset with one column is one-dimensional. Otherwise, the dataset has the shape
+   * (columns, rows) and @p data is expected column by column like the values of a multi vector.
+   */
+  void write_collective_dataset(hid_t group, const std::string& name, hid_t type,
+      const void* data, hsize_t rows, hsize_t columns, const Epetra_Comm& comm)
+  {
+#ifdef H5_HAVE_PARALLEL
+    const auto* mpicomm = dynamic_cast<const Epetra_MpiComm*>(&comm);
+    if (!mpicomm) FOUR_C_THROW("dynamic cast to Epetra_MpiComm failed!");
+
+    long long my_rows = static_cast<long long>(rows);
+    std::vector<long long> offsets(comm.NumProc() + 1, 0);
+    MPI_Allgather(
+        &my_rows, 1, MPI_LONG_LONG, offsets.data() + 1, 1, MPI_LONG_LONG, mpicomm->Comm());
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    const int rank = columns == 1 ? 1 : 2;
+    const std::array<hsize_t, 2> dims = {columns, static_cast<hsize_t>(offsets.back())};
+    const std::array<hsize_t, 2> start = {0, static_cast<hsize_t>(offsets[comm.MyPID()])};
+    const std::array<hsize_t, 2> count = {columns, rows};
+    const hsize_t my_size = columns * rows;
+
+    hid_t filespace = H5Screate_simple(rank, &dims[2 - rank], nullptr);
+    hid_t memspace = H5Screate_simple(1, &my_size, nullptr);
+    if (filespace < 0 or memspace < 0) FOUR_C_THROW("Failed to create dataspace %s", name.c_str());
+
+    hid_t dataset =
+        H5Dcreate2(group, name.c_str(), type, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if (dataset < 0) FOUR_C_THROW("Failed to create dataset %s in HDF-resultfile", name.c_str());
+
+    // processors without rows still take part in the collective write
+    if (my_size == 0)
+    {
+      if (H5Sselect_none(filespace) < 0 or H5Sselect_none(memspace) < 0)
+        FOUR_C_THROW("Failed to select empty part of dataset %s", name.c_str());
+    }
+    else if (H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start[2 - rank], nullptr,
+                 &count[2 - rank], nullptr) < 0)
+    {
+      FOUR_C_THROW("Failed to select hyperslab of dataset %s", name.c_str());
+    }
+
+    hid_t transfer = H5Pcreate(H5P_DATASET_XFER);
+    if (transfer < 0 or H5Pset_dxpl_mpio(transfer, H5FD_MPIO_COLLECTIVE) < 0)
+      FOUR_C_THROW("Failed to set collective transfer mode");
+
+    herr_t status = H5Dwrite(dataset, type, memspace, filespace, transfer, data);
+    if (status < 0) FOUR_C_THROW("Failed to write dataset %s in HDF-resultfile", name.c_str());
+
+    if (H5Pclose(transfer) < 0 or H5Dclose(dataset) < 0 or H5Sclose(memspace) < 0 or
+        H5Sclose(filespace) < 0)
+      FOUR_C_THROW("Failed to close dataset %s in HDF-resultfile", name.c_str());
+
+    status = H5LTset_attribute_long_long(
+        group, name.c_str(), "writer_offsets", offsets.data(), offsets.size());
+    if (status < 0) FOUR_C_THROW("Failed to attach writer offsets to dataset %s", name.c_str());
+#else
+    FOUR_C_THROW("Collective binary output requires HDF5 with MPI support.");
+#endif
+  }
+
+  /*!
+   * Pack the given nodes or elements one by one and append them to @p all_data. Objects whose
+   * packed data differs from the one of the last complete mesh group @p base_objects are
+   * additionally appended to @p changed_data. The packed data of all objects is stored in
+   * @p packed_objects.
+   *
+   * Returns false if the set of objects differs from the one of the last complete mesh group.
+   */
+  template <typename Range>
+  bool pack_changed_objects(const Range& objects,
+      const std::map<int, std::vector<char>>& base_objects,
+      std::map<int, std::vector<char>>& packed_objects, std::vector<char>& all_data,
+      std::vector<char>& changed_data)
+  {
+    bool same_objects = true;
+    for (const auto* object : objects)
+    {
+      Core::Communication::PackBuffer buffer;
+      object->pack(buffer);
+      const std::vector<char>& data = buffer();
+
+      all_data.insert(all_data.end(), data.begin(), data.end());
+
+      const auto base = base_objects.find(object->id());
+      if (base == base_objects.end())
+        same_objects = false;
+      else if (base->second != data)
+        changed_data.insert(changed_data.end(), data.begin(), data.end());
+
+      packed_objects[object->id()] = data;
+    }
+    return same_objects and packed_objects.size() == base_objects.size();
+  }
+}  // namespace
+
 
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
@@ -29,7 +159,8 @@ Core::IO::DiscretizationReader::DiscretizationReader() /* [PROTECTED] */
       input_(Teuchos::null),
       restart_step_(nullptr),
       reader_(Teuchos::null),
-      meshreader_(Teuchos::null)
+      meshreader_(Teuchos::null),
+      mesh_base_step_(-1)
 {
   // intentionally left blank
 }
@@ -38,7 +169,7 @@ Core::IO::DiscretizationReader::DiscretizationReader() /* [PROTECTED] */
 /*----------------------------------------------------------------------*/
 Core::IO::DiscretizationReader::DiscretizationReader(Teuchos::RCP<Core::FE::Discretization> dis,
     Teuchos::RCP<Core::IO::InputControl> input, int step)
-    : dis_(dis), input_(input)
+    : dis_(dis), input_(input), mesh_base_step_(-1)
 {
   find_result_group(step, input_->control_file());
 }
@@ -173,12 +304,6 @@ void Core::IO::DiscretizationReader::read_mesh(int step)
 
   find_mesh_group(step, input_->control_file());
 
-  Teuchos::RCP<std::vector<char>> nodedata =
-      meshreader_->read_node_data(step, get_comm().NumProc(), get_comm().MyPID());
-
-  Teuchos::RCP<std::vector<char>> elementdata =
-      meshreader_->read_element_data(step, get_comm().NumProc(), get_comm().MyPID());
-
   // unpack nodes and elements and redistributed to current layout
   // take care --- we are just adding elements to the discretisation
   // that means depending on the current distribution and the
@@ -186,8 +311,7 @@ void Core::IO::DiscretizationReader::read_mesh(int step)
   // number of elements in dis_
   // the call to redistribute deletes the unnecessary elements,
   // so everything should be OK
-  dis_->unpack_my_nodes(*nodedata);
-  dis_->unpack_my_elements(*elementdata);
+  unpack_mesh_data(step, true);
 
   dis_->setup_ghosting(true, false, false);
 
@@ -203,11 +327,8 @@ void Core::IO::DiscretizationReader::read_nodes_only(int step)
 {
   find_mesh_group(step, input_->control_file());
 
-  Teuchos::RCP<std::vector<char>> nodedata =
-      meshreader_->read_node_data(step, get_comm().NumProc(), get_comm().MyPID());
-
   // unpack nodes; fill_complete() has to be called manually
-  dis_->unpack_my_nodes(*nodedata);
+  unpack_mesh_data(step, false);
   return;
 }
 
@@ -219,12 +340,6 @@ void Core::IO::DiscretizationReader::read_history_data(int step)
 {
   find_mesh_group(step, input_->control_file());
 
-  Teuchos::RCP<std::vector<char>> nodedata =
-      meshreader_->read_node_data(step, get_comm().NumProc(), get_comm().MyPID());
-
-  Teuchos::RCP<std::vector<char>> elementdata =
-      meshreader_->read_element_data(step, get_comm().NumProc(), get_comm().MyPID());
-
   // before we unpack nodes/elements we store a copy of the nodal row/col map
   Epetra_Map noderowmap(*dis_->node_row_map());
   Epetra_Map nodecolmap(*dis_->node_col_map());
@@ -241,8 +356,7 @@ void Core::IO::DiscretizationReader::read_history_data(int step)
   // number of elements in dis_
   // the call to redistribute deletes the unnecessary elements,
   // so everything should be OK
-  dis_->unpack_my_nodes(*nodedata);
-  dis_->unpack_my_elements(*elementdata);
+  unpack_mesh_data(step, true);
   dis_->redistribute(noderowmap, nodecolmap, elerowmap, elecolmap);
   return;
 }
@@ -435,7 +549,32 @@ void Core::IO::DiscretizationReader::find_mesh_group(int step, MAP* file)
   find_group(step, file, "field", "mesh_file", result_info, file_info);
   meshreader_ = open_files("mesh_file", file_info);
 
-  // We do not need result_info as we are interested in the mesh files only.
+  // An incremental mesh group refers to the last complete one in the same mesh file
+  if (!map_find_int(result_info, "mesh_base_step", &mesh_base_step_)) mesh_base_step_ = -1;
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::DiscretizationReader::unpack_mesh_data(int step, bool unpack_elements)
+{
+  // The nodes and elements of an incremental mesh group replace the ones of its base group
+  std::vector<int> steps;
+  if (mesh_base_step_ != -1) steps.push_back(mesh_base_step_);
+  steps.push_back(step);
+
+  for (const int mesh_step : steps)
+  {
+    Teuchos::RCP<std::vector<char>> nodedata =
+        meshreader_->read_node_data(mesh_step, get_comm().NumProc(), get_comm().MyPID());
+    dis_->unpack_my_nodes(*nodedata);
+
+    if (unpack_elements)
+    {
+      Teuchos::RCP<std::vector<char>> elementdata =
+          meshreader_->read_element_data(mesh_step, get_comm().NumProc(), get_comm().MyPID());
+      dis_->unpack_my_elements(*elementdata);
+    }
+  }
 }
 
 
@@ -466,8 +605,14 @@ Teuchos::RCP<Core::IO::HDFReader> Core::IO::DiscretizationReader::open_files(
 
   const std::string filename = map_read_string(result_step, filestring);
 
+  int collective;
+  if (!map_find_int(result_step, "collective_output", &collective))
+  {
+    collective = 0;
+  }
+
   Teuchos::RCP<HDFReader> reader = Teuchos::make_rcp<HDFReader>(dirname);
-  reader->open(filename, numoutputproc, get_comm().NumProc(), get_comm().MyPID());
+  reader->open(filename, numoutputproc, get_comm().NumProc(), get_comm().MyPID(), collective != 0);
   return reader;
 }
 
@@ -487,8 +632,10 @@ Core::IO::DiscretizationWriter::DiscretizationWriter() /* PROTECTED */
       resultgroup_(-1),
       resultfile_changed_(-1),
       meshfile_changed_(-1),
+      mesh_base_step_(-1),
       output_(Teuchos::null),
       binio_(false),
+      collective_result_file_(false),
       spatial_approx_(Core::FE::ShapeFunctionType::undefined)
 {
   // intentionally left blank
@@ -510,7 +657,9 @@ Core::IO::DiscretizationWriter::DiscretizationWriter(Teuchos::RCP<Core::FE::Disc
       resultgroup_(-1),
       resultfile_changed_(-1),
       meshfile_changed_(-1),
+      mesh_base_step_(-1),
       output_(output_control),
+      collective_result_file_(false),
       spatial_approx_(shape_function_type)
 {
   if (output_ != Teuchos::null) binio_ = output_->write_binary_output();
@@ -534,8 +683,10 @@ Core::IO::DiscretizationWriter::DiscretizationWriter(const Core::IO::Discretizat
       resultgroup_(-1),
       resultfile_changed_(-1),
       meshfile_changed_(-1),
+      mesh_base_step_(-1),
       output_(Teuchos::null),
       binio_(false),
+      collective_result_file_(false),
       spatial_approx_(writer.spatial_approx_)
 {
   output_ = (control.is_null() ? writer.output_ : control);
@@ -553,6 +704,10 @@ Core::IO::DiscretizationWriter::DiscretizationWriter(const Core::IO::Discretizat
     resultgroup_ = writer.resultfile_;
     resultfile_changed_ = writer.resultfile_;
     meshfile_changed_ = writer.resultfile_;
+    mesh_base_step_ = writer.mesh_base_step_;
+    mesh_base_nodes_ = writer.mesh_base_nodes_;
+    mesh_base_elements_ = writer.mesh_base_elements_;
+    collective_result_file_ = writer.collective_result_file_;
   }
 }
 
@@ -628,6 +783,9 @@ void Core::IO::DiscretizationWriter::create_mesh_file(const int step)
     meshfile_ = H5Fcreate(meshname.str().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
     if (meshfile_ < 0) FOUR_C_THROW("Failed to open file %s", meshname.str().c_str());
     meshfile_changed_ = step;
+
+    // incremental mesh groups may only refer to complete groups in the same file
+    mesh_base_step_ = -1;
   }
 }
 
@@ -642,7 +800,10 @@ void Core::IO::DiscretizationWriter::create_result_file(const int step)
     resultname << output_->file_name() << ".result." << dis_->name() << ".s" << step;
 
     resultfilename_ = resultname.str();
-    if (get_comm().NumProc() > 1)
+
+    // one shared file of all processors or one file per processor
+    const bool collective = output_->write_collective_binary_output() and get_comm().NumProc() > 1;
+    if (get_comm().NumProc() > 1 and not collective)
     {
       resultname << ".p" << get_comm().MyPID();
     }
@@ -659,8 +820,11 @@ void Core::IO::DiscretizationWriter::create_result_file(const int step)
     mapcache_.clear();
     mapstack_.clear();
 
-    resultfile_ = H5Fcreate(resultname.str().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    const hid_t file_access = collective ? create_collective_file_access(get_comm()) : H5P_DEFAULT;
+    resultfile_ = H5Fcreate(resultname.str().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, file_access);
     if (resultfile_ < 0) FOUR_C_THROW("Failed to open file %s", resultname.str().c_str());
+    if (collective and H5Pclose(file_access) < 0) FOUR_C_THROW("Failed to close file access list");
+    collective_result_file_ = collective;
     resultfile_changed_ = step;
   }
 }
@@ -765,6 +929,10 @@ void Core::IO::DiscretizationWriter::new_step(const int step, const double time)
         {
           output_->control_file() << "    num_output_proc = " << get_comm().NumProc() << "\n";
         }
+        if (collective_result_file_)
+        {
+          output_->control_file() << "    collective_output = 1\n";
+        }
         std::string filename;
         const std::string::size_type pos = resultfilename_.find_last_of('/');
         if (pos == std::string::npos)
@@ -827,12 +995,19 @@ void Core::IO::DiscretizationWriter::write_vector(
 void Core::IO::DiscretizationWriter::write_multi_vector(
     const std::string name, const Core::LinAlg::MultiVector<double>& vec, IO::VectorType vt)
 {
+  TEUCHOS_FUNC_TIME_MONITOR("Core::IO::DiscretizationWriter::write_multi_vector");
+
   if (binio_)
   {
     std::string valuename = name + ".values";
     double* data = vec.Values();
     const hsize_t size = vec.MyLength() * vec.NumVectors();
-    if (size != 0)
+    if (collective_result_file_)
+    {
+      write_collective_dataset(resultgroup_, valuename, H5T_NATIVE_DOUBLE, data, vec.MyLength(),
+          vec.NumVectors(), get_comm());
+    }
+    else if (size != 0)
     {
       const herr_t make_status =
           H5LTmake_dataset_double(resultgroup_, valuename.c_str(), 1, &size, data);
@@ -873,7 +1048,11 @@ void Core::IO::DiscretizationWriter::write_multi_vector(
       const hsize_t mapsize = vec.MyLength();
       idname = name + ".ids";
       int* ids = vec.Map().MyGlobalElements();
-      if (size != 0)
+      if (collective_result_file_)
+      {
+        write_collective_dataset(resultgroup_, idname, H5T_NATIVE_INT, ids, mapsize, 1, get_comm());
+      }
+      else if (size != 0)
       {
         const herr_t make_status =
             H5LTmake_dataset_int(resultgroup_, idname.c_str(), 1, &mapsize, ids);
@@ -955,7 +1134,11 @@ void Core::IO::DiscretizationWriter::write_vector(const std::string name,
     std::string valuename = name + ".values";
     const hsize_t size = vec.size();
     const char* data = vec.data();
-    if (size != 0)
+    if (collective_result_file_)
+    {
+      write_collective_dataset(resultgroup_, valuename, H5T_NATIVE_CHAR, data, size, 1, get_comm());
+    }
+    else if (size != 0)
     {
       const herr_t make_status =
           H5LTmake_dataset_char(resultgroup_, valuename.c_str(), 1, &size, data);
@@ -996,9 +1179,16 @@ void Core::IO::DiscretizationWriter::write_vector(const std::string name,
       const hsize_t mapsize = elemap.NumMyElements();
       idname = name + ".ids";
       int* ids = elemap.MyGlobalElements();
-      const herr_t make_status =
-          H5LTmake_dataset_int(resultgroup_, idname.c_str(), 1, &mapsize, ids);
-      if (make_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-resultfile");
+      if (collective_result_file_)
+      {
+        write_collective_dataset(resultgroup_, idname, H5T_NATIVE_INT, ids, mapsize, 1, get_comm());
+      }
+      else
+      {
+        const herr_t make_status =
+            H5LTmake_dataset_int(resultgroup_, idname.c_str(), 1, &mapsize, ids);
+        if (make_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-resultfile");
+      }
 
       idname = groupname.str() + idname;
 
@@ -1073,19 +1263,22 @@ void Core::IO::DiscretizationWriter::write_mesh(const int step, const double tim
     meshgroup_ = H5Gcreate(meshfile_, name.str().c_str(), 0);
     if (meshgroup_ < 0) FOUR_C_THROW("Failed to write group in HDF-meshfile");
 
+    std::vector<char> nodedata;
+    std::vector<char> elementdata;
+    const int base_step = pack_mesh_data(step, nodedata, elementdata);
+
     // only procs with row elements need to write data
-    Teuchos::RCP<std::vector<char>> elementdata = dis_->pack_my_elements();
-    hsize_t dim = static_cast<hsize_t>(elementdata->size());
+    hsize_t dim = static_cast<hsize_t>(elementdata.size());
     if (dim != 0)
     {
       const herr_t element_status =
-          H5LTmake_dataset_char(meshgroup_, "elements", 1, &dim, elementdata->data());
+          H5LTmake_dataset_char(meshgroup_, "elements", 1, &dim, elementdata.data());
       if (element_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-meshfile");
     }
     else
     {
       const herr_t element_status =
-          H5LTmake_dataset_char(meshgroup_, "elements", 0, &dim, elementdata->data());
+          H5LTmake_dataset_char(meshgroup_, "elements", 0, &dim, elementdata.data());
       if (element_status < 0)
         FOUR_C_THROW(
             "Failed to create dataset in HDF-meshfile on proc %d which does"
@@ -1094,18 +1287,17 @@ void Core::IO::DiscretizationWriter::write_mesh(const int step, const double tim
     }
 
     // only procs with row nodes need to write data
-    Teuchos::RCP<std::vector<char>> nodedata = dis_->pack_my_nodes();
-    dim = static_cast<hsize_t>(nodedata->size());
+    dim = static_cast<hsize_t>(nodedata.size());
     if (dim != 0)
     {
       const herr_t node_status =
-          H5LTmake_dataset_char(meshgroup_, "nodes", 1, &dim, nodedata->data());
+          H5LTmake_dataset_char(meshgroup_, "nodes", 1, &dim, nodedata.data());
       if (node_status < 0) FOUR_C_THROW("Failed to create dataset in HDF-meshfile");
     }
     else
     {
       const herr_t node_status =
-          H5LTmake_dataset_char(meshgroup_, "nodes", 0, &dim, nodedata->data());
+          H5LTmake_dataset_char(meshgroup_, "nodes", 0, &dim, nodedata.data());
       if (node_status < 0)
         FOUR_C_THROW(
             "Failed to create dataset in HDF-meshfile on proc %d which"
@@ -1132,6 +1324,8 @@ void Core::IO::DiscretizationWriter::write_mesh(const int step, const double tim
       // knotvectors for nurbs-discretisation
       write_knotvector();
 
+      if (base_step != -1) output_->control_file() << "    mesh_base_step = " << base_step << "\n";
+
       if (get_comm().NumProc() > 1)
       {
         output_->control_file() << "    num_output_proc = " << get_comm().NumProc() << "\n";
@@ -1158,6 +1352,50 @@ void Core::IO::DiscretizationWriter::write_mesh(const int step, const double tim
   }
 }
 
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+int Core::IO::DiscretizationWriter::pack_mesh_data(
+    const int step, std::vector<char>& nodedata, std::vector<char>& elementdata)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Core::IO::DiscretizationWriter::pack_mesh_data");
+
+  std::map<int, std::vector<char>> nodes;
+  std::map<int, std::vector<char>> elements;
+  std::vector<char> changed_nodedata;
+  std::vector<char> changed_elementdata;
+  const bool same_nodes = pack_changed_objects(
+      dis_->my_row_node_range(), mesh_base_nodes_, nodes, nodedata, changed_nodedata);
+  const bool same_elements = pack_changed_objects(dis_->my_row_element_range(),
+      mesh_base_elements_, elements, elementdata, changed_elementdata);
+
+  // An incremental group requires the same nodes and elements on all procs as in the complete
+  // group it refers to. It is only written if it is considerably smaller than a complete one.
+  int local_incremental = mesh_base_step_ != -1 and same_nodes and same_elements;
+  int incremental = 0;
+  get_comm().MinAll(&local_incremental, &incremental, 1);
+  if (incremental)
+  {
+    const double local_sizes[2] = {
+        static_cast<double>(changed_nodedata.size() + changed_elementdata.size()),
+        static_cast<double>(nodedata.size() + elementdata.size())};
+    double sizes[2] = {0.0, 0.0};
+    get_comm().SumAll(local_sizes, sizes, 2);
+    incremental = 2.0 * sizes[0] < sizes[1];
+  }
+
+  if (incremental)
+  {
+    std::swap(nodedata, changed_nodedata);
+    std::swap(elementdata, changed_elementdata);
+    return mesh_base_step_;
+  }
+
+  mesh_base_step_ = step;
+  std::swap(mesh_base_nodes_, nodes);
+  std::swap(mesh_base_elements_, elements);
+  return -1;
+}
+
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
 void Core::IO::DiscretizationWriter::write_mesh(
@@ -1467,7 +1705,12 @@ void Core::IO::DiscretizationWriter::write_char_data(
     // an appropriate name has to be provided
     std::string valuename = name + ".values";
     const hsize_t size = charvec.size();
-    if (size != 0)
+    if (collective_result_file_)
+    {
+      write_collective_dataset(
+          resultgroup_, valuename, H5T_NATIVE_CHAR, charvec.data(), size, 1, get_comm());
+    }
+    else if (size != 0)
     {
       const herr_t make_status =
           H5LTmake_dataset_char(resultgroup_, valuename.c_str(), 1, &size, charvec.data());
@@ -1511,23 +1754,29 @@ void Core::IO::DiscretizationWriter::write_redundant_double_vector(
 {
   if (binio_)
   {
+    if (collective_result_file_)
+    {
+      // all processors take part in creating the dataset of the shared file, but only proc0
+      // contributes its entries
+      const hsize_t size = get_comm().MyPID() == 0 ? doublevec.size() : 0;
+      write_collective_dataset(
+          resultgroup_, name + ".values", H5T_NATIVE_DOUBLE, doublevec.data(), size, 1, get_comm());
+
+      const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
+      if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+    }
+
     if (get_comm().MyPID() == 0)
     {
       // only proc0 writes the vector entities to the binary data
       // an appropriate name has to be provided
       std::string valuename = name + ".values";
-      const hsize_t size = doublevec.size();
-      if (size != 0)
+      // the dataset of a collective result file has already been written by all processors
+      if (not collective_result_file_)
       {
-        const herr_t make_status =
-            H5LTmake_dataset_double(resultgroup_, valuename.c_str(), 1, &size, doublevec.data());
-        if (make_status < 0)
-          FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
-      }
-      else
-      {
-        const herr_t make_status =
-            H5LTmake_dataset_double(resultgroup_, valuename.c_str(), 0, &size, doublevec.data());
+        const hsize_t size = doublevec.size();
+        const herr_t make_status = H5LTmake_dataset_double(
+            resultgroup_, valuename.c_str(), size != 0 ? 1 : 0, &size, doublevec.data());
         if (make_status < 0)
           FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
       }
@@ -1544,8 +1793,11 @@ void Core::IO::DiscretizationWriter::write_redundant_double_vector(
                               << "        values = \"" << valuename.c_str() << "\"\n\n"
                               << std::flush;
 
-      const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
-      if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+      if (not collective_result_file_)
+      {
+        const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
+        if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+      }
     }  // endif proc0
   }
 }
@@ -1558,23 +1810,29 @@ void Core::IO::DiscretizationWriter::write_redundant_int_vector(
 {
   if (binio_)
   {
+    if (collective_result_file_)
+    {
+      // all processors take part in creating the dataset of the shared file, but only proc0
+      // contributes its entries
+      const hsize_t size = get_comm().MyPID() == 0 ? vectorint.size() : 0;
+      write_collective_dataset(
+          resultgroup_, name + ".values", H5T_NATIVE_INT, vectorint.data(), size, 1, get_comm());
+
+      const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
+      if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+    }
+
     if (get_comm().MyPID() == 0)
     {
       // only proc0 writes the entities to the binary data
       // an appropriate name has to be provided
       std::string valuename = name + ".values";
-      const hsize_t size = vectorint.size();
-      if (size != 0)
-      {
-        const herr_t make_status =
-            H5LTmake_dataset_int(resultgroup_, valuename.c_str(), 1, &size, vectorint.data());
-        if (make_status < 0)
-          FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
-      }
-      else
+      // the dataset of a collective result file has already been written by all processors
+      if (not collective_result_file_)
       {
-        const herr_t make_status =
-            H5LTmake_dataset_int(resultgroup_, valuename.c_str(), 0, &size, vectorint.data());
+        const hsize_t size = vectorint.size();
+        const herr_t make_status = H5LTmake_dataset_int(
+            resultgroup_, valuename.c_str(), size != 0 ? 1 : 0, &size, vectorint.data());
         if (make_status < 0)
           FOUR_C_THROW("Failed to create dataset in HDF-resultfile. status=%d", make_status);
       }
@@ -1591,8 +1849,11 @@ void Core::IO::DiscretizationWriter::write_redundant_int_vector(
                               << "        values = \"" << valuename.c_str() << "\"\n\n"
                               << std::flush;
 
-      const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
-      if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+      if (not collective_result_file_)
+      {
+        const herr_t flush_status = H5Fflush(resultgroup_, H5F_SCOPE_LOCAL);
+        if (flush_status < 0) FOUR_C_THROW("Failed to flush HDF file %s", resultfilename_.c_str());
+      }
     }  // endif proc0
   }
 }
@@ -181,6 +181,13 @@ namespace Core::IO
     /// find control file entry to given time step
     void find_mesh_group(int step, MAP* file);
 
+    /// unpack the nodes and optionally the elements of the mesh group of the given step
+    /*!
+      An incremental mesh group only contains the nodes and elements that changed since the
+      complete mesh group it refers to. In this case, the complete group is unpacked first.
+     */
+    void unpack_mesh_data(int step, bool unpack_elements);
+
     /// find control file entry to given time step
     /*!
       The control file entry with the given caption those field and step match
@@ -204,6 +211,9 @@ namespace Core::IO
 
     Teuchos::RCP<HDFReader> reader_;
     Teuchos::RCP<HDFReader> meshreader_;
+
+    /// step of the complete mesh group the current mesh group refers to, -1 if it is complete
+    int mesh_base_step_;
   };
 
 
@@ -396,6 +406,17 @@ namespace Core::IO
     //! open new mesh file
     void create_mesh_file(const int step);
 
+    /*!
+      \brief pack the row nodes and row elements for the mesh group of the given step
+
+      Only the nodes and elements whose packed data changed since the last complete mesh group are
+      packed, if the discretization is distributed as before and this saves at least half of the
+      data. Otherwise, all nodes and elements are packed and the group becomes the new base.
+
+      \return the step of the complete mesh group an incremental group refers to, -1 otherwise
+     */
+    int pack_mesh_data(const int step, std::vector<char>& nodedata, std::vector<char>& elementdata);
+
     //! open new result file
     void create_result_file(const int step);
 
@@ -421,12 +442,22 @@ namespace Core::IO
     int resultfile_changed_;
     int meshfile_changed_;
 
+    //! step of the last complete mesh group in the current mesh file, -1 if there is none
+    int mesh_base_step_;
+
+    //! packed row nodes and elements of the last complete mesh group by global id
+    std::map<int, std::vector<char>> mesh_base_nodes_;
+    std::map<int, std::vector<char>> mesh_base_elements_;
+
     //! Control file object
     Teuchos::RCP<OutputControl> output_;
 
     //! do we want binary output
     bool binio_;
 
+    //! is the current result file shared by all processors and written collectively
+    bool collective_result_file_;
+
     Core::FE::ShapeFunctionType spatial_approx_;
   };
 
@@ -0,0 +1,270 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_io_binary_mesh.hpp"
+
+#include "4C_fem_discretization.hpp"
+
+#include <Epetra_MpiComm.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  constexpr std::array<char, 8> binary_mesh_magic = {'4', 'C', 'M', 'E', 'S', 'H', '\0', '\0'};
+
+  //! increase whenever the layout of the file changes
+  constexpr int binary_mesh_version = 2;
+
+  //! Location of the packed nodes and elements of one discretization on one process
+  struct SliceIndex
+  {
+    std::int64_t node_offset;
+    std::int64_t node_size;
+    std::int64_t element_offset;
+    std::int64_t element_size;
+  };
+
+  MPI_Comm get_mpi_comm(const Epetra_Comm& comm)
+  {
+    const auto* mpicomm = dynamic_cast<const Epetra_MpiComm*>(&comm);
+    if (!mpicomm) FOUR_C_THROW("dynamic cast to Epetra_MpiComm failed!");
+    return mpicomm->Comm();
+  }
+
+  void check_mpi_error(int err, const std::string& function)
+  {
+    if (err != MPI_SUCCESS) FOUR_C_THROW("%s returned error code %d.", function.c_str(), err);
+  }
+
+  template <typename T>
+  void append_to_header(std::vector<char>& header, const T& value)
+  {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    header.insert(header.end(), bytes, bytes + sizeof(T));
+  }
+
+  void append_to_header(std::vector<char>& header, const std::string& value)
+  {
+    append_to_header(header, static_cast<int>(value.size()));
+    header.insert(header.end(), value.begin(), value.end());
+  }
+
+  /*!
+   * The header identifies the input files, the number of processes and the discretizations. A
+   * binary mesh file is only read if its header matches the current run exactly.
+   */
+  std::vector<char> create_header(const std::vector<std::filesystem::path>& input_files,
+      const std::vector<Teuchos::RCP<Core::FE::Discretization>>& discretizations, int num_procs)
+  {
+    std::vector<char> header(binary_mesh_magic.begin(), binary_mesh_magic.end());
+    append_to_header(header, binary_mesh_version);
+    append_to_header(header, num_procs);
+    append_to_header(header, static_cast<int>(input_files.size()));
+    for (const auto& input_file : input_files)
+    {
+      const auto input_file_time = std::filesystem::last_write_time(input_file);
+      append_to_header(header, input_file.string());
+      append_to_header(header, static_cast<std::int64_t>(std::filesystem::file_size(input_file)));
+      append_to_header(
+          header, static_cast<std::int64_t>(input_file_time.time_since_epoch().count()));
+    }
+    append_to_header(header, static_cast<int>(discretizations.size()));
+    for (const auto& dis : discretizations) append_to_header(header, dis->name());
+    return header;
+  }
+
+  //! MPI counts are int, so large blocks are written in pieces
+  void write_at(MPI_File file, MPI_Offset offset, const char* data, std::int64_t size)
+  {
+    for (std::int64_t done = 0; done < size;)
+    {
+      const int piece =
+          static_cast<int>(std::min<std::int64_t>(std::numeric_limits<int>::max(), size - done));
+      check_mpi_error(MPI_File_write_at(file, offset + done, data + done, piece, MPI_CHAR,
+                          MPI_STATUS_IGNORE),
+          "MPI_File_write_at");
+      done += piece;
+    }
+  }
+
+  //! MPI counts are int, so large blocks are read in pieces
+  void read_at(MPI_File file, MPI_Offset offset, char* data, std::int64_t size)
+  {
+    for (std::int64_t done = 0; done < size;)
+    {
+      const int piece =
+          static_cast<int>(std::min<std::int64_t>(std::numeric_limits<int>::max(), size - done));
+      check_mpi_error(
+          MPI_File_read_at(file, offset + done, data + done, piece, MPI_CHAR, MPI_STATUS_IGNORE),
+          "MPI_File_read_at");
+      done += piece;
+    }
+  }
+}  // namespace
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::filesystem::path Core::IO::binary_mesh_file_path(
+    const std::filesystem::path& input_file, int num_procs)
+{
+  std::filesystem::path mesh_file = input_file;
+  mesh_file += ".np" + std::to_string(num_procs) + ".mesh";
+  return mesh_file;
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::write_binary_mesh(const std::filesystem::path& mesh_file,
+    const std::vector<std::filesystem::path>& input_files,
+    const std::vector<Teuchos::RCP<Core::FE::Discretization>>& discretizations, int max_node_id,
+    const Epetra_Comm& comm)
+{
+  const MPI_Comm mpi_comm = get_mpi_comm(comm);
+  const int myrank = comm.MyPID();
+  const int num_procs = comm.NumProc();
+  const int num_dis = static_cast<int>(discretizations.size());
+
+  std::vector<char> header;
+  if (myrank == 0) header = create_header(input_files, discretizations, num_procs);
+  int header_size = static_cast<int>(header.size());
+  comm.Broadcast(&header_size, 1, 0);
+
+  // pack the slices of this process
+  std::vector<Teuchos::RCP<std::vector<char>>> node_data;
+  std::vector<Teuchos::RCP<std::vector<char>>> element_data;
+  std::int64_t my_slice_size = 0;
+  for (const auto& dis : discretizations)
+  {
+    node_data.emplace_back(dis->pack_my_nodes());
+    element_data.emplace_back(dis->pack_my_elements());
+    my_slice_size += node_data.back()->size() + element_data.back()->size();
+  }
+
+  // the slices are stored in the order of the processes
+  const MPI_Offset index_begin = header_size + sizeof(int);
+  const MPI_Offset data_begin =
+      index_begin + static_cast<MPI_Offset>(num_dis) * num_procs * sizeof(SliceIndex);
+  std::int64_t my_slice_begin = 0;
+  check_mpi_error(
+      MPI_Exscan(&my_slice_size, &my_slice_begin, 1, MPI_INT64_T, MPI_SUM, mpi_comm), "MPI_Exscan");
+  // the result of MPI_Exscan is undefined on the first process
+  if (myrank == 0) my_slice_begin = 0;
+
+  MPI_File file;
+  check_mpi_error(MPI_File_open(mpi_comm, mesh_file.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                      MPI_INFO_NULL, &file),
+      "MPI_File_open");
+  // discard any old content, in particular a valid header
+  check_mpi_error(MPI_File_set_size(file, 0), "MPI_File_set_size");
+
+  MPI_Offset offset = data_begin + my_slice_begin;
+  for (int d = 0; d < num_dis; ++d)
+  {
+    const SliceIndex index{offset, static_cast<std::int64_t>(node_data[d]->size()),
+        offset + static_cast<std::int64_t>(node_data[d]->size()),
+        static_cast<std::int64_t>(element_data[d]->size())};
+
+    write_at(file, index.node_offset, node_data[d]->data(), index.node_size);
+    write_at(file, index.element_offset, element_data[d]->data(), index.element_size);
+    write_at(file,
+        index_begin + (static_cast<MPI_Offset>(d) * num_procs + myrank) * sizeof(SliceIndex),
+        reinterpret_cast<const char*>(&index), sizeof(SliceIndex));
+
+    offset = index.element_offset + index.element_size;
+  }
+
+  // The header is written after all slices are complete. Thus, an interrupted write never leaves a
+  // file behind that would be considered valid.
+  check_mpi_error(MPI_File_sync(file), "MPI_File_sync");
+  comm.Barrier();
+  check_mpi_error(MPI_File_sync(file), "MPI_File_sync");
+
+  if (myrank == 0)
+  {
+    write_at(file, 0, header.data(), header_size);
+    write_at(file, header_size, reinterpret_cast<const char*>(&max_node_id), sizeof(int));
+  }
+
+  check_mpi_error(MPI_File_close(&file), "MPI_File_close");
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+bool Core::IO::read_binary_mesh(const std::filesystem::path& mesh_file,
+    const std::vector<std::filesystem::path>& input_files,
+    const std::vector<Teuchos::RCP<Core::FE::Discretization>>& discretizations, int& max_node_id,
+    const Epetra_Comm& comm)
+{
+  const MPI_Comm mpi_comm = get_mpi_comm(comm);
+  const int myrank = comm.MyPID();
+  const int num_procs = comm.NumProc();
+  const int num_dis = static_cast<int>(discretizations.size());
+
+  // the first process decides whether the file fits to this run
+  int header_size = 0;
+  int valid = 0;
+  if (myrank == 0 and std::filesystem::exists(mesh_file))
+  {
+    const std::vector<char> header = create_header(input_files, discretizations, num_procs);
+    header_size = static_cast<int>(header.size());
+
+    std::ifstream file(mesh_file, std::ios::binary);
+    std::vector<char> file_header(header.size());
+    if (file.read(file_header.data(), header_size) and file_header == header and
+        file.read(reinterpret_cast<char*>(&max_node_id), sizeof(int)))
+      valid = 1;
+  }
+  comm.Broadcast(&valid, 1, 0);
+  if (!valid) return false;
+
+  comm.Broadcast(&header_size, 1, 0);
+  comm.Broadcast(&max_node_id, 1, 0);
+
+  const MPI_Offset index_begin = header_size + sizeof(int);
+
+  MPI_File file;
+  check_mpi_error(
+      MPI_File_open(mpi_comm, mesh_file.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file),
+      "MPI_File_open");
+
+  for (int d = 0; d < num_dis; ++d)
+  {
+    SliceIndex index{};
+    read_at(file,
+        index_begin + (static_cast<MPI_Offset>(d) * num_procs + myrank) * sizeof(SliceIndex),
+        reinterpret_cast<char*>(&index), sizeof(SliceIndex));
+
+    std::vector<char> node_data(index.node_size);
+    read_at(file, index.node_offset, node_data.data(), index.node_size);
+    std::vector<char> element_data(index.element_size);
+    read_at(file, index.element_offset, element_data.data(), index.element_size);
+
+    discretizations[d]->unpack_my_nodes(node_data);
+    discretizations[d]->unpack_my_elements(element_data);
+  }
+
+  check_mpi_error(MPI_File_close(&file), "MPI_File_close");
+
+  // the slices are already partitioned, only the ghosting has to be restored
+  for (const auto& dis : discretizations) dis->setup_ghosting(false, false, false);
+
+  return true;
+}
+
+FOUR_C_NAMESPACE_CLOSE
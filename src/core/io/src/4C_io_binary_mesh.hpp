@@ -0,0 +1,85 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_IO_BINARY_MESH_HPP
+#define FOUR_C_IO_BINARY_MESH_HPP
+
+#include "4C_config.hpp"
+
+#include <Epetra_Comm.h>
+#include <Teuchos_RCP.hpp>
+
+#include <filesystem>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::FE
+{
+  class Discretization;
+}  // namespace Core::FE
+
+namespace Core::IO
+{
+  /*!
+    \brief Binary mesh files of partitioned discretizations
+
+    A binary mesh file stores the packed row nodes and row elements of a set of discretizations
+    exactly as they are distributed over the processes that wrote the file. The file starts with a
+    header that identifies the input files the mesh was read from and the number of processes,
+    followed by an index with the offset and size of every slice and the slices themselves:
+
+    \verbatim
+    header | max node id | index [discretization][process] | slices [process][discretization]
+    \endverbatim
+
+    Every slice consists of the packed nodes followed by the packed elements. Since the slices are
+    already partitioned, a run with the same number of processes reads its own slice and unpacks it
+    into the discretization without parsing or rebalancing anything. All processes read and write
+    their slices directly via MPI-IO, so the file has to be accessible from all processes.
+   */
+
+  /**
+   * The path of the binary mesh file that belongs to the given @p input_file when it is run on
+   * @p num_procs processes.
+   */
+  std::filesystem::path binary_mesh_file_path(
+      const std::filesystem::path& input_file, int num_procs);
+
+  /**
+   * Write the row nodes and row elements of the filled @p discretizations to @p mesh_file. The
+   * paths, sizes and modification times of the @p input_files, i.e., the top-level input file and
+   * all included files, are recorded in the header to detect outdated binary mesh files. The
+   * global @p max_node_id is stored to restore the node numbering offset when reading.
+   *
+   * @note This is a collective call.
+   */
+  void write_binary_mesh(const std::filesystem::path& mesh_file,
+      const std::vector<std::filesystem::path>& input_files,
+      const std::vector<Teuchos::RCP<Core::FE::Discretization>>& discretizations, int max_node_id,
+      const Epetra_Comm& comm);
+
+  /**
+   * Read the slice of this process from @p mesh_file into the empty @p discretizations and set
+   * up their ghosting. Nothing is read if the file does not exist or was not written for the
+   * current @p input_files, discretizations and number of processes. A binary mesh file is
+   * outdated as soon as any of the @p input_files changed.
+   *
+   * @note This is a collective call.
+   *
+   * @return True if the mesh was read. In this case, @p max_node_id is set to the global maximum
+   * node id that was stored in the file.
+   */
+  bool read_binary_mesh(const std::filesystem::path& mesh_file,
+      const std::vector<std::filesystem::path>& input_files,
+      const std::vector<Teuchos::RCP<Core::FE::Discretization>>& discretizations, int& max_node_id,
+      const Epetra_Comm& comm);
+}  // namespace Core::IO
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
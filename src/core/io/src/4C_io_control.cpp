@@ -185,7 +185,8 @@ Core::IO::OutputControl::OutputControl(const OutputControl& ocontrol, const char
       filesteps_(ocontrol.filesteps_),
       restart_step_(ocontrol.restart_step_),
       myrank_(ocontrol.myrank_),
-      write_binary_output_(ocontrol.write_binary_output_)
+      write_binary_output_(ocontrol.write_binary_output_),
+      write_collective_binary_output_(ocontrol.write_collective_binary_output_)
 {
   // replace file names if provided
   if (new_prefix)
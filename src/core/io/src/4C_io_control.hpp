@@ -120,6 +120,15 @@ namespace Core::IO
 
     bool write_binary_output() const { return write_binary_output_; }
 
+    /// binary result files of all processors are written collectively to one shared file
+    bool write_collective_binary_output() const { return write_collective_binary_output_; }
+
+    /// switch collective binary output on or off (requires HDF5 with MPI support)
+    void set_write_collective_binary_output(bool collective)
+    {
+      write_collective_binary_output_ = collective;
+    }
+
     /// overwrites result files
     void overwrite_result_file(const Core::FE::ShapeFunctionType& spatial_approx);
 
@@ -153,6 +162,7 @@ namespace Core::IO
     const int restart_step_;
     const int myrank_;
     const bool write_binary_output_;
+    bool write_collective_binary_output_ = false;
   };
 
 
@@ -115,6 +115,102 @@ void Core::IO::ElementReader::read_and_distribute()
 }
 
 
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::ElementReader::read_chunks_and_distribute()
+{
+  Core::Elements::ElementDefinition ed;
+  ed.setup_valid_element_lines();
+
+  // every rank reads and creates the elements of its own chunk of the section
+  std::vector<int> eids;
+  for (const auto& element_line :
+      reader_.lines_in_section_chunk(sectionname_, comm_.MyPID(), comm_.NumProc()))
+  {
+    Teuchos::RCP<Core::Elements::Element> ele = read_element(ed, element_line, comm_.MyPID());
+    if (!ele.is_null()) eids.push_back(ele->id());
+  }
+
+  int mynumele = static_cast<int>(eids.size());
+  int numele = 0;
+  comm_.SumAll(&mynumele, &numele, 1);
+
+  if (numele == 0)
+  {
+    // If the element section is empty, we create an empty reader and return
+    coleles_ = roweles_ = colnodes_ = rownodes_ =
+        Teuchos::make_rcp<Epetra_Map>(-1, 0, nullptr, 0, comm_);
+
+    return;
+  }
+
+  // the chunks define the preliminary element distribution
+  roweles_ = Teuchos::make_rcp<Epetra_Map>(-1, mynumele, eids.data(), 0, comm_);
+}
+
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+Teuchos::RCP<Core::Elements::Element> Core::IO::ElementReader::read_element(
+    Core::Elements::ElementDefinition& ed, std::string_view element_line, int owner)
+{
+  std::istringstream t{std::string{element_line}};
+  int elenumber;
+  std::string eletype;
+  std::string distype;
+  // read element id type and distype
+  t >> elenumber >> eletype >> distype;
+  elenumber -= 1;
+
+  // only read registered element types or all elements if nothing is
+  // registered
+  if (elementtypes_.size() != 0 and elementtypes_.count(eletype) == 0) return Teuchos::null;
+
+  // let the factory create a matching empty element
+  Teuchos::RCP<Core::Elements::Element> ele =
+      Core::Communication::factory(eletype, distype, elenumber, owner);
+  if (ele.is_null()) FOUR_C_THROW("element creation failed");
+
+  // For the time being we support old and new input facilities. To
+  // smooth transition.
+
+  Input::LineDefinition* linedef = ed.element_lines(eletype, distype);
+  if (linedef != nullptr)
+  {
+    if (not linedef->read(t))
+    {
+      std::cout << "\n" << elenumber << " " << eletype << " " << distype << " ";
+      linedef->print(std::cout);
+      std::cout << "\n";
+      std::cout << element_line << "\n";
+      FOUR_C_THROW("failed to read element %d %s %s", elenumber, eletype.c_str(), distype.c_str());
+    }
+
+    ele->set_node_ids(distype, linedef->container());
+    ele->read_element(eletype, distype, linedef->container());
+  }
+  else
+  {
+    FOUR_C_THROW(
+        "a matching line definition is needed for %s %s", eletype.c_str(), distype.c_str());
+  }
+
+  // add element to discretization
+  dis_->add_element(ele);
+
+  // get the node ids of this element
+  const int numnode = ele->num_node();
+  const int* nodeids = ele->node_ids();
+
+  // all node gids of this element are inserted into a set of
+  // node ids --- it will be used later during reading of nodes
+  // to add the node to one or more discretisations
+  std::copy(nodeids, nodeids + numnode, std::inserter(nodes_, nodes_.begin()));
+
+  return ele;
+}
+
+
 /*----------------------------------------------------------------------*/
 /*----------------------------------------------------------------------*/
 std::pair<int, std::vector<int>> Core::IO::ElementReader::get_element_size_and_ids() const
@@ -178,72 +274,20 @@ void Core::IO::ElementReader::get_and_distribute_elements(const int nblock, cons
 
     for (const auto& element_line : reader_.lines_in_section(sectionname_))
     {
-      std::istringstream t{std::string{element_line}};
-      int elenumber;
-      std::string eletype;
-      std::string distype;
-      // read element id type and distype
-      t >> elenumber >> eletype >> distype;
-      elenumber -= 1;
-      gidlist.push_back(elenumber);
+      Teuchos::RCP<Core::Elements::Element> ele = read_element(ed, element_line, 0);
+      if (ele.is_null()) continue;
+
+      gidlist.push_back(ele->id());
+      ++bcount;
 
-      // only read registered element types or all elements if nothing is
-      // registered
-      if (elementtypes_.size() == 0 or elementtypes_.count(eletype) > 0)
+      // Distribute the block if it is full. Never distribute the last block here because it
+      // could be longer than expected and is therefore always distributed at the end.
+      if (block != nblock - 1 && bcount == bsize)
       {
-        // let the factory create a matching empty element
-        Teuchos::RCP<Core::Elements::Element> ele =
-            Core::Communication::factory(eletype, distype, elenumber, 0);
-        if (ele.is_null()) FOUR_C_THROW("element creation failed");
-
-        // For the time being we support old and new input facilities. To
-        // smooth transition.
-
-        Input::LineDefinition* linedef = ed.element_lines(eletype, distype);
-        if (linedef != nullptr)
-        {
-          if (not linedef->read(t))
-          {
-            std::cout << "\n" << elenumber << " " << eletype << " " << distype << " ";
-            linedef->print(std::cout);
-            std::cout << "\n";
-            std::cout << element_line << "\n";
-            FOUR_C_THROW(
-                "failed to read element %d %s %s", elenumber, eletype.c_str(), distype.c_str());
-          }
-
-          ele->set_node_ids(distype, linedef->container());
-          ele->read_element(eletype, distype, linedef->container());
-        }
-        else
-        {
-          FOUR_C_THROW(
-              "a matching line definition is needed for %s %s", eletype.c_str(), distype.c_str());
-        }
-
-        // add element to discretization
-        dis_->add_element(ele);
-
-        // get the node ids of this element
-        const int numnode = ele->num_node();
-        const int* nodeids = ele->node_ids();
-
-        // all node gids of this element are inserted into a set of
-        // node ids --- it will be used later during reading of nodes
-        // to add the node to one or more discretisations
-        std::copy(nodeids, nodeids + numnode, std::inserter(nodes_, nodes_.begin()));
-
-        ++bcount;
-
-        // Distribute the block if it is full. Never distribute the last block here because it
-        // could be longer than expected and is therefore always distributed at the end.
-        if (block != nblock - 1 && bcount == bsize)
-        {
-          dis_->proc_zero_distribute_elements_to_all(*roweles_, gidlist);
-          gidlist.clear();
-          bcount = 0;
-          ++block;
-        }
+        dis_->proc_zero_distribute_elements_to_all(*roweles_, gidlist);
+        gidlist.clear();
+        bcount = 0;
+        ++block;
       }
     }
 
@@ -14,6 +14,8 @@
 #include <Teuchos_RCP.hpp>
 
 #include <set>
+#include <string>
+#include <string_view>
 #include <vector>
 
 FOUR_C_NAMESPACE_OPEN
@@ -22,6 +24,11 @@ namespace Core::FE
 {
   class Discretization;
 }  // namespace Core::FE
+namespace Core::Elements
+{
+  class Element;
+  class ElementDefinition;
+}  // namespace Core::Elements
 namespace Core::IO
 {
   class DatFileReader;
@@ -107,6 +114,9 @@ namespace Core::IO
     /// give the discretization this reader fills
     Teuchos::RCP<Core::FE::Discretization> get_dis() const { return dis_; }
 
+    /// give the section this reader reads the elements from
+    const std::string& get_section_name() const { return sectionname_; }
+
     /// Return the list of row elements
     Teuchos::RCP<Epetra_Map> get_row_elements() const { return roweles_; }
 
@@ -136,10 +146,20 @@ namespace Core::IO
     */
     virtual void read_and_distribute();
 
+    /*! Read elements in parallel
+
+    Alternative to read_and_distribute() for input files that are accessible from all processors.
+    Every processor reads and creates the elements of its own contiguous chunk of the element
+    section, see DatFileReader::lines_in_section_chunk(). The chunks define the preliminary
+    element row map, so neither the element ids nor the elements have to be sent around.
+    */
+    void read_chunks_and_distribute();
+
     /*!
     \brief Tell whether the given node belongs to us
 
-    \note This is based on the redundant nodes_ set and only available on processor 0.
+    \note This is based on the nodes_ set. It is only available on processor 0 or, after
+    read_chunks_and_distribute(), contains the nodes of the elements read on this processor.
     */
     bool has_node(const int nodeid) const { return nodes_.find(nodeid) != nodes_.end(); }
 
@@ -150,6 +170,16 @@ namespace Core::IO
     /// Read the file and get element information, distribute them to each processor
     void get_and_distribute_elements(const int nblock, const int bsize);
 
+    /*!
+    \brief Create the element given by an input line and add it to the discretization
+
+    The nodes of the element are remembered in nodes_.
+
+    \return The new element or Teuchos::null if the element type is not read by this reader
+    */
+    Teuchos::RCP<Core::Elements::Element> read_element(
+        Core::Elements::ElementDefinition& ed, std::string_view element_line, int owner);
+
     /// discretization name
     std::string name_;
 
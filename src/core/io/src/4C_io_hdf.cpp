@@ -9,16 +9,83 @@
 
 #include "4C_utils_exceptions.hpp"
 
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <array>
 #include <iostream>
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  /*!
+   * The offsets of the rows written by each processor to the dataset @p path of a collectively
+   * written file. The last entry is the number of rows of the dataset.
+   */
+  std::vector<long long> read_writer_offsets(
+      hid_t file, const std::string& filename, const std::string& path, int num_output_proc)
+  {
+    std::vector<long long> offsets(num_output_proc + 1);
+    const herr_t status =
+        H5LTget_attribute_long_long(file, path.c_str(), "writer_offsets", offsets.data());
+    if (status < 0)
+      FOUR_C_THROW("Failed to read writer offsets of dataset %s in HDF-file %s", path.c_str(),
+          filename.c_str());
+    return offsets;
+  }
+
+  /*!
+   * Read the rows [begin, end) of all @p columns of the dataset @p path of a collectively written
+   * file into @p data. Multiple columns are stored column by column like the values of a multi
+   * vector.
+   */
+  void read_rows(hid_t file, const std::string& filename, const std::string& path, hid_t type,
+      hsize_t begin, hsize_t end, hsize_t columns, void* data)
+  {
+    hid_t dataset = H5Dopen2(file, path.c_str(), H5P_DEFAULT);
+    if (dataset < 0)
+      FOUR_C_THROW("Failed to open dataset %s in HDF-file %s", path.c_str(), filename.c_str());
+    hid_t filespace = H5Dget_space(dataset);
+    if (filespace < 0)
+      FOUR_C_THROW("Failed to get dataspace from dataset %s in HDF-file %s", path.c_str(),
+          filename.c_str());
+
+    const int rank = H5Sget_simple_extent_ndims(filespace);
+    if (rank != 1 and rank != 2) FOUR_C_THROW("HDF5 rank=%d unsupported", rank);
+    std::array<hsize_t, 2> dims = {1, 0};
+    if (H5Sget_simple_extent_dims(filespace, &dims[2 - rank], nullptr) < 0)
+      FOUR_C_THROW("Failed to get size from dataspace in HDF-file %s", filename.c_str());
+    if (dims[0] != columns or end > dims[1])
+      FOUR_C_THROW("Dataset %s in HDF-file %s does not match the requested rows", path.c_str(),
+          filename.c_str());
+
+    const std::array<hsize_t, 2> start = {0, begin};
+    const std::array<hsize_t, 2> count = {columns, end - begin};
+    const hsize_t size = count[0] * count[1];
+    if (size != 0)
+    {
+      hid_t memspace = H5Screate_simple(1, &size, nullptr);
+      if (memspace < 0) FOUR_C_THROW("Failed to create dataspace");
+      if (H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start[2 - rank], nullptr,
+              &count[2 - rank], nullptr) < 0)
+        FOUR_C_THROW("Failed to select hyperslab of dataset %s", path.c_str());
+      if (H5Dread(dataset, type, memspace, filespace, H5P_DEFAULT, data) < 0)
+        FOUR_C_THROW("Failed to read data from dataset %s in HDF-file %s", path.c_str(),
+            filename.c_str());
+      if (H5Sclose(memspace) < 0) FOUR_C_THROW("Failed to close dataspace");
+    }
+
+    if (H5Sclose(filespace) < 0 or H5Dclose(dataset) < 0)
+      FOUR_C_THROW("Failed to close dataset %s in HDF-file %s", path.c_str(), filename.c_str());
+  }
+}  // namespace
+
 
 /*----------------------------------------------------------------------*
  * The Constructor of the HDFReader (num_proc defaults to 1)
  *----------------------------------------------------------------------*/
 Core::IO::HDFReader::HDFReader(std::string dir)
-    : filenames_(0), files_(0), input_dir_(dir), num_output_proc_(0)
+    : filenames_(0), files_(0), input_dir_(dir), num_output_proc_(0), collective_(false)
 {
   // inhibit delayed closure, throws error if file contents still in use
   h5_plist_ = H5Pcreate(H5P_FILE_ACCESS);
@@ -40,15 +107,25 @@ Core::IO::HDFReader::~HDFReader()
  * With num_output_proc_ == 1 this function opens the result data file
  * with name basename. When num_output_proc_ > 1 it opens the result
  * files of all processors, by appending .p<proc_num> to the basename.
+ * Collectively written results are found in the one file basename.
  *----------------------------------------------------------------------*/
 void Core::IO::HDFReader::open(
-    std::string basename, int num_output_procs, int new_proc_num, int my_id)
+    std::string basename, int num_output_procs, int new_proc_num, int my_id, bool collective)
 {
   int start;
   int end;
   num_output_proc_ = num_output_procs;
   calculate_range(new_proc_num, my_id, start, end);
   close();
+  collective_ = collective;
+  if (collective_)
+  {
+    // every processor reads its part of the one shared file
+    filenames_.push_back(input_dir_ + basename);
+    files_.push_back(H5Fopen(filenames_[0].c_str(), H5F_ACC_RDONLY, h5_plist_));
+    if (files_[0] < 0) FOUR_C_THROW("Failed to open HDF-file %s", filenames_[0].c_str());
+    return;
+  }
   for (int i = 0; i < num_output_proc_; ++i)
   {
     std::ostringstream buf;
@@ -177,6 +254,17 @@ Teuchos::RCP<std::vector<char>> Core::IO::HDFReader::read_char_data(
     std::string path, int start, int end) const
 {
   if (end == -1) end = num_output_proc_;
+  if (collective_)
+  {
+    const std::vector<long long> offsets =
+        read_writer_offsets(files_[0], filenames_[0], path, num_output_proc_);
+    Teuchos::RCP<std::vector<char>> data =
+        Teuchos::make_rcp<std::vector<char>>(offsets[end] - offsets[start]);
+    read_rows(files_[0], filenames_[0], path, H5T_NATIVE_CHAR, offsets[start], offsets[end], 1,
+        data->data());
+    return data;
+  }
+
   hsize_t offset = 0;
   Teuchos::RCP<std::vector<char>> data = Teuchos::make_rcp<std::vector<char>>();
   for (int i = start; i < end; ++i)
@@ -236,6 +324,17 @@ Teuchos::RCP<std::vector<int>> Core::IO::HDFReader::read_int_data(
     std::string path, int start, int end) const
 {
   if (end == -1) end = num_output_proc_;
+  if (collective_)
+  {
+    const std::vector<long long> offsets =
+        read_writer_offsets(files_[0], filenames_[0], path, num_output_proc_);
+    Teuchos::RCP<std::vector<int>> data =
+        Teuchos::make_rcp<std::vector<int>>(offsets[end] - offsets[start]);
+    read_rows(files_[0], filenames_[0], path, H5T_NATIVE_INT, offsets[start], offsets[end], 1,
+        data->data());
+    return data;
+  }
+
   int offset = 0;
   Teuchos::RCP<std::vector<int>> data = Teuchos::make_rcp<std::vector<int>>();
   for (int i = start; i < end; ++i)
@@ -292,6 +391,18 @@ Teuchos::RCP<std::vector<double>> Core::IO::HDFReader::read_double_data(
     std::string path, int start, int end, std::vector<int>& lengths) const
 {
   if (end == -1) end = num_output_proc_;
+  if (collective_)
+  {
+    const std::vector<long long> offsets =
+        read_writer_offsets(files_[0], filenames_[0], path, num_output_proc_);
+    Teuchos::RCP<std::vector<double>> data =
+        Teuchos::make_rcp<std::vector<double>>(offsets[end] - offsets[start]);
+    read_rows(files_[0], filenames_[0], path, H5T_NATIVE_DOUBLE, offsets[start], offsets[end], 1,
+        data->data());
+    for (int i = start; i < end; ++i) lengths.push_back(offsets[i + 1] - offsets[i]);
+    return data;
+  }
+
   int offset = 0;
   Teuchos::RCP<std::vector<double>> data = Teuchos::make_rcp<std::vector<double>>();
   for (int i = start; i < end; ++i)
@@ -347,10 +458,33 @@ Teuchos::RCP<std::vector<double>> Core::IO::HDFReader::read_double_data(
 Teuchos::RCP<Core::LinAlg::MultiVector<double>> Core::IO::HDFReader::read_result_data(
     std::string id_path, std::string value_path, int columns, const Epetra_Comm& Comm) const
 {
+  TEUCHOS_FUNC_TIME_MONITOR("Core::IO::HDFReader::read_result_data");
+
   int new_proc_num = Comm.NumProc();
   int my_id = Comm.MyPID();
 
   if (files_.size() == 0) FOUR_C_THROW("Tried to read data without opening any file");
+
+  if (collective_)
+  {
+    // Every processor reads an equal block of rows of the shared file, independent of the number
+    // of processors that wrote it. The vector is redistributed by the caller.
+    const long long num_rows =
+        read_writer_offsets(files_[0], filenames_[0], id_path, num_output_proc_).back();
+    const hsize_t begin = num_rows * my_id / new_proc_num;
+    const hsize_t end = num_rows * (my_id + 1) / new_proc_num;
+
+    std::vector<int> ids(end - begin);
+    read_rows(files_[0], filenames_[0], id_path, H5T_NATIVE_INT, begin, end, 1, ids.data());
+    Epetra_Map map(-1, static_cast<int>(ids.size()), ids.data(), 0, Comm);
+
+    Teuchos::RCP<Core::LinAlg::MultiVector<double>> res =
+        Teuchos::make_rcp<Core::LinAlg::MultiVector<double>>(map, columns, false);
+    read_rows(files_[0], filenames_[0], value_path, H5T_NATIVE_DOUBLE, begin, end, columns,
+        res->Values());
+    return res;
+  }
+
   int start, end;
   calculate_range(new_proc_num, my_id, start, end);
 
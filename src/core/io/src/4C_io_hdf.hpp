@@ -62,8 +62,13 @@ namespace Core::IO
       file with name basename. If num_output_procs>1 it opens the result
       files of all processors, by appending .p<proc_num> to the
       basename.
+
+      If the files were written collectively, all processors wrote to the one
+      file basename. Each dataset stores the rows of the writing processors one
+      after another and is read partially by each processor.
     */
-    void open(std::string basename, int num_output_procs, int new_proc_num, int my_id);
+    void open(std::string basename, int num_output_procs, int new_proc_num, int my_id,
+        bool collective = false);
     //!
     void close();
 
@@ -202,6 +207,9 @@ namespace Core::IO
     //! number of processors that wrote this set of files
     int num_output_proc_;
 
+    //! all processors wrote collectively to one shared file
+    bool collective_;
+
     //! file access property list for HDF5 files
     hid_t h5_plist_;
   };
@@ -242,6 +242,73 @@ namespace Core::IO
   }
 
 
+  /*----------------------------------------------------------------------*/
+  /*----------------------------------------------------------------------*/
+  std::vector<std::string> DatFileReader::lines_in_section_chunk(
+      const std::string& section_name, int chunk, int num_chunks)
+  {
+    if (num_chunks < 1 or chunk < 0 or chunk >= num_chunks)
+      FOUR_C_THROW("Invalid chunk %d of %d chunks.", chunk, num_chunks);
+
+    record_section_used(section_name);
+
+    const auto has_content = [](const std::string& line)
+    { return !Core::Utils::strip_comment(line).empty(); };
+
+    std::vector<std::string> lines;
+
+    if (excludepositions_.count(section_name) > 0)
+    {
+      const auto& [path, start_pos, end_pos, length] = excludepositions_.at(section_name);
+      if (length == 0) return lines;
+
+      const std::streamoff begin = start_pos;
+      const std::streamoff size = std::streamoff(end_pos) - begin;
+      const std::streamoff chunk_begin = begin + size * chunk / num_chunks;
+      const std::streamoff chunk_end = begin + size * (chunk + 1) / num_chunks;
+      if (chunk_begin == chunk_end) return lines;
+
+      std::ifstream file(path);
+      if (!file) FOUR_C_THROW("Unable to open file '%s'.", path.c_str());
+
+      // Skip the line that started in the previous chunk. Seeking one character back handles the
+      // case that the chunk begins exactly at the start of a line.
+      std::string line;
+      if (chunk_begin == begin)
+        file.seekg(begin);
+      else
+      {
+        file.seekg(chunk_begin - 1);
+        std::getline(file, line);
+      }
+
+      for (std::streamoff line_begin = file.tellg();
+           line_begin < chunk_end and std::getline(file, line); line_begin = file.tellg())
+      {
+        if (has_content(line)) lines.emplace_back(std::move(line));
+        // tellg() fails on a last line without newline
+        if (file.eof()) break;
+      }
+
+      return lines;
+    }
+
+    const auto entry_it = positions_.find(section_name);
+    if (entry_it == positions_.end()) return lines;
+
+    const auto [start_line, end_line] = entry_it->second;
+    const std::size_t num_lines = end_line - start_line;
+    for (std::size_t i = start_line + num_lines * chunk / num_chunks;
+         i < start_line + num_lines * (chunk + 1) / num_chunks; ++i)
+    {
+      std::string line(lines_[i]);
+      if (has_content(line)) lines.emplace_back(std::move(line));
+    }
+
+    return lines;
+  }
+
+
   /*----------------------------------------------------------------------*/
   /*----------------------------------------------------------------------*/
   bool read_parameters_in_section(
@@ -862,12 +929,14 @@ namespace Core::IO
         unsigned current_section_linecount = 0;
         SectionType current_section_type = SectionType::normal;
         std::string line;
+        std::ifstream::pos_type current_line_pos = file.tellg();
 
         const auto finalize_section_read = [&](int number_of_lines)
         {
           if (current_section_type == SectionType::on_the_fly)
           {
             exclude_information[current_excluded_section_name].length = number_of_lines;
+            exclude_information[current_excluded_section_name].end = current_line_pos;
           }
 
           // Reset tracking variables
@@ -881,7 +950,7 @@ namespace Core::IO
             // Start a new excluded section. This starts at the next line. The correct length
             // will be set when the section ends.
             exclude_information.emplace(
-                maybe_excluded_section, SectionPosition{file_path, file.tellg(), 0});
+                maybe_excluded_section, SectionPosition{file_path, file.tellg(), {}, 0});
             current_excluded_section_name = maybe_excluded_section;
             current_section_type = SectionType::on_the_fly;
           }
@@ -897,8 +966,9 @@ namespace Core::IO
 
         // Loop over all input lines. This reads the actual file contents and determines whether a
         // line is to be read immediately or should be excluded because it is in one of the excluded
-        // sections.
-        while (getline(file, line))
+        // sections. The start position of every line is tracked to know where excluded sections
+        // end.
+        for (; getline(file, line); current_line_pos = file.tellg())
         {
           ++current_section_linecount;
 
@@ -963,7 +1033,8 @@ namespace Core::IO
             }
           }
         }
-        // Finalize the last section
+        // Finalize the last section, which ends with the file
+        current_line_pos = static_cast<std::streamoff>(std::filesystem::file_size(file_path));
         finalize_section_read(current_section_linecount);
 
         return included_files;
@@ -1001,6 +1072,8 @@ namespace Core::IO
         std::cout << "Included file: " << file << std::endl;
       }
 
+      input_files_.assign(included_files.begin(), included_files.end());
+
       int arraysize = std::accumulate(content.begin(), content.end(), 0,
           [](int sum, const std::string& line)
           {
@@ -1083,6 +1156,11 @@ namespace Core::IO
 
       // All-gather does the correct thing becuase the maps are empty on all ranks > 0
       excludepositions_ = Core::Communication::all_gather(excludepositions_, comm_);
+
+      // The same holds for the input files
+      std::vector<std::string> input_files(input_files_.begin(), input_files_.end());
+      input_files = Core::Communication::all_gather(input_files, comm_);
+      input_files_.assign(input_files.begin(), input_files.end());
     }
 
     // Now finally find the section names. We have to do this on all
@@ -1203,7 +1281,11 @@ namespace Core::IO
   void DatFileReader::SectionPosition::pack(Communication::PackBuffer& data) const
   {
     Core::Communication::add_to_pack(data, file.string());
-    Core::Communication::add_to_pack(data, static_cast<unsigned>(pos));
+    // file offsets are packed with 64 bits to support files larger than 4GB
+    const std::streamoff pos_offset = pos;
+    Core::Communication::add_to_pack(data, &pos_offset, sizeof(std::streamoff));
+    const std::streamoff end_offset = end;
+    Core::Communication::add_to_pack(data, &end_offset, sizeof(std::streamoff));
     Core::Communication::add_to_pack(data, length);
   }
 
@@ -1212,9 +1294,12 @@ namespace Core::IO
     std::string file_str;
     Core::Communication::extract_from_pack(buffer, file_str);
     file = file_str;
-    unsigned pos_extract;
+    std::streamoff pos_extract;
     Core::Communication::extract_from_pack(buffer, pos_extract);
     pos = pos_extract;
+    std::streamoff end_extract;
+    Core::Communication::extract_from_pack(buffer, end_extract);
+    end = end_extract;
     Core::Communication::extract_from_pack(buffer, length);
   }
 }  // namespace Core::IO
@@ -29,6 +29,7 @@
 #include <set>
 #include <string>
 #include <variant>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -137,7 +138,9 @@ namespace Core::IO
     the meshes and so on and needs to be available on all
     processors. However, we cannot rely on a shared file system, so only
     on process (the first one) can do the actual reading. All others
-    need to get the data via MPI communication.
+    need to get the data via MPI communication. If a shared file system is
+    available, the large mesh sections may additionally be read in chunks by
+    all processors, see lines_in_section_chunk().
 
     This class manages the reading and broadcasting of the input
     file. To do so processor 0 reads the input file line by line and
@@ -167,6 +170,14 @@ namespace Core::IO
     /// return my output flag
     [[nodiscard]] int my_output_flag() const;
 
+    /**
+     * The top-level input file followed by all files it includes directly or indirectly.
+     */
+    [[nodiscard]] const std::vector<std::filesystem::path>& input_files() const
+    {
+      return input_files_;
+    }
+
     /**
      * Get a a range of lines inside a section that have actual content, i.e., they contain
      * something other than whitespace or comments. Any line returned will have comment stripped
@@ -186,12 +197,34 @@ namespace Core::IO
      */
     auto lines_in_section(const std::string& section_name);
 
+    /**
+     * Get the lines with actual content inside the @p chunk -th of @p num_chunks contiguous chunks
+     * of a section. The chunks of all ranks together contain every line of the section exactly
+     * once. Sections that are read on-the-fly are split by their byte range in the file and only
+     * the lines of the requested chunk are read, so the caller needs access to the input file.
+     * This allows every rank to read a part of a large section (e.g. nodes or elements) directly
+     * from a shared file system instead of having rank 0 read and distribute all of it.
+     *
+     * @note A line belongs to the chunk that contains its first character.
+     */
+    std::vector<std::string> lines_in_section_chunk(
+        const std::string& section_name, int chunk, int num_chunks);
+
     /**
      * Returns whether a section with the given name exists in the input file and contains any
      * content.
      */
     [[nodiscard]] bool has_section(const std::string& section_name) const;
 
+    /**
+     * Mark the section @p section_name as used without reading it. This is meant for sections
+     * whose content is obtained elsewhere, so that print_unknown_sections() does not report them.
+     */
+    void mark_section_used(const std::string& section_name)
+    {
+      record_section_used(section_name);
+    }
+
     /**
      * Access MPI communicator associated with this object.
      */
@@ -221,6 +254,8 @@ namespace Core::IO
     {
       std::filesystem::path file;
       std::ifstream::pos_type pos;
+      //! position of the first character after the section
+      std::ifstream::pos_type end;
       unsigned int length;
 
       void pack(Core::Communication::PackBuffer& data) const;
@@ -231,6 +266,9 @@ namespace Core::IO
     /// The top-level file that is first read by this object.
     std::filesystem::path top_level_file_;
 
+    /// The top-level file and all included files.
+    std::vector<std::filesystem::path> input_files_;
+
     /// The communicator associated with this object.
     const Epetra_Comm& comm_;
 
@@ -307,7 +345,7 @@ namespace Core::IO
 
     if (excludepositions_.count(section_name) > 0)
     {
-      const auto [path, start_pos, length] = excludepositions_.at(section_name);
+      const auto& [path, start_pos, end_pos, length] = excludepositions_.at(section_name);
 
       auto file = std::make_shared<std::ifstream>(path);
       file->seekg(start_pos);
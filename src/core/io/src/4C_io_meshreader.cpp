@@ -8,6 +8,7 @@
 #include "4C_io_meshreader.hpp"
 
 #include "4C_fem_discretization.hpp"
+#include "4C_io_binary_mesh.hpp"
 #include "4C_io_domainreader.hpp"
 #include "4C_io_elementreader.hpp"
 #include "4C_io_inputreader.hpp"
@@ -19,6 +20,7 @@
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 
@@ -80,8 +82,16 @@ void Core::IO::MeshReader::read_and_partition()
 
   graph_.resize(element_readers_.size());
 
-  read_mesh_from_dat_file(max_node_id);
-  rebalance();
+  const bool use_binary_mesh =
+      parameters_.mesh_paritioning_parameters.get<bool>("BINARY_MESH", false) and
+      !element_readers_.empty();
+
+  if (!use_binary_mesh or !read_mesh_from_binary_file(max_node_id))
+  {
+    read_mesh_from_dat_file(max_node_id);
+    rebalance();
+    if (use_binary_mesh) write_mesh_to_binary_file(max_node_id);
+  }
   create_inline_mesh(max_node_id);
 
   // last check if there are enough nodes
@@ -101,11 +111,73 @@ void Core::IO::MeshReader::read_mesh_from_dat_file(int& max_node_id)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Core::IO::MeshReader::read_mesh_from_dat_file");
 
+  // read mesh sections in chunks on all processors if the input file is accessible from all of them
+  const bool read_in_chunks =
+      parameters_.mesh_paritioning_parameters.get<bool>("PARALLEL_READ", false);
+
   // read element information
-  for (auto& element_reader : element_readers_) element_reader.read_and_distribute();
+  for (auto& element_reader : element_readers_)
+  {
+    if (read_in_chunks)
+      element_reader.read_chunks_and_distribute();
+    else
+      element_reader.read_and_distribute();
+  }
 
   // read nodes based on the element information
-  read_nodes(reader_, node_section_name_, element_readers_, max_node_id);
+  read_nodes(reader_, node_section_name_, element_readers_, max_node_id, read_in_chunks);
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+bool Core::IO::MeshReader::read_mesh_from_binary_file(int& max_node_id)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Core::IO::MeshReader::read_mesh_from_binary_file");
+
+  const std::string input_file = reader_.my_inputfile_name();
+  if (!read_binary_mesh(binary_mesh_file_path(input_file, comm_.NumProc()), reader_.input_files(),
+          get_discretizations(), max_node_id, comm_))
+    return false;
+
+  // the mesh sections of the input file are covered by the binary mesh file
+  reader_.mark_section_used(node_section_name_);
+  for (const auto& element_reader : element_readers_)
+    reader_.mark_section_used(element_reader.get_section_name());
+
+  for (const auto& discret : get_discretizations())
+    Core::Rebalance::Utils::print_parallel_distribution(*discret);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+void Core::IO::MeshReader::write_mesh_to_binary_file(int max_node_id) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Core::IO::MeshReader::write_mesh_to_binary_file");
+
+  int global_max_node_id = 0;
+  comm_.MaxAll(&max_node_id, &global_max_node_id, 1);
+
+  const std::string input_file = reader_.my_inputfile_name();
+  write_binary_mesh(binary_mesh_file_path(input_file, comm_.NumProc()), reader_.input_files(),
+      get_discretizations(), global_max_node_id, comm_);
+}
+
+/*----------------------------------------------------------------------*/
+/*----------------------------------------------------------------------*/
+std::vector<Teuchos::RCP<Core::FE::Discretization>> Core::IO::MeshReader::get_discretizations()
+    const
+{
+  // several element readers may fill the same discretization
+  std::vector<Teuchos::RCP<Core::FE::Discretization>> discretizations;
+  for (const auto& element_reader : element_readers_)
+  {
+    const auto dis = element_reader.get_dis();
+    if (std::find(discretizations.begin(), discretizations.end(), dis) == discretizations.end())
+      discretizations.emplace_back(dis);
+  }
+  return discretizations;
 }
 
 /*----------------------------------------------------------------------*/
@@ -117,9 +189,10 @@ void Core::IO::MeshReader::rebalance()
   // do the real partitioning and distribute maps
   for (size_t i = 0; i < element_readers_.size(); i++)
   {
-    // global node ids --- this will be a fully redundant vector!
-    int numnodes = static_cast<int>(element_readers_[i].get_unique_nodes().size());
-    comm_.Broadcast(&numnodes, 1, 0);
+    // the element nodes are known on processor 0 or, if read in chunks, spread over all processors
+    int mynumnodes = static_cast<int>(element_readers_[i].get_unique_nodes().size());
+    int numnodes = 0;
+    comm_.MaxAll(&mynumnodes, &numnodes, 1);
 
     const auto discret = element_readers_[i].get_dis();
 
@@ -103,6 +103,15 @@ namespace Core::IO
       Actually most of the work gets done by the ElementReader. The
       reading of both elements and nodes happens in blocks on processor
       0. After each block read the discretizations are redistributed.
+      If the MESH PARTITIONING parameter PARALLEL_READ is set, every
+      processor reads its own chunk of the element and node sections
+      instead.
+
+      If the MESH PARTITIONING parameter BINARY_MESH is set, the
+      partitioned discretizations are written to a binary mesh file next
+      to the input file. Subsequent runs of the same input file on the
+      same number of processors read their part of the mesh from this
+      file and skip reading and rebalancing the mesh sections.
 
      */
     void read_and_partition();
@@ -117,6 +126,25 @@ namespace Core::IO
     */
     void read_mesh_from_dat_file(int& max_node_id);
 
+    /*!
+    \brief Read the partitioned discretizations from the binary mesh file of the input file
+
+    \param[out] max_node_id Maximum node id of all discretizations stored in the file
+
+    \return False if there is no valid binary mesh file for this input file and number of processes
+    */
+    bool read_mesh_from_binary_file(int& max_node_id);
+
+    /*!
+    \brief Write the partitioned discretizations to the binary mesh file of the input file
+
+    \param[in] max_node_id Maximum node id of the discretizations on this process
+    */
+    void write_mesh_to_binary_file(int max_node_id) const;
+
+    //! all distinct discretizations filled by the element readers
+    std::vector<Teuchos::RCP<Core::FE::Discretization>> get_discretizations() const;
+
     /*!
     \brief Rebalance discretizations built in read_mesh_from_dat_file()
     */
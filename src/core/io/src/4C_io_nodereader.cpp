@@ -13,13 +13,22 @@
 #include "4C_fem_general_immersed_node.hpp"
 #include "4C_fem_nurbs_discretization_control_point.hpp"
 #include "4C_io_inputreader.hpp"
+#include "4C_linalg_vector.hpp"
 
+#include <Epetra_Export.h>
+
+#include <functional>
 #include <istream>
+#include <set>
+#include <string_view>
 
 FOUR_C_NAMESPACE_OPEN
 
 namespace
 {
+  using FindDisNode =
+      std::function<std::vector<Teuchos::RCP<Core::FE::Discretization>>(int global_node_id)>;
+
   std::vector<Teuchos::RCP<Core::FE::Discretization>> find_dis_node(
       const std::vector<Core::IO::ElementReader>& element_readers, int global_node_id)
   {
@@ -31,21 +40,16 @@ namespace
     return list_of_discretizations;
   }
 
-}  // namespace
-
-
-void Core::IO::read_nodes(Core::IO::DatFileReader& reader, const std::string& node_section_name,
-    std::vector<ElementReader>& element_readers, int& max_node_id)
-{
-  const int myrank = reader.get_comm().MyPID();
-  if (myrank > 0) return;
-
-  std::string tmp;
-  std::string tmp2;
-
-  int line_count = 0;
-  for (const auto& node_line : reader.lines_in_section(node_section_name))
+  /**
+   * Create the node given in @p node_line and add it to all discretizations returned by
+   * @p find_dis. The @p line_count is the index of the line in the whole node section.
+   */
+  void read_node(std::string_view node_line, int line_count, const FindDisNode& find_dis,
+      int myrank, int& max_node_id)
   {
+    std::string tmp;
+    std::string tmp2;
+
     std::istringstream linestream{std::string{node_line}};
     linestream >> tmp;
 
@@ -58,8 +62,7 @@ void Core::IO::read_nodes(Core::IO::DatFileReader& reader, const std::string& no
 
       nodeid--;
       max_node_id = std::max(max_node_id, nodeid) + 1;
-      std::vector<Teuchos::RCP<Core::FE::Discretization>> dis =
-          find_dis_node(element_readers, nodeid);
+      std::vector<Teuchos::RCP<Core::FE::Discretization>> dis = find_dis(nodeid);
 
       for (const auto& di : dis)
       {
@@ -79,8 +82,7 @@ void Core::IO::read_nodes(Core::IO::DatFileReader& reader, const std::string& no
 
       nodeid--;
       max_node_id = std::max(max_node_id, nodeid) + 1;
-      std::vector<Teuchos::RCP<Core::FE::Discretization>> diss =
-          find_dis_node(element_readers, nodeid);
+      std::vector<Teuchos::RCP<Core::FE::Discretization>> diss = find_dis(nodeid);
 
       for (const auto& dis : diss)
       {
@@ -105,8 +107,7 @@ void Core::IO::read_nodes(Core::IO::DatFileReader& reader, const std::string& no
         FOUR_C_THROW(
             "Reading of control points %d failed: They must be numbered consecutive!!", cpid);
       if (tmp != "COORD") FOUR_C_THROW("failed to read control point %d", cpid);
-      std::vector<Teuchos::RCP<Core::FE::Discretization>> diss =
-          find_dis_node(element_readers, cpid);
+      std::vector<Teuchos::RCP<Core::FE::Discretization>> diss = find_dis(cpid);
 
       for (auto& dis : diss)
       {
@@ -223,8 +224,7 @@ void Core::IO::read_nodes(Core::IO::DatFileReader& reader, const std::string& no
       }
 
       // add fiber information to node
-      std::vector<Teuchos::RCP<Core::FE::Discretization>> discretizations =
-          find_dis_node(element_readers, nodeid);
+      std::vector<Teuchos::RCP<Core::FE::Discretization>> discretizations = find_dis(nodeid);
       for (auto& dis : discretizations)
       {
         auto node = Teuchos::make_rcp<Core::Nodes::FiberNode>(
@@ -234,7 +234,92 @@ void Core::IO::read_nodes(Core::IO::DatFileReader& reader, const std::string& no
     }
     else
       FOUR_C_THROW("unexpected word '%s'", tmp.c_str());
+  }
+
+}  // namespace
+
+
+void Core::IO::read_nodes(Core::IO::DatFileReader& reader, const std::string& node_section_name,
+    std::vector<ElementReader>& element_readers, int& max_node_id, bool read_in_chunks)
+{
+  const Epetra_Comm& comm = reader.get_comm();
+  const int myrank = comm.MyPID();
+
+  if (!read_in_chunks)
+  {
+    if (myrank > 0) return;
+
+    const FindDisNode find_dis = [&](int global_node_id)
+    { return find_dis_node(element_readers, global_node_id); };
+
+    int line_count = 0;
+    for (const auto& node_line : reader.lines_in_section(node_section_name))
+    {
+      read_node(node_line, line_count, find_dis, myrank, max_node_id);
+      ++line_count;
+    }
+
+    return;
+  }
+
+  // every rank reads its own chunk of the node section
+  const std::vector<std::string> node_lines =
+      reader.lines_in_section_chunk(node_section_name, myrank, comm.NumProc());
+
+  std::vector<int> chunk_node_ids;
+  chunk_node_ids.reserve(node_lines.size());
+  for (const auto& node_line : node_lines)
+  {
+    std::istringstream linestream{node_line};
+    std::string type;
+    int nodeid;
+    linestream >> type >> nodeid;
+    chunk_node_ids.push_back(nodeid - 1);
+  }
+  const Epetra_Map chunk_node_map(
+      -1, static_cast<int>(chunk_node_ids.size()), chunk_node_ids.data(), 0, comm);
+
+  // The element nodes of a discretization are spread over all ranks. Export them to the ranks
+  // that read the respective node lines to know which discretizations a node belongs to.
+  std::vector<Core::LinAlg::Vector<int>> node_in_dis;
+  node_in_dis.reserve(element_readers.size());
+  for (const auto& element_reader : element_readers)
+  {
+    const std::set<int> element_nodes = element_reader.get_unique_nodes();
+    const std::vector<int> element_node_ids(element_nodes.begin(), element_nodes.end());
+    const Epetra_Map element_node_map(
+        -1, static_cast<int>(element_node_ids.size()), element_node_ids.data(), 0, comm);
+
+    Core::LinAlg::Vector<int> element_node_flags(element_node_map, false);
+    element_node_flags.PutValue(1);
 
+    Core::LinAlg::Vector<int>& chunk_node_flags = node_in_dis.emplace_back(chunk_node_map, true);
+    const Epetra_Export exporter(element_node_map, chunk_node_map);
+    const int err = chunk_node_flags.Export(element_node_flags, exporter, Add);
+    if (err) FOUR_C_THROW("Export of node flags returned err=%d", err);
+  }
+
+  const FindDisNode find_dis = [&](int global_node_id)
+  {
+    const int lid = chunk_node_map.LID(global_node_id);
+
+    std::vector<Teuchos::RCP<Core::FE::Discretization>> list_of_discretizations;
+    for (std::size_t i = 0; i < element_readers.size(); ++i)
+      if (node_in_dis[i][lid] > 0)
+        list_of_discretizations.emplace_back(element_readers[i].get_dis());
+
+    return list_of_discretizations;
+  };
+
+  // offset of the line count to the begin of the node section
+  int my_line_count = static_cast<int>(node_lines.size());
+  int line_count = 0;
+  comm.ScanSum(&my_line_count, &line_count, 1);
+  line_count -= my_line_count;
+
+  for (const auto& node_line : node_lines)
+  {
+    read_node(node_line, line_count, find_dis, myrank, max_node_id);
     ++line_count;
   }
 }
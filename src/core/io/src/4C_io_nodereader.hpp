@@ -23,9 +23,13 @@ namespace Core::IO
    * Read all nodes that are defined in section @p node_section_name in the @p reader.
    * Nodes are added to the discretization objects associated with the @p element_readers.
    * The @p max_node_id is tracked for consistency checks.
+   *
+   * If @p read_in_chunks is false, all nodes are read on processor 0. Otherwise, every processor
+   * reads its own chunk of the node section and the @p element_readers must have been filled by
+   * ElementReader::read_chunks_and_distribute().
    */
   void read_nodes(Core::IO::DatFileReader& reader, const std::string& node_section_name,
-      std::vector<ElementReader>& element_readers, int& max_node_id);
+      std::vector<ElementReader>& element_readers, int& max_node_id, bool read_in_chunks);
 
 }  // namespace Core::IO
 
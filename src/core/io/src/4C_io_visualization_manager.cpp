@@ -11,10 +11,20 @@
 #include "4C_io_visualization_parameters.hpp"
 #include "4C_io_visualization_writer_factory.hpp"
 
+#include <exception>
+#include <iostream>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! The writers are not thread safe, so writes of different managers must not overlap
+  std::mutex visualization_write_mutex;
+}  // namespace
+
 /**
  *
  */
@@ -26,6 +36,25 @@ Core::IO::VisualizationManager::VisualizationManager(Core::IO::VisualizationPara
 {
 }
 
+/**
+ *
+ */
+Core::IO::VisualizationManager::~VisualizationManager()
+{
+  // the writers must stay alive until the background write is finished. The destructor must not
+  // throw, so an error of the last write is reported here instead of being dropped.
+  try
+  {
+    wait_for_pending_write();
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Asynchronous visualization output of \"" << base_output_name_
+              << "\" failed:\n"
+              << e.what() << std::endl;
+  }
+}
+
 /**
  *
  */
@@ -100,12 +129,48 @@ void Core::IO::VisualizationManager::clear_data()
 void Core::IO::VisualizationManager::write_to_disk(
     const double visualziation_time, const int visualization_step)
 {
+  if (!parameters_.write_asynchronously_)
+  {
+    std::lock_guard<std::mutex> lock(visualization_write_mutex);
+    for (auto& [key, visualization_pair] : visualization_map_)
+    {
+      visualization_pair.first.consistency_check_and_complete_data();
+      visualization_pair.second->write_visualization_data_to_disk(
+          visualization_pair.first, visualziation_time, visualization_step);
+    }
+    return;
+  }
+
+  // Only one write per manager is in flight. The data is copied, such that the caller can clear
+  // and refill the visualization data while the copy is written.
+  wait_for_pending_write();
+
+  std::vector<std::pair<VisualizationData, VisualizationWriterBase*>> snapshots;
+  snapshots.reserve(visualization_map_.size());
   for (auto& [key, visualization_pair] : visualization_map_)
   {
     visualization_pair.first.consistency_check_and_complete_data();
-    visualization_pair.second->write_visualization_data_to_disk(
-        visualization_pair.first, visualziation_time, visualization_step);
+    snapshots.emplace_back(visualization_pair.first, visualization_pair.second.get());
   }
+
+  pending_write_ = std::async(std::launch::async,
+      [snapshots = std::move(snapshots), visualziation_time, visualization_step]()
+      {
+        std::lock_guard<std::mutex> lock(visualization_write_mutex);
+        for (const auto& [visualization_data, writer] : snapshots)
+        {
+          writer->write_visualization_data_to_disk(
+              visualization_data, visualziation_time, visualization_step);
+        }
+      });
+}
+
+/**
+ *
+ */
+void Core::IO::VisualizationManager::wait_for_pending_write()
+{
+  if (pending_write_.valid()) pending_write_.get();
 }
 
 /**
@@ -16,6 +16,7 @@
 
 #include <Epetra_Comm.h>
 
+#include <future>
 #include <memory>
 
 FOUR_C_NAMESPACE_OPEN
@@ -57,6 +58,14 @@ namespace Core::IO
     VisualizationManager(Core::IO::VisualizationParameters parameters, const Epetra_Comm& comm,
         std::string base_output_name);
 
+    /**
+     * @brief Destructor, waits for a pending asynchronous write to finish
+     *
+     * An error of this write is reported to std::cerr. Call wait_for_pending_write() at the end
+     * of the run to handle it as an exception instead.
+     */
+    ~VisualizationManager();
+
     /**
      * @brief Return a const reference to the visualization data
      *
@@ -99,6 +108,10 @@ namespace Core::IO
     /**
      * @brief Write all contained visualization data containers to disk
      *
+     * With asynchronous output, the visualization data is copied and written on a background
+     * thread. This method only waits for the write of the previous step, such that the caller can
+     * modify the visualization data again right away.
+     *
      * @param visualziation_time (in) Time value of current step, this is not necessarily the same
      * as the simulation time
      * @param visualization_step (in) Time step counter of current time step (does not have to be
@@ -106,6 +119,14 @@ namespace Core::IO
      */
     void write_to_disk(const double visualziation_time, const int visualization_step);
 
+    /**
+     * @brief Wait until a pending asynchronous write to disk is finished
+     *
+     * Errors that occurred during the asynchronous write are rethrown here. Without asynchronous
+     * output, this method returns immediately.
+     */
+    void wait_for_pending_write();
+
    private:
     /**
      * @brief Return the output data name corresponding to a visualization data name
@@ -128,6 +149,9 @@ namespace Core::IO
 
     //! Base name of this output data
     const std::string base_output_name_;
+
+    //! Write of the previous step that is still running in the background
+    std::future<void> pending_write_;
   };
 }  // namespace Core::IO
 
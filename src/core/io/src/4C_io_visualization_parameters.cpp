@@ -29,6 +29,21 @@ Core::IO::VisualizationParameters Core::IO::visualization_parameters_factory(
   parameters.data_format_ = Teuchos::getIntegralValue<OutputDataFormat>(
       visualization_ouput_parameter_list, "OUTPUT_DATA_FORMAT");
 
+  // Compression and precision of binary data
+  parameters.compression_ = Teuchos::getIntegralValue<OutputCompression>(
+      visualization_ouput_parameter_list, "OUTPUT_COMPRESSION");
+  parameters.compression_level_ =
+      visualization_ouput_parameter_list.get<int>("OUTPUT_COMPRESSION_LEVEL");
+  if (parameters.compression_level_ < 0 or parameters.compression_level_ > 9)
+  {
+    FOUR_C_THROW(
+        "The compression level in IO/RUNTIME VTK OUTPUT/OUTPUT_COMPRESSION_LEVEL has to be "
+        "between 0 and 9, got %d",
+        parameters.compression_level_);
+  }
+  parameters.write_single_precision_ =
+      visualization_ouput_parameter_list.get<bool>("OUTPUT_SINGLE_PRECISION");
+
   // Number of digits to reserve for time step count
   parameters.digits_for_time_step_ =
       visualization_ouput_parameter_list.get<int>("TIMESTEP_RESERVE_DIGITS");
@@ -61,6 +76,9 @@ Core::IO::VisualizationParameters Core::IO::visualization_parameters_factory(
   }
   parameters.writer_ = output_writer;
 
+  parameters.write_asynchronously_ =
+      visualization_ouput_parameter_list.get<bool>("WRITE_ASYNCHRONOUSLY");
+
   return parameters;
 }
 
@@ -22,11 +22,19 @@ namespace Core::IO
   /// data format for written numeric data
   enum class OutputDataFormat
   {
-    binary,
-    ascii,
+    binary,    // base64 encoded binary data inline in each DataArray
+    ascii,     // human readable data inline in each DataArray
+    appended,  // raw binary data in an appended data section at the end of each file
     vague
   };
 
+  /// compression of binary numeric data
+  enum class OutputCompression
+  {
+    none,
+    zlib
+  };
+
   // Specify the output writer that shall be used
   enum class OutputWriter
   {
@@ -39,9 +47,18 @@ namespace Core::IO
    */
   struct VisualizationParameters
   {
-    //! Enum containing the type of output data format, i.e., binary or ascii.
+    //! Enum containing the type of output data format, i.e., binary, ascii or appended.
     OutputDataFormat data_format_;
 
+    //! Compression of the binary data
+    OutputCompression compression_;
+
+    //! zlib compression level between 0 (no compression) and 9 (best compression)
+    int compression_level_;
+
+    //! Flag if floating point data is written in single precision
+    bool write_single_precision_;
+
     //! Base output directory
     std::string directory_name_;
 
@@ -68,6 +85,9 @@ namespace Core::IO
 
     //! Enum containing the output writer that shall be used
     OutputWriter writer_;
+
+    //! Flag if the data is written to disk on a background thread while the simulation continues
+    bool write_asynchronously_;
   };
 
   /**
@@ -23,7 +23,8 @@ Core::IO::VisualizationWriterVtuPerRank::VisualizationWriterVtuPerRank(
           std::pow(10, Core::IO::get_total_digits_to_reserve_in_time_step(parameters)),
           parameters.directory_name_, (parameters.file_name_prefix_ + "-vtk-files"),
           visualization_data_name_, parameters.restart_from_name_, parameters.restart_time_,
-          parameters.data_format_ == OutputDataFormat::binary)
+          parameters.data_format_, parameters.compression_, parameters.compression_level_,
+          parameters.write_single_precision_)
 {
 }
 
@@ -11,7 +11,11 @@
 #include "4C_io_pstream.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <filesystem>
 #include <iomanip>
 #include <limits>
@@ -158,6 +162,72 @@ namespace LibB64
     return encoded_data;
   }
 
+  /*----------------------------------------------------------------------*
+   *----------------------------------------------------------------------*/
+  void write_uncompressed_block(const char* data, std::size_t data_size, std::ostream& out)
+  {
+    const uint32_t header = static_cast<uint32_t>(data_size);
+    char* encoded_header = encode_block(reinterpret_cast<const char*>(&header), sizeof(header));
+    out << encoded_header;
+    delete[] encoded_header;
+
+    char* encoded_data = encode_block(data, static_cast<int>(data_size));
+    out << encoded_data;
+    out << std::endl;
+    delete[] encoded_data;
+  }
+
+  /*----------------------------------------------------------------------*
+   *----------------------------------------------------------------------*/
+  void append_raw_block(const char* data, std::size_t data_size, bool compress, int level,
+      std::vector<char>& appended_data)
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("LibB64::append_raw_block");
+
+    if (!compress)
+    {
+      const uint64_t header = data_size;
+      const auto* header_bytes = reinterpret_cast<const char*>(&header);
+      appended_data.insert(appended_data.end(), header_bytes, header_bytes + sizeof(header));
+      appended_data.insert(appended_data.end(), data, data + data_size);
+      return;
+    }
+
+    // small blocks keep the memory of readers low and hardly affect the compression ratio since
+    // zlib only looks back 32 KiB anyway
+    constexpr std::size_t block_size = 1 << 16;
+    const std::size_t num_blocks = (data_size + block_size - 1) / block_size;
+
+    // header: number of blocks, block size, size of last block, compressed size of each block
+    std::vector<uint64_t> header(3 + num_blocks);
+    header[0] = num_blocks;
+    header[1] = block_size;
+    header[2] = num_blocks > 0 ? data_size - (num_blocks - 1) * block_size : 0;
+
+    const std::size_t header_position = appended_data.size();
+    appended_data.resize(header_position + header.size() * sizeof(uint64_t));
+
+    for (std::size_t block = 0; block < num_blocks; ++block)
+    {
+      const std::size_t block_begin = block * block_size;
+      const std::size_t this_block_size = std::min(block_size, data_size - block_begin);
+
+      uLongf compressed_size = compressBound(this_block_size);
+      const std::size_t position = appended_data.size();
+      appended_data.resize(position + compressed_size);
+      const int err = compress2(reinterpret_cast<Bytef*>(appended_data.data() + position),
+          &compressed_size, reinterpret_cast<const Bytef*>(data + block_begin), this_block_size,
+          level);
+      if (err != Z_OK) FOUR_C_THROW("zlib compression failed");
+
+      appended_data.resize(position + compressed_size);
+      header[3 + block] = compressed_size;
+    }
+
+    std::memcpy(appended_data.data() + header_position, header.data(),
+        header.size() * sizeof(uint64_t));
+  }
+
   /*----------------------------------------------------------------------*
    *----------------------------------------------------------------------*/
   std::string int2string(const unsigned int i, const unsigned int digits)
@@ -182,7 +252,9 @@ VtkWriterBase::VtkWriterBase(unsigned int myrank, unsigned int num_processors,
     unsigned int max_number_timesteps_to_be_written,
     const std::string& path_existing_working_directory,
     const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-    const std::string& restart_name, const double restart_time, bool write_binary_output)
+    const std::string& restart_name, const double restart_time,
+    Core::IO::OutputDataFormat data_format, Core::IO::OutputCompression compression,
+    int compression_level, bool write_single_precision)
     : currentPhase_(VAGUE),
       num_timestep_digits_(LibB64::ndigits(max_number_timesteps_to_be_written)),
       num_processor_digits_(LibB64::ndigits(num_processors)),
@@ -191,7 +263,11 @@ VtkWriterBase::VtkWriterBase(unsigned int myrank, unsigned int num_processors,
       timestep_(std::numeric_limits<unsigned int>::min()),
       is_restart_(restart_time > 0.0),
       cycle_(std::numeric_limits<int>::max()),
-      write_binary_output_(write_binary_output),
+      write_binary_output_(data_format != Core::IO::OutputDataFormat::ascii),
+      data_format_(data_format),
+      compression_(compression),
+      compression_level_(compression_level),
+      write_single_precision_(write_single_precision),
       myrank_(myrank),
       numproc_(num_processors)
 {
@@ -385,8 +461,14 @@ void VtkWriterBase::write_vtk_header_this_processor(const std::string& byteorder
   currentout_ << "<!-- \n";
   currentout_ << "# vtk DataFile Version 3.0\n";
   currentout_ << "-->\n";
-  currentout_ << "<VTKFile type=\"" << this->writer_string() << "\" version=\"0.1\"";
-  currentout_ << " compressor=\"vtkZLibDataCompressor\"";
+  // 64 bit headers of the binary data blocks require version 1.0 of the file format
+  if (data_format_ == Core::IO::OutputDataFormat::appended)
+    currentout_ << "<VTKFile type=\"" << this->writer_string()
+                << "\" version=\"1.0\" header_type=\"UInt64\"";
+  else
+    currentout_ << "<VTKFile type=\"" << this->writer_string() << "\" version=\"0.1\"";
+  if (compression_ == Core::IO::OutputCompression::zlib)
+    currentout_ << " compressor=\"vtkZLibDataCompressor\"";
   currentout_ << " byte_order=\"" << byteorder << "\"";
   currentout_ << ">\n";
   currentout_ << "  " << this->writer_opening_tag() << "\n";
@@ -426,21 +508,21 @@ void VtkWriterBase::write_field_data_array(
 void VtkWriterBase::write_data_array(const Core::IO::visualization_vector_type_variant& data,
     const int num_components, const std::string& name)
 {
-  std::string vtk_type_name = "";
+  std::string data_type_name = "";
   if (std::holds_alternative<std::vector<double>>(data))
   {
     write_data_array_this_processor(std::get<std::vector<double>>(data), num_components, name);
-    vtk_type_name = scalar_type_to_vtk_type<double>();
+    data_type_name = vtk_type_name<double>();
   }
   else if (std::holds_alternative<std::vector<int>>(data))
   {
     write_data_array_this_processor(std::get<std::vector<int>>(data), num_components, name);
-    vtk_type_name = scalar_type_to_vtk_type<int>();
+    data_type_name = vtk_type_name<int>();
   }
   else
     FOUR_C_THROW("Got unexpected vector type");
 
-  if (myrank_ == 0) write_data_array_master_file(num_components, name, vtk_type_name);
+  if (myrank_ == 0) write_data_array_master_file(num_components, name, data_type_name);
 }
 
 /*----------------------------------------------------------------------*
@@ -487,16 +569,13 @@ void VtkWriterBase::write_data_array_this_processor(
   throw_error_if_invalid_file_stream(filestream);
 
 
-  filestream << "        <DataArray type=\"" << scalar_type_to_vtk_type<T>() << "\" Name=\"" << name
-             << "\"";
+  filestream << "        <DataArray type=\"" << vtk_type_name<T>() << "\" Name=\"" << name << "\"";
 
   if (num_components > 1) filestream << " NumberOfComponents=\"" << num_components << "\"";
 
   if (write_binary_output_)
   {
-    filestream << " format=\"binary\">\n";
-
-    LibB64::write_compressed_block(data, filestream);
+    write_binary_data_array_values(data);
   }
   else
   {
@@ -604,6 +683,18 @@ void VtkWriterBase::write_vtk_footer_this_processor()
   currentout_ << "    </Piece>\n";
 
   currentout_ << "  </" << this->writer_string() << ">\n";
+
+  if (data_format_ == Core::IO::OutputDataFormat::appended)
+  {
+    // the underscore marks the beginning of the raw data
+    currentout_ << "  <AppendedData encoding=\"raw\">\n_";
+    currentout_.write(appended_data_.data(), appended_data_.size());
+    currentout_ << "\n  </AppendedData>\n";
+
+    // keep the memory for the next file
+    appended_data_.clear();
+  }
+
   currentout_ << "</VTKFile>\n";
 
   currentout_ << std::flush;
@@ -12,6 +12,7 @@
 #include "4C_config.hpp"
 
 #include "4C_io_visualization_data.hpp"
+#include "4C_io_visualization_parameters.hpp"
 #include "4C_utils_exceptions.hpp"
 
 #include <stdint.h>
@@ -21,6 +22,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -37,12 +39,13 @@ namespace LibB64
   char* encode_block(const char* data, const int data_size);
 
   template <typename T>
-  void write_compressed_block(const std::vector<T>& data, std::ostream& out)
+  void write_compressed_block(
+      const std::vector<T>& data, std::ostream& out, int level = Z_BEST_COMPRESSION)
   {
     uLongf compressed_data_length = compressBound(data.size() * sizeof(T));
     char* compressed_data = new char[compressed_data_length];
     int err = compress2((Bytef*)compressed_data, &compressed_data_length, (const Bytef*)data.data(),
-        data.size() * sizeof(T), Z_BEST_COMPRESSION);
+        data.size() * sizeof(T), level);
     if (err != Z_OK) FOUR_C_THROW("zlib compression failed");
 
     // now encode the compression header
@@ -66,6 +69,20 @@ namespace LibB64
     delete[] encoded_data;
   }
 
+  /**
+   * Write the given data base64 encoded without compression, i.e., a header with the number of
+   * bytes followed by the data.
+   */
+  void write_uncompressed_block(const char* data, std::size_t data_size, std::ostream& out);
+
+  /**
+   * Append the given data in the raw encoding of the VTK appended data section with UInt64
+   * headers to @p appended_data. Compressed data is split into blocks of fixed size that are
+   * compressed independently with the given zlib @p level.
+   */
+  void append_raw_block(const char* data, std::size_t data_size, bool compress, int level,
+      std::vector<char>& appended_data);
+
   /**
    \brief Helper function to determine output file string from time step number
    */
@@ -104,7 +121,9 @@ class VtkWriterBase
       unsigned int max_number_timesteps_to_be_written,
       const std::string& path_existing_working_directory,
       const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-      const std::string& restart_name, double restart_time, bool write_binary_output);
+      const std::string& restart_name, double restart_time,
+      Core::IO::OutputDataFormat data_format, Core::IO::OutputCompression compression,
+      int compression_level, bool write_single_precision);
 
   //! destructor
   virtual ~VtkWriterBase() = default;
@@ -153,6 +172,15 @@ class VtkWriterBase
   void write_data_array(const Core::IO::visualization_vector_type_variant& data,
       const int num_components, const std::string& name);
 
+  //! return the vtk type string of the values that are written for the scalar type T
+  template <typename T>
+  std::string vtk_type_name() const;
+
+  //! write the format attribute of the current DataArray and its values in one of the binary
+  //! formats, either inline or to the appended data section
+  template <typename T>
+  void write_binary_data_array_values(const std::vector<T>& data);
+
   //! generate the part of the filename that expresses the processor ID
   const std::string& get_part_of_file_name_indicating_processor_id(unsigned int processor_id) const;
 
@@ -336,6 +364,21 @@ class VtkWriterBase
   //! toggle between ascii and binary output
   const bool write_binary_output_;
 
+  //! binary data format, i.e., inline or appended
+  const Core::IO::OutputDataFormat data_format_;
+
+  //! compression of binary data
+  const Core::IO::OutputCompression compression_;
+
+  //! zlib compression level
+  const int compression_level_;
+
+  //! write floating point data in single precision
+  const bool write_single_precision_;
+
+  //! raw data of the appended data section of the current file on this processor
+  std::vector<char> appended_data_;
+
 
   //! global processor id of this processor
   const unsigned int myrank_;
@@ -359,11 +402,66 @@ inline std::string scalar_type_to_vtk_type<int>()
   return "Int32";
 }
 template <>
+inline std::string scalar_type_to_vtk_type<uint8_t>()
+{
+  return "UInt8";
+}
+template <>
+inline std::string scalar_type_to_vtk_type<float>()
+{
+  return "Float32";
+}
+template <>
 inline std::string scalar_type_to_vtk_type<double>()
 {
   return "Float64";
 }
 
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+template <typename T>
+std::string VtkWriterBase::vtk_type_name() const
+{
+  if constexpr (std::is_same_v<T, double>)
+    if (write_single_precision_) return scalar_type_to_vtk_type<float>();
+
+  return scalar_type_to_vtk_type<T>();
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+template <typename T>
+void VtkWriterBase::write_binary_data_array_values(const std::vector<T>& data)
+{
+  if constexpr (std::is_same_v<T, double>)
+  {
+    if (write_single_precision_)
+    {
+      write_binary_data_array_values(std::vector<float>(data.begin(), data.end()));
+      return;
+    }
+  }
+
+  const auto* bytes = reinterpret_cast<const char*>(data.data());
+  const std::size_t num_bytes = data.size() * sizeof(T);
+  const bool compress = compression_ == Core::IO::OutputCompression::zlib;
+
+  if (data_format_ == Core::IO::OutputDataFormat::appended)
+  {
+    // the offset refers to the beginning of the appended data section
+    currentout_ << " format=\"appended\" offset=\"" << appended_data_.size() << "\">\n";
+    LibB64::append_raw_block(bytes, num_bytes, compress, compression_level_, appended_data_);
+  }
+  else
+  {
+    currentout_ << " format=\"binary\">\n";
+    if (compress)
+      LibB64::write_compressed_block(data, currentout_, compression_level_);
+    else
+      LibB64::write_uncompressed_block(bytes, num_bytes, currentout_);
+  }
+}
 FOUR_C_NAMESPACE_CLOSE
 
 #endif
@@ -33,7 +33,9 @@ class VtuWriter : public VtkWriterBase
       unsigned int max_number_timesteps_to_be_written,
       const std::string& path_existing_working_directory,
       const std::string& name_new_vtk_subdirectory, const std::string& geometry_name,
-      const std::string& restart_name, double restart_time, bool write_binary_output);
+      const std::string& restart_name, double restart_time,
+      Core::IO::OutputDataFormat data_format, Core::IO::OutputCompression compression,
+      int compression_level, bool write_single_precision);
 
   //! write the geometry defining this unstructured grid
   void write_geometry_unstructured_grid(const std::vector<double>& point_coordinates,
@@ -13,6 +13,9 @@
 #include "4C_unittest_utils_support_files_test.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <set>
+#include <sstream>
+
 namespace
 {
   using namespace FourC;
@@ -163,6 +166,34 @@ namespace
     check_section(reader, "--PARTICLES", std::vector<std::string>(30, "line in long section"));
   }
 
+  TEST(DatFileReader, LinesInSectionChunk)
+  {
+    const std::string input_file_name = TESTING::get_support_file_path("test_files/test1.dat");
+
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+    Core::IO::DatFileReader reader{input_file_name, comm};
+
+    // the chunks together contain all lines of a section exactly once
+    for (const auto& [section, num_lines] : std::vector<std::pair<std::string, std::size_t>>{
+             {"--PARTICLES", 30}, {"--SHORT SECTION", 3}, {"--EMPTY", 0}})
+    {
+      for (int num_chunks : {1, 2, 7, 64})
+      {
+        SCOPED_TRACE(section + " in " + std::to_string(num_chunks) + " chunks");
+        std::size_t num_chunk_lines = 0;
+        for (int chunk = 0; chunk < num_chunks; ++chunk)
+        {
+          for (const auto& line : reader.lines_in_section_chunk(section, chunk, num_chunks))
+          {
+            EXPECT_EQ(line.find("line in"), 0);
+            ++num_chunk_lines;
+          }
+        }
+        EXPECT_EQ(num_chunk_lines, num_lines);
+      }
+    }
+  }
+
   TEST(DatFileReader, HasIncludes)
   {
     const std::string input_file_name =
@@ -179,6 +210,43 @@ namespace
     check_section(reader, "--PARTICLES", std::vector<std::string>(5, "line"));
   }
 
+  TEST(DatFileReader, InputFilesContainIncludes)
+  {
+    const std::string input_file_name =
+        TESTING::get_support_file_path("test_files/has_includes/main.dat");
+
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+    Core::IO::DatFileReader reader{input_file_name, comm};
+
+    ASSERT_EQ(reader.input_files().size(), 5);
+    EXPECT_EQ(reader.input_files().front(), input_file_name);
+
+    std::set<std::string> file_names;
+    for (const auto& file : reader.input_files()) file_names.insert(file.filename().string());
+    EXPECT_EQ(file_names, (std::set<std::string>{"main.dat", "include1a.dat", "include1b.dat",
+                              "include2.dat", "include3.dat"}));
+  }
+
+  TEST(DatFileReader, MarkSectionUsed)
+  {
+    const std::string input_file_name =
+        TESTING::get_support_file_path("test_files/has_includes/main.dat");
+
+    Epetra_MpiComm comm(MPI_COMM_WORLD);
+    Core::IO::DatFileReader reader{input_file_name, comm};
+
+    auto unknown_sections = [&]()
+    {
+      std::ostringstream out;
+      reader.print_unknown_sections(out);
+      return out.str();
+    };
+
+    EXPECT_NE(unknown_sections().find("--SECTION 1"), std::string::npos);
+    reader.mark_section_used("--SECTION 1");
+    EXPECT_EQ(unknown_sections().find("--SECTION 1"), std::string::npos);
+  }
+
   TEST(DatFileReader, CyclicIncludes)
   {
     const std::string input_file_name =
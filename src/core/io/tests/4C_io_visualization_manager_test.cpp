@@ -0,0 +1,116 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_visualization_manager.hpp"
+
+#include "4C_io_visualization_data.hpp"
+#include "4C_io_visualization_parameters.hpp"
+
+#include <Epetra_MpiComm.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace
+{
+  using namespace FourC;
+
+  //! content of all files below @p directory by their relative path
+  std::map<std::string, std::string> read_files(const std::filesystem::path& directory)
+  {
+    std::map<std::string, std::string> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+    {
+      if (!entry.is_regular_file()) continue;
+      std::ifstream file(entry.path());
+      std::stringstream content;
+      content << file.rdbuf();
+      files[std::filesystem::relative(entry.path(), directory).string()] = content.str();
+    }
+    return files;
+  }
+
+  class VisualizationManagerTest : public ::testing::Test
+  {
+   protected:
+    VisualizationManagerTest() : comm_(MPI_COMM_WORLD)
+    {
+      directory_ = std::filesystem::temp_directory_path() / "4C_io_visualization_manager_test";
+      std::filesystem::remove_all(directory_);
+    }
+
+    ~VisualizationManagerTest() override { std::filesystem::remove_all(directory_); }
+
+    Core::IO::VisualizationParameters parameters(
+        const std::string& subdirectory, bool write_asynchronously) const
+    {
+      Core::IO::VisualizationParameters parameters{};
+      parameters.data_format_ = Core::IO::OutputDataFormat::ascii;
+      parameters.compression_ = Core::IO::OutputCompression::none;
+      parameters.compression_level_ = 0;
+      parameters.write_single_precision_ = false;
+      parameters.directory_name_ = (directory_ / subdirectory).string();
+      parameters.every_iteration_ = false;
+      parameters.every_iteration_virtual_time_increment_ = 0.0;
+      parameters.file_name_prefix_ = "test";
+      parameters.digits_for_iteration_ = 0;
+      parameters.digits_for_time_step_ = 5;
+      parameters.restart_time_ = 0.0;
+      parameters.writer_ = Core::IO::OutputWriter::vtu_per_rank;
+      parameters.write_asynchronously_ = write_asynchronously;
+      return parameters;
+    }
+
+    //! write two steps, the data of the first step is modified while it is written
+    static void write_steps(Core::IO::VisualizationManager& manager)
+    {
+      for (int step = 1; step <= 2; ++step)
+      {
+        Core::IO::VisualizationData& data = manager.get_visualization_data();
+        data.clear_data();
+        data.get_point_coordinates() = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0 * step};
+        data.set_point_data_vector<double>("value", {1.0, 2.0, 3.0 * step}, 1);
+
+        manager.write_to_disk(0.1 * step, step);
+      }
+      manager.get_visualization_data().clear_data();
+    }
+
+    Epetra_MpiComm comm_;
+    std::filesystem::path directory_;
+  };
+
+  TEST_F(VisualizationManagerTest, AsynchronousWriteThenWait)
+  {
+    Core::IO::VisualizationManager synchronous(parameters("sync", false), comm_, "output");
+    write_steps(synchronous);
+
+    Core::IO::VisualizationManager asynchronous(parameters("async", true), comm_, "output");
+    write_steps(asynchronous);
+    asynchronous.wait_for_pending_write();
+
+    const auto synchronous_files = read_files(directory_ / "sync");
+    EXPECT_FALSE(synchronous_files.empty());
+    EXPECT_EQ(read_files(directory_ / "async"), synchronous_files);
+  }
+
+  TEST_F(VisualizationManagerTest, ErrorOfAsynchronousWriteIsRethrown)
+  {
+    Core::IO::VisualizationManager manager(parameters("async", true), comm_, "output");
+    manager.get_visualization_data().get_point_coordinates() = {0.0, 0.0, 0.0};
+
+    // the output directory is created by the writer, without it the background write fails
+    std::filesystem::remove_all(directory_);
+    manager.write_to_disk(0.1, 1);
+
+    EXPECT_ANY_THROW(manager.wait_for_pending_write());
+  }
+}  // namespace
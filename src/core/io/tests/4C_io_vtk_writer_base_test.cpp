@@ -0,0 +1,259 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_vtk_writer_base.hpp"
+
+#include "4C_io_vtu_writer.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+  using namespace FourC;
+
+  template <typename T>
+  T read_value(const char* bytes)
+  {
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+  }
+
+  //! decode one block of the raw appended data section that starts at @p block
+  std::vector<char> decode_raw_block(const char* block, bool compressed)
+  {
+    if (!compressed)
+    {
+      const auto size = read_value<std::uint64_t>(block);
+      return std::vector<char>(block + sizeof(std::uint64_t), block + sizeof(std::uint64_t) + size);
+    }
+
+    const auto num_blocks = read_value<std::uint64_t>(block);
+    const auto block_size = read_value<std::uint64_t>(block + sizeof(std::uint64_t));
+    const auto last_block_size = read_value<std::uint64_t>(block + 2 * sizeof(std::uint64_t));
+
+    std::vector<char> data;
+    const char* compressed_data = block + (3 + num_blocks) * sizeof(std::uint64_t);
+    for (std::uint64_t i = 0; i < num_blocks; ++i)
+    {
+      const auto compressed_size =
+          read_value<std::uint64_t>(block + (3 + i) * sizeof(std::uint64_t));
+
+      uLongf size = (i + 1 == num_blocks) ? last_block_size : block_size;
+      std::vector<char> uncompressed(size);
+      EXPECT_EQ(uncompress(reinterpret_cast<Bytef*>(uncompressed.data()), &size,
+                    reinterpret_cast<const Bytef*>(compressed_data), compressed_size),
+          Z_OK);
+      EXPECT_EQ(size, uncompressed.size());
+
+      data.insert(data.end(), uncompressed.begin(), uncompressed.end());
+      compressed_data += compressed_size;
+    }
+    return data;
+  }
+
+  //! decode base64 encoded text, the padding of concatenated encodings is skipped
+  std::vector<char> decode_base64(const std::string& text)
+  {
+    const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::vector<char> data;
+    unsigned int buffer = 0;
+    int num_bits = 0;
+    for (const char c : text)
+    {
+      if (c == '=')
+      {
+        // the padding ends an encoding, the next one starts byte aligned
+        buffer = 0;
+        num_bits = 0;
+        continue;
+      }
+
+      buffer = (buffer << 6) | static_cast<unsigned int>(alphabet.find(c));
+      num_bits += 6;
+      if (num_bits >= 8)
+      {
+        num_bits -= 8;
+        data.push_back(static_cast<char>((buffer >> num_bits) & 0xff));
+      }
+    }
+    return data;
+  }
+
+  template <typename T>
+  std::vector<T> to_values(const std::vector<char>& bytes)
+  {
+    EXPECT_EQ(bytes.size() % sizeof(T), 0);
+    std::vector<T> values(bytes.size() / sizeof(T));
+    std::memcpy(values.data(), bytes.data(), values.size() * sizeof(T));
+    return values;
+  }
+
+  TEST(LibB64, AppendRawBlockUncompressed)
+  {
+    const std::vector<double> values = {1.0, -2.5, 3.25};
+    std::vector<char> appended_data = {'x'};
+    LibB64::append_raw_block(reinterpret_cast<const char*>(values.data()),
+        values.size() * sizeof(double), false, 0, appended_data);
+
+    EXPECT_EQ(appended_data.size(), 1 + sizeof(std::uint64_t) + values.size() * sizeof(double));
+    EXPECT_EQ(to_values<double>(decode_raw_block(appended_data.data() + 1, false)), values);
+  }
+
+  TEST(LibB64, AppendRawBlockCompressedInSeveralBlocks)
+  {
+    // more than one block of 64 KiB
+    std::vector<double> values(20000);
+    for (std::size_t i = 0; i < values.size(); ++i) values[i] = 0.5 * static_cast<double>(i % 97);
+
+    std::vector<char> appended_data;
+    LibB64::append_raw_block(reinterpret_cast<const char*>(values.data()),
+        values.size() * sizeof(double), true, Z_BEST_SPEED, appended_data);
+
+    EXPECT_EQ(read_value<std::uint64_t>(appended_data.data()), 3);
+    EXPECT_LT(appended_data.size(), values.size() * sizeof(double));
+    EXPECT_EQ(to_values<double>(decode_raw_block(appended_data.data(), true)), values);
+  }
+
+  TEST(LibB64, WriteUncompressedBlock)
+  {
+    const std::vector<double> values = {1.0, -2.5, 3.25, 4.0};
+    std::ostringstream out;
+    LibB64::write_uncompressed_block(
+        reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double), out);
+
+    const std::vector<char> bytes = decode_base64(out.str().substr(0, out.str().find('\n')));
+    ASSERT_EQ(bytes.size(), sizeof(std::uint32_t) + values.size() * sizeof(double));
+    EXPECT_EQ(read_value<std::uint32_t>(bytes.data()), values.size() * sizeof(double));
+    const std::vector<char> data(bytes.begin() + sizeof(std::uint32_t), bytes.end());
+    EXPECT_EQ(to_values<double>(data), values);
+  }
+
+  class VtuWriterRoundTripTest : public ::testing::Test
+  {
+   protected:
+    VtuWriterRoundTripTest()
+    {
+      directory_ = std::filesystem::temp_directory_path() / "4C_io_vtk_writer_base_test";
+      std::filesystem::remove_all(directory_);
+    }
+
+    ~VtuWriterRoundTripTest() override { std::filesystem::remove_all(directory_); }
+
+    //! write the point data "value" to a vtu file and return the content of the file
+    std::string write(Core::IO::OutputDataFormat data_format,
+        Core::IO::OutputCompression compression, bool write_single_precision) const
+    {
+      std::filesystem::remove_all(directory_);
+
+      {
+        VtuWriter writer(0, 1, 10, directory_.string(), "vtk-files", "geometry", "", 0.0,
+            data_format, compression, 1, write_single_precision);
+        writer.reset_time_and_time_step(0.1, 1);
+        writer.initialize_vtk_file_streams_for_new_geometry_and_or_time_step();
+        writer.write_vtk_headers();
+        writer.write_geometry_unstructured_grid(
+            {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0}, {}, {}, {}, {}, {});
+        writer.write_point_data_vector(values_, 1, "value");
+        writer.write_vtk_footers();
+      }
+
+      for (const auto& entry : std::filesystem::recursive_directory_iterator(directory_))
+      {
+        if (entry.path().extension() != ".vtu") continue;
+        std::ifstream file(entry.path(), std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+      }
+      ADD_FAILURE() << "No vtu file was written.";
+      return {};
+    }
+
+    //! the attribute @p attribute of the data array "value"
+    static std::string attribute(const std::string& content, const std::string& attribute)
+    {
+      const std::size_t tag_end = content.find('>', content.find("Name=\"value\""));
+      const std::size_t tag_begin = content.rfind("<DataArray", tag_end);
+      const std::string tag = content.substr(tag_begin, tag_end - tag_begin);
+
+      const std::size_t value_begin = tag.find(attribute + "=\"") + attribute.size() + 2;
+      return tag.substr(value_begin, tag.find('"', value_begin) - value_begin);
+    }
+
+    //! decode the data array "value" from the appended data section
+    static std::vector<char> appended_values(const std::string& content, bool compressed)
+    {
+      const std::string marker = "<AppendedData encoding=\"raw\">\n_";
+      const std::size_t data_begin = content.find(marker) + marker.size();
+      const std::size_t offset = std::stoul(attribute(content, "offset"));
+      return decode_raw_block(content.data() + data_begin + offset, compressed);
+    }
+
+    template <typename T>
+    std::vector<T> expected_values() const
+    {
+      return std::vector<T>(values_.begin(), values_.end());
+    }
+
+    std::filesystem::path directory_;
+    const std::vector<double> values_ = {0.1, -2.0 / 3.0, 1.0e10};
+  };
+
+  TEST_F(VtuWriterRoundTripTest, AppendedUncompressed)
+  {
+    const std::string content =
+        write(Core::IO::OutputDataFormat::appended, Core::IO::OutputCompression::none, false);
+
+    EXPECT_NE(content.find("header_type=\"UInt64\""), std::string::npos);
+    EXPECT_EQ(attribute(content, "format"), "appended");
+    EXPECT_EQ(attribute(content, "type"), "Float64");
+    EXPECT_EQ(to_values<double>(appended_values(content, false)), expected_values<double>());
+  }
+
+  TEST_F(VtuWriterRoundTripTest, AppendedCompressed)
+  {
+    const std::string content =
+        write(Core::IO::OutputDataFormat::appended, Core::IO::OutputCompression::zlib, false);
+
+    EXPECT_NE(content.find("compressor=\"vtkZLibDataCompressor\""), std::string::npos);
+    EXPECT_EQ(to_values<double>(appended_values(content, true)), expected_values<double>());
+  }
+
+  TEST_F(VtuWriterRoundTripTest, AppendedSinglePrecision)
+  {
+    const std::string content =
+        write(Core::IO::OutputDataFormat::appended, Core::IO::OutputCompression::none, true);
+
+    EXPECT_EQ(attribute(content, "type"), "Float32");
+    EXPECT_EQ(to_values<float>(appended_values(content, false)), expected_values<float>());
+  }
+
+  TEST_F(VtuWriterRoundTripTest, InlineUncompressedSinglePrecision)
+  {
+    const std::string content =
+        write(Core::IO::OutputDataFormat::binary, Core::IO::OutputCompression::none, true);
+
+    EXPECT_EQ(attribute(content, "format"), "binary");
+    EXPECT_EQ(attribute(content, "type"), "Float32");
+
+    const std::size_t data_begin = content.find('\n', content.find("Name=\"value\"")) + 1;
+    const std::vector<char> bytes =
+        decode_base64(content.substr(data_begin, content.find('\n', data_begin) - data_begin));
+    ASSERT_GT(bytes.size(), sizeof(std::uint32_t));
+    EXPECT_EQ(read_value<std::uint32_t>(bytes.data()), values_.size() * sizeof(float));
+    const std::vector<char> data(bytes.begin() + sizeof(std::uint32_t), bytes.end());
+    EXPECT_EQ(to_values<float>(data), expected_values<float>());
+  }
+}  // namespace
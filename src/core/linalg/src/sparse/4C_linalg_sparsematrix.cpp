@@ -13,10 +13,15 @@
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iterator>
 #include <sstream>
 
+#ifdef FOUR_C_WITH_OPENMP
+#include <omp.h>
+#endif
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------*
@@ -207,6 +212,8 @@ bool Core::LinAlg::SparseMatrix::destroy(bool throw_exception)
   }
   dbcmaps_ = Teuchos::null;
 
+  clear_frozen_pattern();
+
   return true;
 }
 
@@ -255,6 +262,8 @@ Core::LinAlg::SparseMatrix& Core::LinAlg::SparseMatrix::operator=(const SparseMa
   else
     graph_ = Teuchos::null;
 
+  clear_frozen_pattern();
+
   return *this;
 }
 
@@ -276,6 +285,7 @@ void Core::LinAlg::SparseMatrix::assign(DataAccess access, const SparseMatrix& m
     savegraph_ = mat.savegraph_;
     matrixtype_ = mat.matrixtype_;
     dbcmaps_ = mat.dbcmaps_;
+    clear_frozen_pattern();
   }
 }
 
@@ -306,6 +316,19 @@ void Core::LinAlg::SparseMatrix::zero()
       FOUR_C_THROW("matrix type is not correct");
 
     sysmat_->FillComplete(domainmap, rangemap);
+
+    if (freeze_pattern_)
+    {
+      // a new graph invalidates all cached positions, otherwise the first
+      // assembly after freezing is complete and the cache stays as it is
+      if (pattern_graph_.get() != graph_.get())
+      {
+        clear_frozen_pattern();
+        pattern_graph_ = graph_;
+      }
+      else if (!pattern_offsets_.empty())
+        record_pattern_ = false;
+    }
   }
 }
 
@@ -349,6 +372,7 @@ void Core::LinAlg::SparseMatrix::reset()
 
   graph_ = Teuchos::null;
   dbcmaps_ = Teuchos::null;
+  clear_frozen_pattern();
 }
 
 /*----------------------------------------------------------------------*
@@ -372,6 +396,8 @@ void Core::LinAlg::SparseMatrix::assemble(int eid, const std::vector<int>& lmstr
   auto& A = (Core::LinAlg::SerialDenseMatrix&)Aele;
   if (sysmat_->Filled())  // assembly in local indices
   {
+    if (assemble_frozen_pattern(eid, Aele, lmrow, lmrowowner, lmcol)) return;
+
 #ifdef FOUR_C_ENABLE_ASSERTIONS
     // There is the case of nodes without dofs (XFEM).
     // If no row dofs are present on this proc, there is nothing to assemble.
@@ -559,6 +585,8 @@ void Core::LinAlg::SparseMatrix::assemble(int eid, const Core::LinAlg::SerialDen
 
   if (sysmat_->Filled())
   {
+    if (assemble_frozen_pattern(eid, Aele, lmrow, lmrowowner, lmcol)) return;
+
 #ifdef FOUR_C_ENABLE_ASSERTIONS
     // There is the case of nodes without dofs (XFEM).
     // If no row dofs are present on this proc, their is nothing to assemble.
@@ -647,6 +675,152 @@ void Core::LinAlg::SparseMatrix::assemble(int eid, const Core::LinAlg::SerialDen
   }
 }
 
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::LinAlg::SparseMatrix::freeze_pattern(bool freeze)
+{
+  freeze_pattern_ = freeze;
+  num_frozen_pattern_assemblies_ = 0;
+  clear_frozen_pattern();
+  if (freeze_pattern_) pattern_graph_ = graph_;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Core::LinAlg::SparseMatrix::clear_frozen_pattern()
+{
+  pattern_graph_ = Teuchos::null;
+  pattern_dbcmaps_ = Teuchos::null;
+  pattern_offsets_.clear();
+  pattern_table_.clear();
+  record_pattern_ = freeze_pattern_;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::LinAlg::SparseMatrix::assemble_frozen_pattern(int eid,
+    const Core::LinAlg::SerialDenseMatrix& Aele, const std::vector<int>& lmrow,
+    const std::vector<int>& lmrowowner, const std::vector<int>& lmcol)
+{
+  if (not freeze_pattern_ or graph_ == Teuchos::null or pattern_graph_.get() != graph_.get())
+    return false;
+
+  // the matrix layout must still be the one of the saved graph, which is not the case e.g. after
+  // an explicit Dirichlet application
+  if (sysmat_->NumMyNonzeros() != graph_->NumMyNonzeros()) return false;
+
+  // rows with Dirichlet conditions are skipped according to the maps at recording time
+  if (not pattern_offsets_.empty() and dbcmaps_.get() != pattern_dbcmaps_.get()) return false;
+
+  auto entry = pattern_offsets_.find(eid);
+  if (entry == pattern_offsets_.end())
+  {
+    if (not record_pattern_) return false;
+#ifdef FOUR_C_WITH_OPENMP
+    if (omp_in_parallel()) return false;
+#endif
+    if (not record_frozen_pattern(eid, lmrow, lmrowowner, lmcol)) return false;
+    entry = pattern_offsets_.find(eid);
+  }
+
+  const int lrowdim = (int)lmrow.size();
+  const int lcoldim = (int)lmcol.size();
+  const int* table = pattern_table_.data() + entry->second;
+  if (table[0] != lrowdim or table[1] != lcoldim) return false;
+  table += 2;
+  if (not std::equal(lmrow.begin(), lmrow.end(), table)) return false;
+  table += lrowdim;
+  if (not std::equal(lmrowowner.begin(), lmrowowner.begin() + lrowdim, table)) return false;
+  table += lrowdim;
+  if (not std::equal(lmcol.begin(), lmcol.end(), table)) return false;
+  table += lcoldim;
+
+  for (int lrow = 0; lrow < lrowdim; ++lrow, table += lcoldim + 1)
+  {
+    const int rlid = table[0];
+    if (rlid < 0) continue;
+
+    int length;
+    double* valview;
+    sysmat_->ExtractMyRowView(rlid, length, valview);
+    const int* pos = table + 1;
+    for (int lcol = 0; lcol < lcoldim; ++lcol) valview[pos[lcol]] += Aele(lrow, lcol);
+  }
+
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp atomic
+#endif
+  ++num_frozen_pattern_assemblies_;
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Core::LinAlg::SparseMatrix::record_frozen_pattern(int eid, const std::vector<int>& lmrow,
+    const std::vector<int>& lmrowowner, const std::vector<int>& lmcol)
+{
+  const int lrowdim = (int)lmrow.size();
+  const int lcoldim = (int)lmcol.size();
+  const int myrank = sysmat_->Comm().MyPID();
+  const Epetra_Map& rowmap = sysmat_->RowMap();
+  const Epetra_Map& colmap = sysmat_->ColMap();
+
+  std::vector<int> localcol(lcoldim);
+  for (int lcol = 0; lcol < lcoldim; ++lcol)
+  {
+    localcol[lcol] = colmap.LID(lmcol[lcol]);
+    if (localcol[lcol] < 0) return false;
+  }
+
+  std::vector<int> table;
+  table.reserve(2 + 2 * lrowdim + lcoldim + lrowdim * (lcoldim + 1));
+  table.push_back(lrowdim);
+  table.push_back(lcoldim);
+  table.insert(table.end(), lmrow.begin(), lmrow.end());
+  table.insert(table.end(), lmrowowner.begin(), lmrowowner.begin() + lrowdim);
+  table.insert(table.end(), lmcol.begin(), lmcol.end());
+
+  for (int lrow = 0; lrow < lrowdim; ++lrow)
+  {
+    const int rgid = lmrow[lrow];
+    int rlid = -1;
+    if (lmrowowner[lrow] == myrank and
+        not(dbcmaps_ != Teuchos::null and dbcmaps_->Map(1)->MyGID(rgid)))
+    {
+      rlid = rowmap.LID(rgid);
+      if (rlid < 0) return false;
+    }
+    table.push_back(rlid);
+
+    if (rlid < 0)
+    {
+      table.insert(table.end(), lcoldim, 0);
+      continue;
+    }
+
+    int length;
+    double* valview;
+    int* indices;
+    if (sysmat_->ExtractMyRowView(rlid, length, valview, indices)) return false;
+    for (int lcol = 0; lcol < lcoldim; ++lcol)
+    {
+      const int* loc = std::lower_bound(indices, indices + length, localcol[lcol]);
+      if (loc == indices + length or *loc != localcol[lcol]) return false;
+      table.push_back(loc - indices);
+    }
+  }
+
+  if (pattern_offsets_.empty()) pattern_dbcmaps_ = dbcmaps_;
+  pattern_offsets_[eid] = pattern_table_.size();
+  pattern_table_.insert(pattern_table_.end(), table.begin(), table.end());
+  return true;
+}
+
+
 /*----------------------------------------------------------------------*
  *----------------------------------------------------------------------*/
 void Core::LinAlg::SparseMatrix::fe_assemble(const Core::LinAlg::SerialDenseMatrix& Aele,
@@ -877,6 +1051,7 @@ void Core::LinAlg::SparseMatrix::un_complete()
   }
   sysmat_ = mat;
   graph_ = Teuchos::null;
+  clear_frozen_pattern();
 }
 
 
@@ -17,6 +17,9 @@
 #include <Epetra_Comm.h>
 #include <Epetra_FECrsMatrix.h>
 
+#include <unordered_map>
+#include <vector>
+
 class Epetra_CrsMatrix;
 
 FOUR_C_NAMESPACE_OPEN
@@ -176,6 +179,30 @@ namespace Core::LinAlg
     /// destroy the underlying Epetra objects
     virtual bool destroy(bool throw_exception = true);
 
+    /// Cache the position of every element matrix entry in the saved graph
+    /*!
+      Only effective if the graph is saved (see save_graph()). The first filled
+      assembly of an element records its local rows and the offsets of all its
+      entries in the CRS value arrays, keyed by element id. Subsequent
+      assemblies into the same graph add the element matrix at these offsets
+      directly instead of looking up local column ids and searching each row.
+      Cached entries are only used if the element's location vectors match the
+      recorded ones, otherwise the usual assembly path is taken. The cache is
+      dropped whenever the graph is thrown away (reset(), un_complete(),
+      assignment).
+
+      \note Recording takes place during the first assembly after the pattern
+      was frozen (or after the graph changed) and is skipped inside OpenMP
+      parallel regions. Reading the cache is thread-safe.
+     */
+    void freeze_pattern(bool freeze = true);
+
+    /// Whether element assembly uses cached positions (see freeze_pattern())
+    bool frozen_pattern() const { return freeze_pattern_; }
+
+    /// Number of element matrices added at cached positions since the pattern was frozen
+    std::size_t num_frozen_pattern_assemblies() const { return num_frozen_pattern_assemblies_; }
+
     /// assemble method for Epetra_CrsMatrices, if ONLY local values are assembled
     void assemble(int eid, const std::vector<int>& lmstride,
         const Core::LinAlg::SerialDenseMatrix& Aele, const std::vector<int>& lm,
@@ -379,6 +406,44 @@ namespace Core::LinAlg
 
     /// matrix type (Epetra_CrsMatrix or Epetra_FECrsMatrix)
     MatrixType matrixtype_;
+
+    /// add an element matrix at its cached positions, false if there is no valid cache entry
+    bool assemble_frozen_pattern(int eid, const Core::LinAlg::SerialDenseMatrix& Aele,
+        const std::vector<int>& lmrow, const std::vector<int>& lmrowowner,
+        const std::vector<int>& lmcol);
+
+    /// record the positions of an element matrix in the saved graph, false on failure
+    bool record_frozen_pattern(int eid, const std::vector<int>& lmrow,
+        const std::vector<int>& lmrowowner, const std::vector<int>& lmcol);
+
+    /// drop all cached element positions
+    void clear_frozen_pattern();
+
+    /// whether element assembly tables are cached (see freeze_pattern())
+    bool freeze_pattern_ = false;
+
+    /// whether new elements may still be recorded in the pattern cache
+    bool record_pattern_ = false;
+
+    /// number of element matrices added at cached positions
+    std::size_t num_frozen_pattern_assemblies_ = 0;
+
+    /// graph the pattern cache refers to, held such that its address cannot be reused
+    Teuchos::RCP<Epetra_CrsGraph> pattern_graph_;
+
+    /// Dirichlet maps the pattern cache was recorded with, held such that its address cannot be
+    /// reused
+    Teuchos::RCP<MultiMapExtractor> pattern_dbcmaps_;
+
+    /// element id -> offset of the element's table in pattern_table_
+    std::unordered_map<int, std::size_t> pattern_offsets_;
+
+    /*!
+      Element tables, each laid out as [lrowdim, lcoldim, lmrow, lmrowowner, lmcol] followed
+      by one block per element row holding the local row id (-1 if the row is
+      not assembled on this proc) and lcoldim offsets into the row's values.
+     */
+    std::vector<int> pattern_table_;
   };
 
   //! Cast matrix of type SparseOperator to const SparseMatrix and check in debug mode if cast was
@@ -0,0 +1,148 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linalg_sparsematrix.hpp"
+
+#include <Epetra_MpiComm.h>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  class SparseMatrixTest : public testing::Test
+  {
+   public:
+    //! Testing parameters
+    Teuchos::RCP<Epetra_Comm> comm_;
+
+   protected:
+    SparseMatrixTest() { comm_ = Teuchos::make_rcp<Epetra_MpiComm>(MPI_COMM_WORLD); }
+
+    //! number of rows owned by each proc
+    static constexpr int rows_per_proc_ = 4;
+
+    //! assemble a 1d chain of two-node elements, scaled by @p scale
+    /*!
+      If @p assemble_second_row is false, the second row of every element is
+      marked as owned by no proc, i.e. it is not assembled anywhere.
+     */
+    void assemble_chain(
+        Core::LinAlg::SparseMatrix& A, double scale, bool assemble_second_row = true) const
+    {
+      const int myrank = comm_->MyPID();
+      const int numrows = rows_per_proc_ * comm_->NumProc();
+
+      const std::vector<int> lmstride = {1, 1};
+      Core::LinAlg::SerialDenseMatrix Aele(2, 2);
+      for (int eid = 0; eid < numrows - 1; ++eid)
+      {
+        const std::vector<int> lm = {eid, eid + 1};
+        std::vector<int> lmowner = {eid / rows_per_proc_, (eid + 1) / rows_per_proc_};
+        if (lmowner[0] != myrank and lmowner[1] != myrank) continue;
+        if (not assemble_second_row) lmowner[1] = -1;
+
+        const double k = scale * (1.0 + eid);
+        Aele(0, 0) = k;
+        Aele(0, 1) = -k;
+        Aele(1, 0) = -k;
+        Aele(1, 1) = 2.0 * k;
+        A.assemble(eid, lmstride, Aele, lm, lmowner);
+      }
+      A.complete();
+    }
+
+    //! number of elements assemble_chain() assembles on this proc
+    std::size_t num_my_elements() const
+    {
+      const int myrank = comm_->MyPID();
+      const int numrows = rows_per_proc_ * comm_->NumProc();
+
+      std::size_t num_elements = 0;
+      for (int eid = 0; eid < numrows - 1; ++eid)
+        if (eid / rows_per_proc_ == myrank or (eid + 1) / rows_per_proc_ == myrank) ++num_elements;
+      return num_elements;
+    }
+
+    //! expect the values of @p A and @p B to be identical
+    static void expect_equal_values(
+        const Core::LinAlg::SparseMatrix& A, const Core::LinAlg::SparseMatrix& B)
+    {
+      ASSERT_EQ(A.epetra_matrix()->NumMyNonzeros(), B.epetra_matrix()->NumMyNonzeros());
+      for (int rlid = 0; rlid < A.row_map().NumMyElements(); ++rlid)
+      {
+        int a_length, b_length;
+        double *a_values, *b_values;
+        int *a_indices, *b_indices;
+        A.epetra_matrix()->ExtractMyRowView(rlid, a_length, a_values, a_indices);
+        B.epetra_matrix()->ExtractMyRowView(rlid, b_length, b_values, b_indices);
+
+        ASSERT_EQ(a_length, b_length);
+        for (int i = 0; i < a_length; ++i) EXPECT_DOUBLE_EQ(a_values[i], b_values[i]);
+      }
+    }
+  };
+
+  TEST_F(SparseMatrixTest, FrozenPatternReassembly)
+  {
+    const Epetra_Map rowmap(-1, rows_per_proc_, 0, *comm_);
+    Core::LinAlg::SparseMatrix reference(rowmap, 3, false, true);
+    Core::LinAlg::SparseMatrix frozen(rowmap, 3, false, true);
+
+    assemble_chain(reference, 1.0);
+    assemble_chain(frozen, 1.0);
+
+    frozen.freeze_pattern();
+    EXPECT_TRUE(frozen.frozen_pattern());
+
+    // the first pass records the element tables, the following ones reuse them
+    for (int step = 1; step <= 3; ++step)
+    {
+      reference.zero();
+      frozen.zero();
+      assemble_chain(reference, 0.5 * step);
+      assemble_chain(frozen, 0.5 * step);
+
+      expect_equal_values(reference, frozen);
+      EXPECT_EQ(frozen.num_frozen_pattern_assemblies(), step * num_my_elements());
+    }
+
+    // a reset drops the cached pattern but keeps the matrix usable
+    frozen.reset();
+    assemble_chain(frozen, 1.0);
+    EXPECT_NEAR(frozen.norm_frobenius(), reference.norm_frobenius() * 2.0 / 3.0, 1e-12);
+  }
+
+  TEST_F(SparseMatrixTest, FrozenPatternRespectsRowOwnership)
+  {
+    const Epetra_Map rowmap(-1, rows_per_proc_, 0, *comm_);
+    Core::LinAlg::SparseMatrix reference(rowmap, 3, false, true);
+    Core::LinAlg::SparseMatrix frozen(rowmap, 3, false, true);
+
+    assemble_chain(reference, 1.0);
+    assemble_chain(frozen, 1.0);
+
+    // record the element tables with all rows assembled
+    frozen.freeze_pattern();
+    frozen.zero();
+    assemble_chain(frozen, 1.0);
+    ASSERT_EQ(frozen.num_frozen_pattern_assemblies(), num_my_elements());
+
+    // rows that are no longer owned must not be assembled from the cache
+    reference.zero();
+    frozen.zero();
+    assemble_chain(reference, 1.0, false);
+    assemble_chain(frozen, 1.0, false);
+
+    expect_equal_values(reference, frozen);
+    // all elements took the regular path
+    EXPECT_EQ(frozen.num_frozen_pattern_assemblies(), num_my_elements());
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -65,7 +65,8 @@ namespace Core::LinearSolver
     multigrid_muelu_contactsp,  ///< multigrid preconditioner for blocked contact problems in saddle
                                 ///< point formulation (MueLu package)
     multigrid_nxn,  ///< multigrid preconditioner for a nxn block matrix (indirectly MueLu package)
-    block_teko      ///< block preconditioning (Teko package, recommended!)
+    block_teko,     ///< block preconditioning (Teko package, recommended!)
+    chebyshev       ///< Chebyshev polynomial of the Jacobi scaled operator (Ifpack package)
   };
 
   /// linear solver type base class
@@ -15,14 +15,59 @@
 #include <Amesos_Umfpack.h>
 #include <Epetra_LinearProblem.h>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! Whether the filled matrices @p A and @p B have the same sparsity pattern on this process
+  bool have_same_local_pattern(const Epetra_CrsMatrix& A, const Epetra_CrsMatrix& B)
+  {
+    if (not A.RowMap().SameAs(B.RowMap())) return false;
+
+    // matrices built on the same graph share its data
+    if (A.Graph().DataPtr() == B.Graph().DataPtr()) return true;
+
+    bool same = A.ColMap().SameAs(B.ColMap()) and A.NumMyNonzeros() == B.NumMyNonzeros();
+
+    for (int row = 0; same and row < A.NumMyRows(); ++row)
+    {
+      int num_entries_A = 0;
+      int num_entries_B = 0;
+      int* indices_A = nullptr;
+      int* indices_B = nullptr;
+      A.Graph().ExtractMyRowView(row, num_entries_A, indices_A);
+      B.Graph().ExtractMyRowView(row, num_entries_B, indices_B);
+      same = num_entries_A == num_entries_B and
+             std::equal(indices_A, indices_A + num_entries_A, indices_B);
+    }
+
+    return same;
+  }
+
+  //! Copy the values of @p source into @p target, which has the same sparsity pattern
+  void copy_values(const Epetra_CrsMatrix& source, Epetra_CrsMatrix& target)
+  {
+    for (int row = 0; row < source.NumMyRows(); ++row)
+    {
+      int num_entries = 0;
+      double* source_values = nullptr;
+      double* target_values = nullptr;
+      source.ExtractMyRowView(row, num_entries, source_values);
+      target.ExtractMyRowView(row, num_entries, target_values);
+      std::copy(source_values, source_values + num_entries, target_values);
+    }
+  }
+}  // namespace
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 template <class MatrixType, class VectorType>
 Core::LinearSolver::DirectSolver<MatrixType, VectorType>::DirectSolver(std::string solvertype)
     : solvertype_(solvertype),
       factored_(false),
+      symbolic_factored_(false),
       solver_(Teuchos::null),
       reindexer_(Teuchos::null),
       projector_(Teuchos::null)
@@ -66,17 +111,45 @@ void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
 
   x_ = x;
   b_ = b;
-  a_ = crsA;
 
-  // 3. Do a GID reindexing of the overall problem and create the direct solver
-  linear_problem_->SetRHS(b_->get_ptr_of_Epetra_MultiVector().get());
-  linear_problem_->SetLHS(x_->get_ptr_of_Epetra_MultiVector().get());
-  linear_problem_->SetOperator(a_.get());
+  // 3. Reuse the symbolic factorization if the sparsity pattern did not change, otherwise do a GID
+  // reindexing of the overall problem and create the direct solver. The reindexed problem views
+  // the values of a_, so the values of another matrix object with the same pattern are copied
+  // into a_. This must not overwrite a matrix the caller still holds, in that case the solver
+  // switches to a private copy of the matrix once.
+  const bool same_matrix = crsA.get() == a_.get();
+  bool keep_solver = not reindexer_.is_null() and not reset;
+  bool copy_matrix = false;
+  if (keep_solver and refactor)
+  {
+    // the solver is the only owner of a_ after the caller replaced or released its matrix
+    int local[2] = {have_same_local_pattern(*crsA, *a_), same_matrix or a_.strong_count() == 1};
+    int global[2] = {0, 0};
+    crsA->Comm().MinAll(local, global, 2);
+    keep_solver = global[0] and global[1];
+    copy_matrix = global[0] and not global[1];
+  }
 
-  if (not reindexer_.is_null() and not(reset or refactor)) reindexer_->fwd();
+  if (keep_solver)
+  {
+    if (refactor)
+    {
+      if (not same_matrix) copy_values(*crsA, *a_);
+      factored_ = false;
+    }
 
-  if (reset or refactor or not is_factored())
+    linear_problem_->SetRHS(b_->get_ptr_of_Epetra_MultiVector().get());
+    linear_problem_->SetLHS(x_->get_ptr_of_Epetra_MultiVector().get());
+    reindexer_->fwd();
+  }
+  else
   {
+    a_ = copy_matrix ? Teuchos::make_rcp<Epetra_CrsMatrix>(*crsA) : crsA;
+
+    linear_problem_->SetRHS(b_->get_ptr_of_Epetra_MultiVector().get());
+    linear_problem_->SetLHS(x_->get_ptr_of_Epetra_MultiVector().get());
+    linear_problem_->SetOperator(a_.get());
+
     reindexer_ = Teuchos::make_rcp<EpetraExt::LinearProblem_Reindex2>(nullptr);
 
     if (solvertype_ == "umfpack")
@@ -86,6 +159,11 @@ void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
     else if (solvertype_ == "superlu")
     {
       solver_ = Teuchos::make_rcp<Amesos_Superludist>((*reindexer_)(*linear_problem_));
+
+      // refactorizations reuse the fill-reducing ordering and the symbolic factorization
+      Teuchos::ParameterList amesoslist;
+      amesoslist.sublist("Superludist").set("ReuseSymbolic", true);
+      solver_->SetParameters(amesoslist);
     }
     else
     {
@@ -93,6 +171,7 @@ void Core::LinearSolver::DirectSolver<MatrixType, VectorType>::setup(
     }
 
     factored_ = false;
+    symbolic_factored_ = false;
   }
 }
 
@@ -103,7 +182,11 @@ int Core::LinearSolver::DirectSolver<MatrixType, VectorType>::solve()
 {
   if (not is_factored())
   {
-    solver_->SymbolicFactorization();
+    if (not symbolic_factored_)
+    {
+      solver_->SymbolicFactorization();
+      symbolic_factored_ = true;
+    }
     solver_->NumericFactorization();
     factored_ = true;
   }
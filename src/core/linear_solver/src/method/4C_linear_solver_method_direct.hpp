@@ -52,6 +52,9 @@ namespace Core::LinearSolver
     //! flag indicating whether a valid factorization is stored
     bool factored_;
 
+    //! flag indicating whether a valid symbolic factorization is stored
+    bool symbolic_factored_;
+
     //! a linear problem wrapper class used by Trilinos and for scaling of the system
     Teuchos::RCP<Epetra_LinearProblem> linear_problem_;
 
@@ -61,8 +64,15 @@ namespace Core::LinearSolver
     //! right hand side vector
     Teuchos::RCP<VectorType> b_;
 
-    //! system of equations
-    Teuchos::RCP<MatrixType> a_;
+    /*! \brief System matrix the factorization belongs to
+     *
+     * The reindexed linear problem of the amesos solver views the values of this matrix, which
+     * is usually shared with the caller. As long as the sparsity pattern of the system matrix
+     * does not change, the new values are used in place or copied into this matrix and only the
+     * numeric factorization is recomputed. If the caller still holds this matrix but passes
+     * another one, the solver continues with a private copy.
+     */
+    Teuchos::RCP<Epetra_CrsMatrix> a_;
 
     //! an abstract amesos solver that can be any of the amesos concrete implementations
     Teuchos::RCP<Amesos_BaseSolver> solver_;
@@ -8,6 +8,7 @@
 #include "4C_linear_solver_method_iterative.hpp"
 
 #include "4C_linear_solver_amgnxn_preconditioner.hpp"
+#include "4C_linear_solver_preconditioner_chebyshev.hpp"
 #include "4C_linear_solver_preconditioner_ifpack.hpp"
 #include "4C_linear_solver_preconditioner_krylovprojection.hpp"
 #include "4C_linear_solver_preconditioner_muelu.hpp"
@@ -31,6 +32,22 @@ FOUR_C_NAMESPACE_OPEN
 
 using BelosVectorType = Epetra_MultiVector;
 
+//----------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------
+bool Core::LinearSolver::preconditioner_needs_recompute(bool reset, int ncall, int reuse,
+    double iteration_growth, int numiters, int numiters_after_recompute)
+{
+  if (reset or ncall == 0) return true;
+
+  // With an iteration growth factor, the preconditioner is recomputed as soon as it has become
+  // too weak for the current matrix. Then, AZREUSE only limits the number of reuses if given.
+  const bool count_exceeded = reuse ? (ncall % reuse) == 0 : iteration_growth <= 0.0;
+  const bool iterations_exceeded =
+      iteration_growth > 0.0 and numiters > iteration_growth * numiters_after_recompute;
+
+  return count_exceeded or iterations_exceeded;
+}
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 template <class MatrixType, class VectorType>
@@ -166,6 +183,9 @@ int Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::solve()
 
   numiters_ = newSolver->getNumIters();
 
+  // the first solve after a recomputation of the preconditioner is the reference for its quality
+  if (ncall_ == 0) numiters_after_recompute_ = numiters_;
+
   ncall_ += 1;
 
   return 0;
@@ -182,8 +202,10 @@ bool Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::allow_reuse_pr
 
   bool bAllowReuse = linSysParams.get<bool>("reuse preconditioner", true);
 
-  const bool create = reset or not ncall() or not reuse or (ncall() % reuse) == 0;
-  if (create) bAllowReuse = false;
+  const double growth = linSysParams.get<double>("reuse iteration growth", 0.0);
+  if (preconditioner_needs_recompute(
+          reset, ncall(), reuse, growth, numiters_, numiters_after_recompute_))
+    bAllowReuse = false;
 
   // here, each processor has its own local decision made
   // bAllowReuse = true -> preconditioner can be reused
@@ -218,6 +240,11 @@ Core::LinearSolver::IterativeSolver<MatrixType, VectorType>::create_precondition
     preconditioner = Teuchos::make_rcp<Core::LinearSolver::IFPACKPreconditioner>(
         params().sublist("IFPACK Parameters"), solverlist);
   }
+  else if (params().isSublist("Chebyshev Parameters"))
+  {
+    preconditioner = Teuchos::make_rcp<Core::LinearSolver::ChebyshevPreconditioner>(
+        params().sublist("Chebyshev Parameters"));
+  }
   else if (params().isSublist("MueLu Parameters"))
   {
     preconditioner = Teuchos::make_rcp<Core::LinearSolver::MueLuPreconditioner>(params());
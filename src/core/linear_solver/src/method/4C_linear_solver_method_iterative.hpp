@@ -21,6 +21,25 @@ FOUR_C_NAMESPACE_OPEN
 
 namespace Core::LinearSolver
 {
+  /*! \brief Decide whether the preconditioner has to be recomputed before the next solve
+   *
+   * The preconditioner is recomputed if forced by \c reset, before the first solve (\c ncall is
+   * zero), after every \c reuse solves and, with a positive \c iteration_growth, once the last
+   * solve needed more than \c iteration_growth times the iterations of the first solve after the
+   * last recomputation. Without a positive \c iteration_growth, \c reuse equal to zero
+   * recomputes the preconditioner for every solve.
+   *
+   * @param reset Force preconditioner to be rebuilt
+   * @param ncall Number of solves since the last recomputation
+   * @param reuse Parameter AZREUSE from parameter list
+   * @param iteration_growth Parameter AZREUSE_ITERATION_GROWTH from parameter list
+   * @param numiters Number of iterations of the last solve
+   * @param numiters_after_recompute Number of iterations of the first solve after the last
+   * recomputation
+   */
+  bool preconditioner_needs_recompute(bool reset, int ncall, int reuse, double iteration_growth,
+      int numiters, int numiters_after_recompute);
+
   //! krylov subspace linear solvers with right-side preconditioning
   template <class MatrixType, class VectorType>
   class IterativeSolver : public SolverTypeBase<MatrixType, VectorType>
@@ -58,7 +77,9 @@ namespace Core::LinearSolver
      * The user can control reuse/recomputation of the preconditioner by setting appropriate input
      * arguments \c reuse and \c reset. In addition, contact mechanics problems perform some
      * additional checks since they require to rebuild the preconditioner when the active set has
-     * changed.
+     * changed. If an iteration growth factor is given, the preconditioner is also recomputed
+     * once the last solve needed more iterations than this factor times the iterations of the
+     * first solve after the last recomputation.
      *
      * @param[in] reuse Parameter AZREUSE from parameter list
      * @param reset Force preconditioner to be rebuilt
@@ -98,6 +119,9 @@ namespace Core::LinearSolver
     //! number of iterations
     int numiters_{-1};
 
+    //! number of iterations of the first solve after the last recomputation of the preconditioner
+    int numiters_after_recompute_{-1};
+
     //! preconditioner object
     Teuchos::RCP<Core::LinearSolver::PreconditionerTypeBase> preconditioner_;
 
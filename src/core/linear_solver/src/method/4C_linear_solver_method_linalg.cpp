@@ -281,6 +281,7 @@ Teuchos::ParameterList translate_four_c_to_belos(const Teuchos::ParameterList &i
   Teuchos::ParameterList &beloslist = outparams.sublist("Belos Parameters");
 
   beloslist.set("reuse", inparams.get<int>("AZREUSE"));
+  beloslist.set("reuse iteration growth", inparams.get<double>("AZREUSE_ITERATION_GROWTH"));
   beloslist.set("ncall", 0);
 
   // try to get an xml file if possible
@@ -365,6 +366,9 @@ Teuchos::ParameterList translate_four_c_to_belos(const Teuchos::ParameterList &i
     case Core::LinearSolver::PreconditionerType::block_teko:
       beloslist.set("Preconditioner Type", "Teko");
       break;
+    case Core::LinearSolver::PreconditionerType::chebyshev:
+      beloslist.set("Preconditioner Type", "Chebyshev");
+      break;
     default:
       FOUR_C_THROW("Unknown preconditioner for Belos");
       break;
@@ -377,6 +381,15 @@ Teuchos::ParameterList translate_four_c_to_belos(const Teuchos::ParameterList &i
     ifpacklist = translate_four_c_to_ifpack(inparams);
   }
 
+  // set parameters for Chebyshev if used
+  if (azprectyp == Core::LinearSolver::PreconditionerType::chebyshev)
+  {
+    Teuchos::ParameterList &chebyshevlist = outparams.sublist("Chebyshev Parameters");
+    chebyshevlist.set("chebyshev: degree", inparams.get<int>("CHEBYSHEV_DEGREE"));
+    chebyshevlist.set(
+        "chebyshev: ratio eigenvalue", inparams.get<double>("CHEBYSHEV_EIGENVALUE_RATIO"));
+  }
+
   // set parameters for ML if used
   if (azprectyp == Core::LinearSolver::PreconditionerType::multigrid_muelu)
   {
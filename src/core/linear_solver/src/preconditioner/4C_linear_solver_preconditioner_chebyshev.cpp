@@ -0,0 +1,65 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_linear_solver_preconditioner_chebyshev.hpp"
+
+#include "4C_fem_discretization_matrix_free_operator.hpp"
+#include "4C_utils_exceptions.hpp"
+
+#include <Epetra_RowMatrix.h>
+
+FOUR_C_NAMESPACE_OPEN
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+Core::LinearSolver::ChebyshevPreconditioner::ChebyshevPreconditioner(
+    Teuchos::ParameterList& chebyshevlist)
+    : chebyshevlist_(chebyshevlist)
+{
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void Core::LinearSolver::ChebyshevPreconditioner::setup(bool create, Epetra_Operator* matrix,
+    Core::LinAlg::MultiVector<double>* x, Core::LinAlg::MultiVector<double>* b)
+{
+  if (create)
+  {
+    inverse_diagonal_ = Teuchos::make_rcp<Epetra_Vector>(matrix->OperatorRangeMap());
+
+    if (auto* A_mf = dynamic_cast<Core::FE::MatrixFreeOperator*>(matrix))
+      A_mf->extract_diagonal(*inverse_diagonal_);
+    else if (auto* A_row = dynamic_cast<Epetra_RowMatrix*>(matrix))
+      A_row->ExtractDiagonalCopy(*inverse_diagonal_);
+    else
+    {
+      FOUR_C_THROW(
+          "Chebyshev preconditioner needs an Epetra_RowMatrix or a matrix-free operator that "
+          "provides its diagonal.");
+    }
+
+    if (inverse_diagonal_->Reciprocal(*inverse_diagonal_))
+      FOUR_C_THROW("Chebyshev preconditioner: operator has zero diagonal entries.");
+
+    constexpr int num_power_iterations = 10;
+    if (Ifpack_Chebyshev::PowerMethod(
+            *matrix, *inverse_diagonal_, num_power_iterations, lambda_max_))
+      FOUR_C_THROW("Chebyshev preconditioner: estimation of the largest eigenvalue failed.");
+  }
+
+  // Ifpack_Chebyshev only keeps a pointer to the operator, hence it is rebuilt for every operator
+  Teuchos::ParameterList ifpacklist(chebyshevlist_);
+  ifpacklist.set("chebyshev: max eigenvalue", lambda_max_);
+  ifpacklist.set("chebyshev: operator inv diagonal", inverse_diagonal_.get());
+
+  prec_ = Teuchos::make_rcp<Ifpack_Chebyshev>(matrix);
+  prec_->SetParameters(ifpacklist);
+  prec_->Initialize();
+  prec_->Compute();
+}
+
+FOUR_C_NAMESPACE_CLOSE
@@ -0,0 +1,62 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_LINEAR_SOLVER_PRECONDITIONER_CHEBYSHEV_HPP
+#define FOUR_C_LINEAR_SOLVER_PRECONDITIONER_CHEBYSHEV_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_linear_solver_preconditioner_type.hpp"
+
+#include <Epetra_Vector.h>
+#include <Ifpack_Chebyshev.h>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::LinearSolver
+{
+  /*! \brief Chebyshev polynomial preconditioner
+   *
+   *  The Chebyshev polynomial of the Jacobi scaled operator only needs the inverse diagonal and
+   *  the application of the operator. Besides Epetra_RowMatrix objects, it therefore also works
+   *  with a Core::FE::MatrixFreeOperator, whose diagonal is summed up from the element matrices.
+   *
+   *  The largest eigenvalue is estimated by power iterations when the preconditioner is created.
+   *  When the preconditioner is reused, the inverse diagonal and the eigenvalue estimate are kept
+   *  and only the operator is exchanged.
+   */
+  class ChebyshevPreconditioner : public LinearSolver::PreconditionerTypeBase
+  {
+   public:
+    //! Constructor (empty)
+    explicit ChebyshevPreconditioner(Teuchos::ParameterList& chebyshevlist);
+
+    //! Setup
+    void setup(bool create, Epetra_Operator* matrix, Core::LinAlg::MultiVector<double>* x,
+        Core::LinAlg::MultiVector<double>* b) override;
+
+    /// linear operator used for preconditioning
+    Teuchos::RCP<Epetra_Operator> prec_operator() const override { return prec_; }
+
+   private:
+    //! Chebyshev parameter list
+    Teuchos::ParameterList& chebyshevlist_;
+
+    //! inverse of the diagonal of the operator
+    Teuchos::RCP<Epetra_Vector> inverse_diagonal_;
+
+    //! estimate of the largest eigenvalue of the Jacobi scaled operator
+    double lambda_max_ = 0.0;
+
+    //! preconditioner
+    Teuchos::RCP<Ifpack_Chebyshev> prec_;
+  };
+}  // namespace Core::LinearSolver
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
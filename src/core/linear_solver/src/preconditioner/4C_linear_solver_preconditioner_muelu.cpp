@@ -96,6 +96,10 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
       user_param_list.set("Nullspace", nullspace);
       user_param_list.set("Coordinates", coordinates);
 
+      reuse_type_ = muelu_params->isParameter("reuse: type")
+                        ? muelu_params->get<std::string>("reuse: type")
+                        : "none";
+
       H_ = MueLu::CreateXpetraPreconditioner(pmatrix_, *muelu_params);
       P_ = Teuchos::make_rcp<MueLu::EpetraOperator>(H_);
     }
@@ -176,9 +180,38 @@ void Core::LinearSolver::MueLuPreconditioner::setup(bool create, Epetra_Operator
 
       mueLuFactory.SetupHierarchy(*H);
 
+      // blocked hierarchies are not updated when the preconditioner is reused
+      H_ = Teuchos::null;
       P_ = Teuchos::make_rcp<MueLu::EpetraOperator>(H);
     }
   }
+  else if (!H_.is_null() and reuse_type_ != "none")
+  {
+    // Update the existing hierarchy to the current matrix. Depending on the reuse type, MueLu
+    // keeps e.g. the aggregates and transfer operators and only recomputes the coarse level
+    // matrices and the smoothers.
+    Teuchos::RCP<Epetra_CrsMatrix> crsA =
+        Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(Teuchos::rcpFromRef(*matrix));
+    if (crsA.is_null())
+      FOUR_C_THROW(
+          "The MueLu hierarchy can only be reused for an Epetra_CrsMatrix. Use \"reuse: type\" "
+          "\"none\" for block matrices.");
+
+    Teuchos::RCP<Xpetra::CrsMatrix<SC, LO, GO, NO>> mueluA =
+        Teuchos::make_rcp<EpetraCrsMatrix>(crsA);
+
+    if (!mueluA->getRowMap()->isSameAs(*pmatrix_->getRowMap()))
+      FOUR_C_THROW(
+          "The row map of the matrix changed, the MueLu hierarchy cannot be reused. Reset the "
+          "solver to recompute the preconditioner.");
+
+    const int number_of_equations = pmatrix_->GetFixedBlockSize();
+    pmatrix_ = Xpetra::MatrixFactory<SC, LO, GO, NO>::BuildCopy(
+        Teuchos::make_rcp<Xpetra::CrsMatrixWrap<SC, LO, GO, NO>>(mueluA));
+    pmatrix_->SetFixedBlockSize(number_of_equations);
+
+    MueLu::ReuseXpetraPreconditioner(pmatrix_, H_);
+  }
 }
 
 //----------------------------------------------------------------------------------
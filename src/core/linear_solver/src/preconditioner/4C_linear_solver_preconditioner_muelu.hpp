@@ -17,6 +17,8 @@
 #include <MueLu_UseDefaultTypes.hpp>
 #include <Xpetra_MultiVector.hpp>
 
+#include <string>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace Core::LinearSolver
@@ -46,6 +48,11 @@ namespace Core::LinearSolver
      * it re-uses the existing preconditioner and only updates the fine level matrix
      * for the Krylov solver.
      *
+     * If the MueLu parameters specify a "reuse: type" other than "none", a re-used
+     * preconditioner of a single matrix is updated to the current matrix. MueLu then keeps
+     * the parts of the hierarchy given by the reuse type, e.g. the transfer operators for
+     * "RP", and recomputes the coarse level matrices and the smoothers.
+     *
      * It maintains backward compability to the ML interface!
      *
      * @param create Boolean flag to enforce (re-)creation of the preconditioner
@@ -73,6 +80,9 @@ namespace Core::LinearSolver
     //! MueLu hierarchy
     Teuchos::RCP<MueLu::Hierarchy<Scalar, LocalOrdinal, GlobalOrdinal, Node>> H_;
 
+    //! MueLu reuse type of the hierarchy H_, i.e., which parts are kept when it is re-used
+    std::string reuse_type_ = "none";
+
   };  // class MueLuPreconditioner
 
   /*! \brief MueLu preconditioner for blocked linear systems of equations for contact problems
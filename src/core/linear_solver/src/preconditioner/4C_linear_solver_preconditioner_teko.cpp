@@ -20,10 +20,32 @@
 #include <Teko_LU2x2PreconditionerFactory.hpp>
 #include <Teko_StratimikosFactory.hpp>
 #include <Teuchos_XMLParameterListHelpers.hpp>
+#include <Thyra_DefaultLinearOpSource.hpp>
 #include <Xpetra_MultiVectorFactory.hpp>
 
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! whether one of the inverses in the Teko parameters keeps parts of its setup on a rebuild
+  bool has_reusable_inverse(const Teuchos::ParameterList& teko_params)
+  {
+    if (!teko_params.isSublist("Inverse Factory Library")) return false;
+
+    const Teuchos::ParameterList& library = teko_params.sublist("Inverse Factory Library");
+    for (auto it = library.begin(); it != library.end(); ++it)
+    {
+      if (!library.isSublist(library.name(it))) continue;
+
+      const Teuchos::ParameterList& inverse = library.sublist(library.name(it));
+      if (inverse.isParameter("reuse: type") and
+          inverse.get<std::string>("reuse: type") != "none")
+        return true;
+    }
+    return false;
+  }
+}  // namespace
+
 //----------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------
 Core::LinearSolver::TekoPreconditioner::TekoPreconditioner(Teuchos::ParameterList& tekolist)
@@ -50,48 +72,10 @@ void Core::LinearSolver::TekoPreconditioner::setup(bool create, Epetra_Operator*
     auto comm = Core::Communication::to_teuchos_comm<int>(matrix->Comm());
     Teuchos::updateParametersFromXmlFileAndBroadcast(xmlFileName, tekoParams.ptr(), *comm);
 
-    Teuchos::RCP<Core::LinAlg::BlockSparseMatrixBase> A =
-        Teuchos::rcp_dynamic_cast<Core::LinAlg::BlockSparseMatrixBase>(
-            Teuchos::rcpFromRef(*matrix));
-
-    if (A.is_null())
-    {
-      if (tekolist_.sublist("Teko Parameters").isParameter("extractor"))
-      {
-        Teuchos::RCP<Core::LinAlg::MultiMapExtractor> extractor =
-            tekolist_.sublist("Teko Parameters")
-                .get<Teuchos::RCP<Core::LinAlg::MultiMapExtractor>>("extractor");
-
-        auto crsA = Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(Teuchos::rcp(matrix, false));
-        Core::LinAlg::SparseMatrix sparseA = Core::LinAlg::SparseMatrix(crsA, LinAlg::View);
-
-        A = Core::LinAlg::split_matrix<Core::LinAlg::DefaultBlockMatrixStrategy>(
-            sparseA, *extractor, *extractor);
-        A->complete();
-      }
-    }
+    Teuchos::RCP<Core::LinAlg::BlockSparseMatrixBase> A = wrap_matrix(matrix);
 
-    // wrap linear operators
-    if (A.is_null())
+    if (!A.is_null())
     {
-      auto A_crs = Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(Teuchos::rcpFromRef(*matrix));
-      pmatrix_ = Thyra::epetraLinearOp(A_crs);
-    }
-    else
-    {
-      pmatrix_ = Thyra::defaultBlockedLinearOp<double>();
-
-      Teko::toBlockedLinearOp(pmatrix_)->beginBlockFill(A->rows(), A->cols());
-      for (int row = 0; row < A->rows(); row++)
-      {
-        for (int col = 0; col < A->cols(); col++)
-        {
-          auto A_crs = Teuchos::make_rcp<Epetra_CrsMatrix>(*A->matrix(row, col).epetra_matrix());
-          Teko::toBlockedLinearOp(pmatrix_)->setBlock(row, col, Thyra::epetraLinearOp(A_crs));
-        }
-      }
-      Teko::toBlockedLinearOp(pmatrix_)->endBlockFill();
-
       // check if multigrid is used as preconditioner for single field inverse approximation and
       // attach nullspace and coordinate information to the respective inverse parameter list.
       for (int block = 0; block < A->rows(); block++)
@@ -151,14 +135,72 @@ void Core::LinearSolver::TekoPreconditioner::setup(bool create, Epetra_Operator*
     builder.setParameterList(stratimikos_params);
 
     // construct preconditioning operator
-    Teuchos::RCP<Thyra::PreconditionerFactoryBase<double>> precFactory =
-        builder.createPreconditioningStrategy("Teko");
-    Teuchos::RCP<Thyra::PreconditionerBase<double>> prec =
-        Thyra::prec<double>(*precFactory, pmatrix_);
-    Teko::LinearOp inverseOp = prec->getUnspecifiedPrecOp();
+    prec_factory_ = builder.createPreconditioningStrategy("Teko");
+    prec_ = Thyra::prec<double>(*prec_factory_, pmatrix_);
+    Teko::LinearOp inverseOp = prec_->getUnspecifiedPrecOp();
 
     p_ = Teuchos::make_rcp<Teko::Epetra::EpetraInverseOpWrapper>(inverseOp);
+
+    update_on_reuse_ = has_reusable_inverse(*tekoParams);
   }
+  else if (update_on_reuse_)
+  {
+    // Rebuild the existing preconditioner for the current matrix. Inverses with a reuse type,
+    // e.g. MueLu with "reuse: type" = "RP", keep parts of their setup like the transfer operators.
+    wrap_matrix(matrix);
+    prec_factory_->initializePrec(Thyra::defaultLinearOpSource(pmatrix_), prec_.ptr());
+    p_ = Teuchos::make_rcp<Teko::Epetra::EpetraInverseOpWrapper>(prec_->getUnspecifiedPrecOp());
+  }
+}
+
+//----------------------------------------------------------------------------------
+//----------------------------------------------------------------------------------
+Teuchos::RCP<Core::LinAlg::BlockSparseMatrixBase>
+Core::LinearSolver::TekoPreconditioner::wrap_matrix(Epetra_Operator* matrix)
+{
+  Teuchos::RCP<Core::LinAlg::BlockSparseMatrixBase> A =
+      Teuchos::rcp_dynamic_cast<Core::LinAlg::BlockSparseMatrixBase>(Teuchos::rcpFromRef(*matrix));
+
+  if (A.is_null())
+  {
+    if (tekolist_.sublist("Teko Parameters").isParameter("extractor"))
+    {
+      Teuchos::RCP<Core::LinAlg::MultiMapExtractor> extractor =
+          tekolist_.sublist("Teko Parameters")
+              .get<Teuchos::RCP<Core::LinAlg::MultiMapExtractor>>("extractor");
+
+      auto crsA = Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(Teuchos::rcp(matrix, false));
+      Core::LinAlg::SparseMatrix sparseA = Core::LinAlg::SparseMatrix(crsA, LinAlg::View);
+
+      A = Core::LinAlg::split_matrix<Core::LinAlg::DefaultBlockMatrixStrategy>(
+          sparseA, *extractor, *extractor);
+      A->complete();
+    }
+  }
+
+  // wrap linear operators
+  if (A.is_null())
+  {
+    auto A_crs = Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(Teuchos::rcpFromRef(*matrix));
+    pmatrix_ = Thyra::epetraLinearOp(A_crs);
+  }
+  else
+  {
+    pmatrix_ = Thyra::defaultBlockedLinearOp<double>();
+
+    Teko::toBlockedLinearOp(pmatrix_)->beginBlockFill(A->rows(), A->cols());
+    for (int row = 0; row < A->rows(); row++)
+    {
+      for (int col = 0; col < A->cols(); col++)
+      {
+        auto A_crs = Teuchos::make_rcp<Epetra_CrsMatrix>(*A->matrix(row, col).epetra_matrix());
+        Teko::toBlockedLinearOp(pmatrix_)->setBlock(row, col, Thyra::epetraLinearOp(A_crs));
+      }
+    }
+    Teko::toBlockedLinearOp(pmatrix_)->endBlockFill();
+  }
+
+  return A;
 }
 
 //----------------------------------------------------------------------------------
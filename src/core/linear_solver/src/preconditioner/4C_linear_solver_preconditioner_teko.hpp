@@ -15,6 +15,8 @@
 
 #include <MueLu_UseDefaultTypes.hpp>
 #include <Teko_LU2x2Strategy.hpp>
+#include <Thyra_PreconditionerBase.hpp>
+#include <Thyra_PreconditionerFactoryBase.hpp>
 #include <Xpetra_BlockedCrsMatrix.hpp>
 
 FOUR_C_NAMESPACE_OPEN
@@ -40,11 +42,23 @@ namespace Core::LinearSolver
     Teuchos::RCP<Epetra_Operator> prec_operator() const override { return p_; }
 
    private:
+    //! wrap the matrix as Thyra operator pmatrix_ and return its block view if it has one
+    Teuchos::RCP<Core::LinAlg::BlockSparseMatrixBase> wrap_matrix(Epetra_Operator* matrix);
+
     Teuchos::ParameterList& tekolist_;
 
     //! system of equations used for preconditioning used by P_ only
     Teuchos::RCP<const Thyra::LinearOpBase<double>> pmatrix_;
 
+    //! factory of the Teko preconditioner
+    Teuchos::RCP<Thyra::PreconditionerFactoryBase<double>> prec_factory_;
+
+    //! Teko preconditioner, rebuilt by prec_factory_ for a new matrix
+    Teuchos::RCP<Thyra::PreconditionerBase<double>> prec_;
+
+    //! rebuild the preconditioner for the current matrix if it is re-used
+    bool update_on_reuse_ = false;
+
     //! preconditioner
     Teuchos::RCP<Epetra_Operator> p_;
   };
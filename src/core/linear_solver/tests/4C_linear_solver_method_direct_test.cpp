@@ -0,0 +1,127 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_method_direct.hpp"
+
+#include "4C_linalg_multi_vector.hpp"
+
+#include <Epetra_CrsMatrix.h>
+#include <Epetra_Map.h>
+#include <Epetra_MpiComm.h>
+#include <Epetra_MultiVector.h>
+#include <Epetra_Vector.h>
+
+#include <algorithm>
+
+namespace
+{
+  using namespace FourC;
+
+  using DirectSolver =
+      Core::LinearSolver::DirectSolver<Epetra_Operator, Core::LinAlg::MultiVector<double>>;
+
+  class DirectSolverTest : public ::testing::Test
+  {
+   protected:
+    DirectSolverTest() : comm_(MPI_COMM_WORLD), map_(num_rows_, 0, comm_) {}
+
+    //! banded matrix with @p diagonal on the diagonal and -1 on the @p bandwidth off-diagonals
+    Teuchos::RCP<Epetra_CrsMatrix> create_matrix(int bandwidth, double diagonal) const
+    {
+      auto matrix = Teuchos::make_rcp<Epetra_CrsMatrix>(Copy, map_, 2 * bandwidth + 1);
+      for (int lid = 0; lid < map_.NumMyElements(); ++lid)
+      {
+        const int row = map_.GID(lid);
+        for (int column = std::max(0, row - bandwidth);
+            column <= std::min(num_rows_ - 1, row + bandwidth); ++column)
+        {
+          const double value = column == row ? diagonal : -1.0;
+          matrix->InsertGlobalValues(row, 1, &value, &column);
+        }
+      }
+      matrix->FillComplete();
+      return matrix;
+    }
+
+    //! solve with @p matrix and return the maximum residual of the solution
+    double solve(DirectSolver& solver, Teuchos::RCP<Epetra_CrsMatrix> matrix, bool reset) const
+    {
+      auto x = Teuchos::make_rcp<Core::LinAlg::MultiVector<double>>(map_, 1, true);
+      auto b = Teuchos::make_rcp<Core::LinAlg::MultiVector<double>>(map_, 1, true);
+      b->PutScalar(1.0);
+
+      solver.setup(matrix, x, b, true, reset);
+      EXPECT_EQ(solver.solve(), 0);
+
+      Epetra_MultiVector residual(map_, 1, true);
+      matrix->Multiply(false, *x, residual);
+      residual.Update(-1.0, *b, 1.0);
+
+      double norm = 0.0;
+      residual.NormInf(&norm);
+      return norm;
+    }
+
+    static constexpr int num_rows_ = 20;
+    Epetra_MpiComm comm_;
+    Epetra_Map map_;
+  };
+
+  TEST_F(DirectSolverTest, PatternChangesBetweenSolves)
+  {
+    DirectSolver solver("klu");
+
+    EXPECT_LT(solve(solver, create_matrix(1, 4.0), true), 1.0e-12);
+
+    // more entries per row, the symbolic factorization must not be reused
+    EXPECT_LT(solve(solver, create_matrix(2, 6.0), false), 1.0e-12);
+
+    // and back to fewer entries per row
+    EXPECT_LT(solve(solver, create_matrix(1, 3.0), false), 1.0e-12);
+  }
+
+  TEST_F(DirectSolverTest, SameMatrixWithNewValues)
+  {
+    DirectSolver solver("klu");
+    Teuchos::RCP<Epetra_CrsMatrix> matrix = create_matrix(1, 4.0);
+
+    EXPECT_LT(solve(solver, matrix, true), 1.0e-12);
+
+    matrix->Scale(2.0);
+    EXPECT_LT(solve(solver, matrix, false), 1.0e-12);
+  }
+
+  TEST_F(DirectSolverTest, SamePatternDoesNotOverwriteMatrixOfCaller)
+  {
+    DirectSolver solver("klu");
+    Teuchos::RCP<Epetra_CrsMatrix> first = create_matrix(1, 4.0);
+    Teuchos::RCP<Epetra_CrsMatrix> second = create_matrix(1, 5.0);
+
+    EXPECT_LT(solve(solver, first, true), 1.0e-12);
+    EXPECT_LT(solve(solver, second, false), 1.0e-12);
+    EXPECT_LT(solve(solver, create_matrix(1, 6.0), false), 1.0e-12);
+
+    // the matrices still held here keep their values
+    Epetra_Vector diagonal(map_);
+    double min_value = 0.0;
+    double max_value = 0.0;
+
+    first->ExtractDiagonalCopy(diagonal);
+    diagonal.MinValue(&min_value);
+    diagonal.MaxValue(&max_value);
+    EXPECT_EQ(min_value, 4.0);
+    EXPECT_EQ(max_value, 4.0);
+
+    second->ExtractDiagonalCopy(diagonal);
+    diagonal.MinValue(&min_value);
+    diagonal.MaxValue(&max_value);
+    EXPECT_EQ(min_value, 5.0);
+    EXPECT_EQ(max_value, 5.0);
+  }
+}  // namespace
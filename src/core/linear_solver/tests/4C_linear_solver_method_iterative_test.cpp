@@ -0,0 +1,56 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_linear_solver_method_iterative.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  TEST(PreconditionerNeedsRecompute, FirstSolveAndReset)
+  {
+    EXPECT_TRUE(Core::LinearSolver::preconditioner_needs_recompute(false, 0, 10, 2.0, 5, 5));
+    EXPECT_TRUE(Core::LinearSolver::preconditioner_needs_recompute(true, 3, 10, 2.0, 5, 5));
+  }
+
+  TEST(PreconditionerNeedsRecompute, WithoutIterationGrowth)
+  {
+    // AZREUSE = 0 recomputes for every solve
+    EXPECT_TRUE(Core::LinearSolver::preconditioner_needs_recompute(false, 1, 0, 0.0, 5, 5));
+
+    // AZREUSE = 3 recomputes every third solve, independent of the iterations
+    EXPECT_FALSE(Core::LinearSolver::preconditioner_needs_recompute(false, 1, 3, 0.0, 50, 5));
+    EXPECT_FALSE(Core::LinearSolver::preconditioner_needs_recompute(false, 2, 3, 0.0, 50, 5));
+    EXPECT_TRUE(Core::LinearSolver::preconditioner_needs_recompute(false, 3, 3, 0.0, 5, 5));
+  }
+
+  TEST(PreconditionerNeedsRecompute, IterationGrowthAllowsUnlimitedReuse)
+  {
+    for (int ncall = 1; ncall < 100; ++ncall)
+    {
+      EXPECT_FALSE(
+          Core::LinearSolver::preconditioner_needs_recompute(false, ncall, 0, 1.5, 15, 10));
+    }
+  }
+
+  TEST(PreconditionerNeedsRecompute, IterationGrowthTriggersRecompute)
+  {
+    // more than 1.5 times the 10 iterations after the last recomputation
+    EXPECT_TRUE(Core::LinearSolver::preconditioner_needs_recompute(false, 4, 0, 1.5, 16, 10));
+
+    // the growth also triggers before the limit of AZREUSE is reached
+    EXPECT_TRUE(Core::LinearSolver::preconditioner_needs_recompute(false, 4, 10, 1.5, 16, 10));
+    EXPECT_FALSE(Core::LinearSolver::preconditioner_needs_recompute(false, 4, 10, 1.5, 15, 10));
+  }
+
+  TEST(PreconditionerNeedsRecompute, IterationGrowthKeepsReuseLimit)
+  {
+    EXPECT_TRUE(Core::LinearSolver::preconditioner_needs_recompute(false, 10, 10, 1.5, 10, 10));
+  }
+}  // namespace
@@ -15,6 +15,7 @@
 
 #include <Sacado.hpp>
 
+#include <array>
 #include <string>
 #include <utility>
 #include <vector>
@@ -126,6 +127,39 @@ namespace
     return res;
   }
 
+  /// number of arguments x, y, z and t in front of the function variables
+  constexpr int number_of_space_time_arguments = 4;
+
+  /// position of the values of the variables of @p expression in (x, y, z, t, v_1, ..., v_n)
+  std::vector<int> find_argument_positions(
+      const Core::Utils::SymbolicExpression<double>& expression,
+      const std::vector<Teuchos::RCP<Core::Utils::FunctionVariable>>& variables)
+  {
+    const std::array<std::string, number_of_space_time_arguments> space_time_names = {
+        "x", "y", "z", "t"};
+
+    std::vector<int> positions;
+    for (const auto& name : expression.variable_names())
+    {
+      int position = -1;
+      for (int i = 0; i < number_of_space_time_arguments and position < 0; ++i)
+        if (space_time_names[i] == name) position = i;
+      for (int i = 0; i < static_cast<int>(variables.size()) and position < 0; ++i)
+        if (variables[i]->name() == name) position = number_of_space_time_arguments + i;
+      positions.push_back(position);
+    }
+    return positions;
+  }
+
+  /// value of the argument at @p position in (x, y, z, t, v_1, ..., v_n)
+  double argument_value(const int position, const double* x, const double t,
+      const std::vector<Teuchos::RCP<Core::Utils::FunctionVariable>>& variables)
+  {
+    if (position < 3) return x[position];
+    if (position == 3) return t;
+    return variables[position - number_of_space_time_arguments]->value(t);
+  }
+
   /// modifies the component to zero in case the expression is of size one
   std::size_t find_modified_component(const std::size_t component,
       const std::vector<Teuchos::RCP<Core::Utils::SymbolicExpression<double>>>& expr)
@@ -382,6 +416,7 @@ Core::Utils::SymbolicFunctionOfSpaceTime::SymbolicFunctionOfSpaceTime(
           Teuchos::make_rcp<Core::Utils::SymbolicExpression<double>>(expression);
       expr_.push_back(symbolicexpression);
     }
+    argument_positions_.emplace_back(find_argument_positions(*expr_.back(), variables_));
   }
 }
 
@@ -394,25 +429,68 @@ double Core::Utils::SymbolicFunctionOfSpaceTime::evaluate(
     FOUR_C_THROW(
         "There are %d expressions but tried to access component %d", expr_.size(), component);
 
-  // create map for variables
-  std::map<std::string, double> variable_values;
+  const auto& expression = *expr_[component_mod];
+  const auto& positions = argument_positions_[component_mod];
 
-  // set spatial variables
-  variable_values.emplace("x", x[0]);
-  variable_values.emplace("y", x[1]);
-  variable_values.emplace("z", x[2]);
+  // values of the variables in the order of the registers of the expression, most expressions
+  // have only a few variables
+  constexpr std::size_t max_stack_variables = 16;
+  std::array<double, max_stack_variables> stack_values;
+  std::vector<double> heap_values(
+      positions.size() > max_stack_variables ? positions.size() : std::size_t{0});
+  double* variable_values =
+      positions.size() > max_stack_variables ? heap_values.data() : stack_values.data();
 
-  // set temporal variable
-  variable_values.emplace("t", t);
-
-  // set the values of the variables at time t
-  for (const auto& variable : variables_)
+  for (std::size_t i = 0; i < positions.size(); ++i)
   {
-    variable_values.emplace(variable->name(), variable->value(t));
+    if (positions[i] < 0)
+    {
+      FOUR_C_THROW("variable or constant '%s' not given as input in evaluate()",
+          expression.variable_names()[i].c_str());
+    }
+    variable_values[i] = argument_value(positions[i], x, t, variables_);
   }
 
   // evaluate F = F ( x, y, z, t, v1, ..., vn )
-  return expr_[component_mod]->value(variable_values);
+  return expression.value_at(variable_values);
+}
+
+void Core::Utils::SymbolicFunctionOfSpaceTime::evaluate_points(const double* x,
+    const std::size_t num_points, const double t, const std::size_t component, double* result) const
+{
+  std::size_t component_mod = find_modified_component(component, expr_);
+
+  if (component_mod >= expr_.size())
+    FOUR_C_THROW(
+        "There are %d expressions but tried to access component %d", expr_.size(), component);
+
+  const auto& expression = *expr_[component_mod];
+  const auto& positions = argument_positions_[component_mod];
+  const std::size_t num_variables = positions.size();
+
+  // the function variables only depend on time and are evaluated once for all points
+  std::vector<double> time_values(num_variables);
+  for (std::size_t i = 0; i < num_variables; ++i)
+  {
+    if (positions[i] < 0)
+    {
+      FOUR_C_THROW("variable or constant '%s' not given as input in evaluate()",
+          expression.variable_names()[i].c_str());
+    }
+    if (positions[i] >= 3) time_values[i] = argument_value(positions[i], x, t, variables_);
+  }
+
+  std::vector<double> variable_values(num_points * num_variables);
+  for (std::size_t p = 0; p < num_points; ++p)
+  {
+    for (std::size_t i = 0; i < num_variables; ++i)
+    {
+      variable_values[p * num_variables + i] =
+          positions[i] < 3 ? x[3 * p + positions[i]] : time_values[i];
+    }
+  }
+
+  expression.value_at(variable_values.data(), num_points, result);
 }
 
 std::vector<double> Core::Utils::SymbolicFunctionOfSpaceTime::evaluate_spatial_derivative(
@@ -57,6 +57,22 @@ namespace Core::Utils
      */
     virtual double evaluate(const double* x, double t, std::size_t component) const = 0;
 
+    /*!
+     * @brief Evaluation of time and space dependent function at several points
+     *
+     * @param x  (i) The points in 3-dimensional space, the coordinates of point i start at x[3*i]
+     * @param num_points (i) Number of points
+     * @param t  (i) The point in time in which the function will be evaluated
+     * @param component (i) For vector-valued functions, index defines the function-component
+     *                      which should be evaluated
+     * @param result (o) function value at each point
+     */
+    virtual void evaluate_points(const double* x, std::size_t num_points, double t,
+        std::size_t component, double* result) const
+    {
+      for (std::size_t i = 0; i < num_points; ++i) result[i] = evaluate(x + 3 * i, t, component);
+    }
+
     /*!
      * \brief Evaluation of first spatial derivative of time and space dependent function
      *
@@ -121,6 +137,9 @@ namespace Core::Utils
 
     double evaluate(const double* x, double t, std::size_t component) const override;
 
+    void evaluate_points(const double* x, std::size_t num_points, double t, std::size_t component,
+        double* result) const override;
+
     std::vector<double> evaluate_spatial_derivative(
         const double* x, double t, std::size_t component) const override;
 
@@ -133,6 +152,10 @@ namespace Core::Utils
     /// vector of parsed expressions
     std::vector<Teuchos::RCP<Core::Utils::SymbolicExpression<double>>> expr_;
 
+    /// for each expression and each of its variables the position of the value in (x, y, z, t,
+    /// v_1, ..., v_n), -1 if the variable is unknown
+    std::vector<std::vector<int>> argument_positions_;
+
     /// vector of the function variables and all their definitions
     std::vector<Teuchos::RCP<FunctionVariable>> variables_;
   };
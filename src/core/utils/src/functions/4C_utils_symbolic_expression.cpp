@@ -11,6 +11,8 @@
 
 #include <Sacado.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <map>
@@ -18,6 +20,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -170,6 +173,48 @@ namespace Core::Utils::SymbolicExpressionDetails
   };
 
 
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Operations of the compiled expression
+  */
+  enum class OpCode
+  {
+    add,
+    subtract,
+    multiply,
+    divide,
+    power,
+    acos,
+    asin,
+    atan,
+    cos,
+    sin,
+    tan,
+    cosh,
+    sinh,
+    tanh,
+    exp,
+    log,
+    log10,
+    sqrt,
+    atan2,
+    fabs,
+    heaviside
+  };
+
+  /*!
+  \brief Instruction of the compiled expression: registers[result] = op(registers[lhs],
+         registers[rhs]). Unary functions ignore rhs.
+  */
+  struct Instruction
+  {
+    OpCode op;
+    int result;
+    int lhs;
+    int rhs;
+  };
+
+
   /*----------------------------------------------------------------------*/
   /*!
   \brief Parser
@@ -187,20 +232,10 @@ namespace Core::Utils::SymbolicExpressionDetails
     ~Parser() = default;
 
     //! copy constuctor
-    Parser(const Parser& other)
-        : symbolicexpression_{other.symbolicexpression_},
-          expr_{std::make_unique<SyntaxTreeNode<T>>(*other.expr_)},
-          parsed_variable_constant_names_{other.parsed_variable_constant_names_} {};
+    Parser(const Parser& other) = default;
 
     //! copy assignment operator
-    Parser& operator=(const Parser& other)
-    {
-      if (&other == this) return *this;
-      symbolicexpression_ = other.symbolicexpression_;
-      expr_ = std::make_unique<NodePtr>(*other.expr_);
-      parsed_variable_constant_names_ = other.parsed_variable_constant_names_;
-      return *this;
-    };
+    Parser& operator=(const Parser& other) = default;
 
     //! move constructor
     Parser(Parser&& other) noexcept = default;
@@ -217,6 +252,18 @@ namespace Core::Utils::SymbolicExpressionDetails
      */
     T evaluate_expression(const std::map<std::string, T>& variable_values) const;
 
+    /*!
+     * @brief evaluates the parsed expression for variable values given in the order of
+     * variable_names()
+     */
+    T evaluate_expression(const T* variable_values) const;
+
+    /*!
+     * @brief evaluates the parsed expression at @p num_points points, the variable values of point
+     * i start at variable_values[i * variable_names().size()]
+     */
+    void evaluate_expression(const T* variable_values, std::size_t num_points, T* results) const;
+
     /*!
      * @brief evaluates the derivative of the parsed expression with respect to a given set of
      * variables
@@ -235,6 +282,9 @@ namespace Core::Utils::SymbolicExpressionDetails
     //! Check if a variable with name 'varname' exists
     [[nodiscard]] bool is_variable(const std::string& varname) const;
 
+    //! names of all parsed variables in the order of their registers
+    [[nodiscard]] const std::vector<std::string>& variable_names() const { return variable_names_; }
+
    private:
     NodePtr parse_primary(Lexer& lexer);
     NodePtr parse_pow(Lexer& lexer);
@@ -249,23 +299,152 @@ namespace Core::Utils::SymbolicExpressionDetails
     T evaluate(const std::map<std::string, T>& variable_values,
         const std::map<std::string, double>& constants = {}) const;
 
-    //! recursively extract corresponding number out of a syntax tree node
-    T interpret(const SyntaxTreeNode<T>& node) const;
+    /*!
+     * @brief recursively translate a syntax tree node into instructions
+     *
+     * Intermediate results of the node and its children are stored in temporary registers starting
+     * at @p depth. Temporary registers are numbered -1, -2, ... until the whole tree is compiled.
+     *
+     * @return register holding the value of the node
+     */
+    int compile(const SyntaxTreeNode<T>& node, int depth);
+
+    //! append the instruction for @p op, operations on literal numbers are evaluated right away
+    int emit(OpCode op, int lhs, int rhs, int depth);
 
-    //! syntax tree root
-    NodePtr expr_;
+    //! total number of registers needed for the evaluation
+    [[nodiscard]] std::size_t num_registers() const
+    {
+      return variable_names_.size() + constants_.size() + num_temporaries_;
+    }
+
+    //! execute all instructions for @p num_points points, register r of point p is stored at
+    //! registers[r * stride + p]
+    void execute(T* registers, std::size_t stride, std::size_t num_points) const;
 
     //! set of all parsed variables
     std::set<std::string> parsed_variable_constant_names_;
 
-    //! necessary variable values for evaluating the parsed expression
-    mutable const std::map<std::string, T>* variable_values_{nullptr};
+    //! names of all parsed variables, registers 0, 1, ... hold their values
+    std::vector<std::string> variable_names_;
+
+    //! literal numbers, held in the registers behind the variables
+    std::vector<double> constants_;
 
-    //! necessary constant values for evaluating the parsed expression
-    mutable const std::map<std::string, double>* constant_values_{nullptr};
+    //! number of registers for intermediate results, placed behind the constants
+    std::size_t num_temporaries_ = 0;
+
+    //! compiled expression, the instructions are executed in order
+    std::vector<Instruction> instructions_;
+
+    //! register holding the value of the expression after the execution of all instructions
+    int result_ = 0;
   };
 
 
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Apply the operation @p op to @p num_points pairs of operands
+  */
+  template <class T>
+  void apply_operation(
+      OpCode op, T* result, const T* lhs, const T* rhs, const std::size_t num_points)
+  {
+    const auto for_all_points = [&](auto operation)
+    {
+      for (std::size_t p = 0; p < num_points; ++p) result[p] = operation(lhs[p], rhs[p]);
+    };
+
+    switch (op)
+    {
+      case OpCode::add:
+        for_all_points([](const T& a, const T& b) -> T { return a + b; });
+        break;
+      case OpCode::subtract:
+        for_all_points([](const T& a, const T& b) -> T { return a - b; });
+        break;
+      case OpCode::multiply:
+        for_all_points([](const T& a, const T& b) -> T { return a * b; });
+        break;
+      case OpCode::divide:
+        for_all_points([](const T& a, const T& b) -> T { return a / b; });
+        break;
+      case OpCode::power:
+        for_all_points([](const T& a, const T& b) -> T { return std::pow(a, b); });
+        break;
+      case OpCode::acos:
+        for_all_points([](const T& a, const T&) -> T { return acos(a); });
+        break;
+      case OpCode::asin:
+        for_all_points([](const T& a, const T&) -> T { return asin(a); });
+        break;
+      case OpCode::atan:
+        for_all_points([](const T& a, const T&) -> T { return atan(a); });
+        break;
+      case OpCode::cos:
+        for_all_points([](const T& a, const T&) -> T { return cos(a); });
+        break;
+      case OpCode::sin:
+        for_all_points([](const T& a, const T&) -> T { return sin(a); });
+        break;
+      case OpCode::tan:
+        for_all_points([](const T& a, const T&) -> T { return tan(a); });
+        break;
+      case OpCode::cosh:
+        for_all_points([](const T& a, const T&) -> T { return cosh(a); });
+        break;
+      case OpCode::sinh:
+        for_all_points([](const T& a, const T&) -> T { return sinh(a); });
+        break;
+      case OpCode::tanh:
+        for_all_points([](const T& a, const T&) -> T { return tanh(a); });
+        break;
+      case OpCode::exp:
+        for_all_points([](const T& a, const T&) -> T { return exp(a); });
+        break;
+      case OpCode::log:
+        for_all_points([](const T& a, const T&) -> T { return log(a); });
+        break;
+      case OpCode::log10:
+        for_all_points([](const T& a, const T&) -> T { return log10(a); });
+        break;
+      case OpCode::sqrt:
+        for_all_points([](const T& a, const T&) -> T { return sqrt(a); });
+        break;
+      case OpCode::atan2:
+        for_all_points([](const T& a, const T& b) -> T { return atan2(a, b); });
+        break;
+      case OpCode::fabs:
+        for_all_points([](const T& a, const T&) -> T { return fabs(a); });
+        break;
+      case OpCode::heaviside:
+        for_all_points([](const T& a, const T&) -> T { return (a > 0) ? T(1.0) : T(0.0); });
+        break;
+    }
+  }
+
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Call @p function with a register array of the given @p size. Few registers of an
+         arithmetic type are kept on the stack.
+  */
+  template <class T, class Function>
+  auto with_registers(const std::size_t size, Function function)
+  {
+    constexpr std::size_t max_stack_registers = 32;
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+      if (size <= max_stack_registers)
+      {
+        std::array<T, max_stack_registers> registers;
+        return function(registers.data());
+      }
+    }
+    std::vector<T> registers(size);
+    return function(registers.data());
+  }
+
+
   /*======================================================================*/
   /* Lexer methods */
 
@@ -462,7 +641,27 @@ namespace Core::Utils::SymbolicExpressionDetails
     lexer.lexan();
 
     //! create syntax tree equivalent to funct
-    expr_ = parse(lexer);
+    NodePtr expr = parse(lexer);
+
+    //! variables get the first registers, sorted by name
+    variable_names_.assign(
+        parsed_variable_constant_names_.begin(), parsed_variable_constant_names_.end());
+
+    //! translate the syntax tree into a flat list of instructions
+    result_ = compile(*expr, 0);
+
+    //! temporaries are placed behind the variables and literal numbers
+    const auto relocate = [&](int& reg)
+    {
+      if (reg < 0) reg = static_cast<int>(variable_names_.size() + constants_.size()) - reg - 1;
+    };
+    relocate(result_);
+    for (auto& instruction : instructions_)
+    {
+      relocate(instruction.result);
+      relocate(instruction.lhs);
+      relocate(instruction.rhs);
+    }
   }
 
   /*----------------------------------------------------------------------*/
@@ -526,26 +725,89 @@ namespace Core::Utils::SymbolicExpressionDetails
     }
 #endif
 
-    //! safety check if variable_values_ and constant_values_ are nullptr
-    FOUR_C_ASSERT(variable_values_ == nullptr, "Internal error");
-    FOUR_C_ASSERT(constant_values_ == nullptr, "Internal error");
+    return with_registers<T>(num_registers(),
+        [&](T* registers)
+        {
+          for (std::size_t i = 0; i < variable_names_.size(); ++i)
+          {
+            const std::string& name = variable_names_[i];
+            if (auto variable = variable_values.find(name); variable != variable_values.end())
+              registers[i] = variable->second;
+            else if (auto constant = constants.find(name); constant != constants.end())
+              registers[i] = constant->second;
+            else
+              FOUR_C_THROW(
+                  "variable or constant '%s' not given as input in evaluate()", name.c_str());
+          }
+          std::copy(constants_.begin(), constants_.end(), registers + variable_names_.size());
+
+          execute(registers, 1, 1);
 
-    //! set variable values
-    variable_values_ = &variable_values;
-    //! set constant values if map of constants is not empty
-    if (constants.size() != 0) constant_values_ = &constants;
+          return registers[result_];
+        });
+  }
 
-    //! check if function has been parsed
-    FOUR_C_ASSERT(expr_ != nullptr, "Internal error");
 
-    //! evaluate syntax tree of function depending on set variables
-    auto result = this->interpret(*expr_);
+  template <class T>
+  T Parser<T>::evaluate_expression(const T* variable_values) const
+  {
+    return with_registers<T>(num_registers(),
+        [&](T* registers)
+        {
+          std::copy(variable_values, variable_values + variable_names_.size(), registers);
+          std::copy(constants_.begin(), constants_.end(), registers + variable_names_.size());
 
-    //! set variable_values_ and constant_values_ as nullptr again for safety reasons
-    variable_values_ = nullptr;
-    constant_values_ = nullptr;
+          execute(registers, 1, 1);
 
-    return result;
+          return registers[result_];
+        });
+  }
+
+
+  template <class T>
+  void Parser<T>::evaluate_expression(
+      const T* variable_values, const std::size_t num_points, T* results) const
+  {
+    // points are processed in chunks, every instruction is applied to all points of a chunk
+    constexpr std::size_t chunk_size = 64;
+    const std::size_t num_variables = variable_names_.size();
+
+    std::vector<T> registers(num_registers() * chunk_size);
+
+    // literal numbers are never overwritten
+    for (std::size_t c = 0; c < constants_.size(); ++c)
+    {
+      std::fill_n(
+          registers.begin() + (num_variables + c) * chunk_size, chunk_size, T(constants_[c]));
+    }
+
+    for (std::size_t first = 0; first < num_points; first += chunk_size)
+    {
+      const std::size_t num_chunk_points = std::min(chunk_size, num_points - first);
+
+      for (std::size_t p = 0; p < num_chunk_points; ++p)
+      {
+        for (std::size_t v = 0; v < num_variables; ++v)
+          registers[v * chunk_size + p] = variable_values[(first + p) * num_variables + v];
+      }
+
+      execute(registers.data(), chunk_size, num_chunk_points);
+
+      for (std::size_t p = 0; p < num_chunk_points; ++p)
+        results[first + p] = registers[result_ * chunk_size + p];
+    }
+  }
+
+
+  template <class T>
+  void Parser<T>::execute(
+      T* registers, const std::size_t stride, const std::size_t num_points) const
+  {
+    for (const auto& instruction : instructions_)
+    {
+      apply_operation<T>(instruction.op, registers + instruction.result * stride,
+          registers + instruction.lhs * stride, registers + instruction.rhs * stride, num_points);
+    }
   }
 
   /*----------------------------------------------------------------------*/
@@ -797,158 +1059,100 @@ namespace Core::Utils::SymbolicExpressionDetails
 
   /*----------------------------------------------------------------------*/
   /*!
-  \brief Recursively extract corresponding number out of a syntax tree node
+  \brief Recursively translate a syntax tree node into instructions
   */
   template <class T>
-  T Parser<T>::interpret(const SyntaxTreeNode<T>& node) const
+  int Parser<T>::compile(const SyntaxTreeNode<T>& node, const int depth)
   {
-    T res = 0;  // the result
-
     switch (node.type_)
     {
       // literal numbers: leaf of syntax tree node
       case SyntaxTreeNode<T>::lt_number:
-        res = node.v_.number;
-        break;
+        constants_.push_back(node.v_.number);
+        return static_cast<int>(variable_names_.size() + constants_.size() - 1);
+      // independent variables: as set by user
+      case SyntaxTreeNode<T>::lt_variable:
+      {
+        const auto variable =
+            std::lower_bound(variable_names_.begin(), variable_names_.end(), node.variable_);
+        if (variable == variable_names_.end() or *variable != node.variable_)
+          FOUR_C_THROW("unknown variable '%s'", node.variable_.c_str());
+        return static_cast<int>(variable - variable_names_.begin());
+      }
       // binary operators: bifurcating branch of syntax tree node
       case SyntaxTreeNode<T>::lt_operator:
       {
-        T lhs;
-        T rhs;
-
-        // recursively visit branches and obtain sub-results
-        lhs = interpret(*node.lhs_);
-        rhs = interpret(*node.rhs_);
-
-        // evaluate the node operator
+        OpCode op;
         switch (node.v_.op)
         {
           case '+':
-            res = lhs + rhs;
+            op = OpCode::add;
             break;
           case '-':
-            res = lhs - rhs;
+            op = OpCode::subtract;
             break;
           case '*':
-            res = lhs * rhs;
+            op = OpCode::multiply;
             break;
           case '/':
-            /* check for rhs==0.0? */
-            res = lhs / rhs;
+            op = OpCode::divide;
             break;
           case '^':
-            res = std::pow(lhs, rhs);
+            op = OpCode::power;
             break;
           default:
             FOUR_C_THROW("unsupported operator '%c'", node.v_.op);
         }
-        break;
-      }
-      // independent variables: as set by user
-      case SyntaxTreeNode<T>::lt_variable:
-      {
-        if (parsed_variable_constant_names_.count(node.variable_) != 0)
-        {
-          if (constant_values_ == nullptr)
-          {
-            if (variable_values_->find(node.variable_) == variable_values_->end())
-            {
-              FOUR_C_THROW("variable or constant '%s' not given as input in evaluate()",
-                  node.variable_.c_str());
-            }
-            else
-            {
-              res = variable_values_->at(std::string(node.variable_));
-            }
-          }
-          else
-          {
-            if ((variable_values_->find(node.variable_) == variable_values_->end()) &&
-                (constant_values_->find(node.variable_) == constant_values_->end()))
-            {
-              FOUR_C_THROW("variable or constant '%s' not given as input in EvaluateDeriv()",
-                  node.variable_.c_str());
-            }
-            else
-            {
-              if (variable_values_->find(node.variable_) != variable_values_->end())
-              {
-                res = variable_values_->at(node.variable_);
-              }
-              else if (constant_values_->find(node.variable_) != constant_values_->end())
-              {
-                res = constant_values_->at(node.variable_);
-              }
-              else
-                FOUR_C_THROW("Something went really wrong!");
-            }
-          }
-        }
-        else
-          FOUR_C_THROW("unknown variable '%s'", node.variable_.c_str());
-        break;
+
+        // the right hand side must not overwrite the result of the left hand side
+        const int lhs = compile(*node.lhs_, depth);
+        const int rhs = compile(*node.rhs_, depth + 1);
+        return emit(op, lhs, rhs, depth);
       }
       // unary operators
       case SyntaxTreeNode<T>::lt_function:
       {
-        T arg;
-        arg = interpret(*node.lhs_);
-        if (node.function_ == "acos")
-          res = acos(arg);
-        else if (node.function_ == "asin")
-          res = asin(arg);
-        else if (node.function_ == "atan")
-          res = atan(arg);
-        else if (node.function_ == "cos")
-          res = cos(arg);
-        else if (node.function_ == "sin")
-          res = sin(arg);
-        else if (node.function_ == "tan")
-          res = tan(arg);
-        else if (node.function_ == "cosh")
-          res = cosh(arg);
-        else if (node.function_ == "sinh")
-          res = sinh(arg);
-        else if (node.function_ == "tanh")
-          res = tanh(arg);
-        else if (node.function_ == "exp")
-          res = exp(arg);
-        else if (node.function_ == "log")
-          res = log(arg);
-        else if (node.function_ == "log10")
-          res = log10(arg);
-        else if (node.function_ == "sqrt")
-          res = sqrt(arg);
-        else if (node.function_ == "atan2")
-        {
-          T arg2;
-          // recursively visit branches and obtain sub-results
-          arg2 = interpret(*node.rhs_);
-          res = atan2(arg, arg2);
-        }
-        else if (node.function_ == "fabs")
-          res = fabs(arg);
-        else if (node.function_ == "heaviside")
-        {
-          if (arg > 0)
-          {
-            res = 1.0;
-          }
-          else
-          {
-            res = 0.0;
-          }
-        }
-        else
+        static const std::map<std::string, OpCode> functions = {{"acos", OpCode::acos},
+            {"asin", OpCode::asin}, {"atan", OpCode::atan}, {"cos", OpCode::cos},
+            {"sin", OpCode::sin}, {"tan", OpCode::tan}, {"cosh", OpCode::cosh},
+            {"sinh", OpCode::sinh}, {"tanh", OpCode::tanh}, {"exp", OpCode::exp},
+            {"log", OpCode::log}, {"log10", OpCode::log10}, {"sqrt", OpCode::sqrt},
+            {"atan2", OpCode::atan2}, {"fabs", OpCode::fabs}, {"heaviside", OpCode::heaviside}};
+
+        const auto function = functions.find(node.function_);
+        if (function == functions.end())
           FOUR_C_THROW("unknown function_ '%s'", node.function_.c_str());
-        break;
+
+        const int arg = compile(*node.lhs_, depth);
+        const int arg2 = (function->second == OpCode::atan2) ? compile(*node.rhs_, depth + 1) : arg;
+        return emit(function->second, arg, arg2, depth);
       }
       default:
         FOUR_C_THROW("unknown syntax tree node type");
-        break;
     }
+  }
 
-    return res;
+  /*----------------------------------------------------------------------*/
+  /*!
+  \brief Append an instruction or evaluate operations on literal numbers right away
+  */
+  template <class T>
+  int Parser<T>::emit(const OpCode op, const int lhs, const int rhs, const int depth)
+  {
+    const int first_constant = static_cast<int>(variable_names_.size());
+    if (lhs >= first_constant and rhs >= first_constant)
+    {
+      double value;
+      apply_operation<double>(
+          op, &value, &constants_[lhs - first_constant], &constants_[rhs - first_constant], 1);
+      constants_.push_back(value);
+      return static_cast<int>(variable_names_.size() + constants_.size() - 1);
+    }
+
+    const int result = -depth - 1;
+    instructions_.push_back({op, result, lhs, rhs});
+    num_temporaries_ = std::max(num_temporaries_, static_cast<std::size_t>(depth + 1));
+    return result;
   }
 
 }  // namespace Core::Utils::SymbolicExpressionDetails
@@ -976,6 +1180,29 @@ auto Core::Utils::SymbolicExpression<T>::value(
 }
 
 
+template <typename T>
+auto Core::Utils::SymbolicExpression<T>::value_at(const ValueType* variable_values) const
+    -> ValueType
+{
+  return parser_for_value_->evaluate_expression(variable_values);
+}
+
+
+template <typename T>
+void Core::Utils::SymbolicExpression<T>::value_at(
+    const ValueType* variable_values, std::size_t num_points, ValueType* results) const
+{
+  parser_for_value_->evaluate_expression(variable_values, num_points, results);
+}
+
+
+template <typename T>
+const std::vector<std::string>& Core::Utils::SymbolicExpression<T>::variable_names() const
+{
+  return parser_for_value_->variable_names();
+}
+
+
 template <typename T>
 auto Core::Utils::SymbolicExpression<T>::first_derivative(
     std::map<std::string, FirstDerivativeType> variable_values,
@@ -14,10 +14,12 @@
 
 #include <Sacado.hpp>
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -48,6 +50,10 @@ namespace Core::Utils
    * object of the SymbolicExpression instead of creating a new object of that class with the same
    * expression so that the expression only needs to be parsed once.
    *
+   * The expression is compiled into a flat list of instructions on a register array when it is
+   * parsed. Each variable is bound to a fixed register, such that value_at() evaluates the
+   * expression without looking up the variables by name.
+   *
    * @tparam Number: Only an arithmetic type is allowed for template parameter. So far only double
    * is supported.
    */
@@ -96,6 +102,27 @@ namespace Core::Utils
      */
     ValueType value(const std::map<std::string, ValueType>& variable_values) const;
 
+    /*!
+     * @brief evaluates the parsed expression for variable values given in the order of
+     * variable_names()
+     */
+    ValueType value_at(const ValueType* variable_values) const;
+
+    /*!
+     * @brief evaluates the parsed expression at a number of points
+     *
+     * @param[in] variable_values Values of the variables at all points. The values of point i start
+     * at variable_values[i * variable_names().size()] and are given in the order of
+     * variable_names().
+     * @param[in] num_points Number of points
+     * @param[out] results Value of the parsed expression at each point
+     */
+    void value_at(
+        const ValueType* variable_values, std::size_t num_points, ValueType* results) const;
+
+    //! Names of all variables of the parsed expression, sorted alphabetically
+    [[nodiscard]] const std::vector<std::string>& variable_names() const;
+
 
     /*!
      * @brief evaluates the first derivative of the parsed expression with respect to a given set of
@@ -0,0 +1,69 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_utils_function.hpp"
+
+#include "4C_utils_exceptions.hpp"
+#include "4C_utils_functionvariables.hpp"
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace
+{
+  Core::Utils::SymbolicFunctionOfSpaceTime create_function_with_variables()
+  {
+    std::vector<Teuchos::RCP<Core::Utils::FunctionVariable>> variables = {
+        Teuchos::make_rcp<Core::Utils::ParsedFunctionVariable>("a", "2*t"),
+        Teuchos::make_rcp<Core::Utils::ParsedFunctionVariable>("b", "t^2")};
+
+    return Core::Utils::SymbolicFunctionOfSpaceTime(
+        {"2*x + y*z - t", "a * sin(x) + b * z"}, variables);
+  }
+
+  TEST(SymbolicFunctionOfSpaceTimeTest, Evaluate)
+  {
+    const auto function = create_function_with_variables();
+    const std::vector<double> x = {0.5, -1.0, 2.0};
+
+    EXPECT_NEAR(function.evaluate(x.data(), 0.5, 0), -1.5, 1.0e-14);
+    EXPECT_NEAR(function.evaluate(x.data(), 0.5, 1), 0.979425538604203, 1.0e-14);
+  }
+
+  TEST(SymbolicFunctionOfSpaceTimeTest, EvaluatePoints)
+  {
+    const auto function = create_function_with_variables();
+    const std::vector<double> x = {0.5, -1.0, 2.0, 1.5, 0.5, -0.5, -0.3, 2.0, 1.0};
+    const std::vector<std::vector<double>> expected = {
+        {-1.5, 2.25, 0.9}, {0.979425538604203, 0.8724949866040544, -0.045520206661339546}};
+
+    for (std::size_t component = 0; component < 2; ++component)
+    {
+      std::vector<double> results(3);
+      function.evaluate_points(x.data(), 3, 0.5, component, results.data());
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        EXPECT_NEAR(results[i], expected[component][i], 1.0e-14);
+        EXPECT_NEAR(function.evaluate(&x[3 * i], 0.5, component), expected[component][i], 1.0e-14);
+      }
+    }
+  }
+
+  TEST(SymbolicFunctionOfSpaceTimeTest, UnknownVariableThrows)
+  {
+    const Core::Utils::SymbolicFunctionOfSpaceTime function({"x + c"}, {});
+    const std::vector<double> x = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<double> results(2);
+
+    EXPECT_ANY_THROW(function.evaluate(x.data(), 0.0, 0));
+    EXPECT_ANY_THROW(function.evaluate_points(x.data(), 2, 0.0, 0, results.data()));
+  }
+}  // namespace
+
+FOUR_C_NAMESPACE_CLOSE
@@ -129,6 +129,25 @@ namespace
     EXPECT_NEAR(symbolicexpression.value({{"x", 1.0}}), 0.0065831853071795865, 1.0e-14);
   }
 
+  TEST(SymbolicExpressionTest, TestValueAtMatchesValue)
+  {
+    Core::Utils::SymbolicExpression<double> symbolicexpression(
+        "y * sin(x) - 2^x / (1 + heaviside(y - 0.5)) + atan2(y, x) * pi");
+
+    EXPECT_EQ(symbolicexpression.variable_names(), (std::vector<std::string>{"x", "y"}));
+
+    const std::vector<double> points = {0.1, 0.2, 0.7, 1.3, -2.0, 0.5};
+    const std::vector<double> expected = {2.426403499046346, 3.4082702216956, 8.395332519310912};
+    std::vector<double> results(3);
+    symbolicexpression.value_at(points.data(), 3, results.data());
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      EXPECT_NEAR(symbolicexpression.value_at(&points[2 * i]), expected[i], 1.0e-14);
+      EXPECT_NEAR(results[i], expected[i], 1.0e-14);
+    }
+  }
+
   TEST(SymbolicExpressionTest, EvaluateWithMissingVariableThrows)
   {
     Core::Utils::SymbolicExpression<double> symbolicexpression(
@@ -0,0 +1,79 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_CUT_ARENA_HPP
+#define FOUR_C_CUT_ARENA_HPP
+
+#include "4C_config.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Cut
+{
+  /*!
+  \brief Arena for the geometric objects of a cut mesh
+
+  Objects are placed into large memory blocks instead of being allocated one by one. They are
+  never freed individually, but destroyed all together in reverse order of their creation when
+  the arena is released or destroyed. This fits the lifetime of lines, facets and cells, which
+  live exactly as long as the cut mesh that created them.
+
+  The arena is not thread-safe, the owner has to serialize calls to create().
+  */
+  class Arena
+  {
+   public:
+    /// The first block holds @p initial_size bytes, every further block is larger.
+    explicit Arena(std::size_t initial_size = 64 * 1024) : resource_(initial_size) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() { release(); }
+
+    /// Construct a new object of type T in the arena
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      void* memory = resource_.allocate(sizeof(T), alignof(T));
+      T* object = ::new (memory) T(std::forward<Args>(args)...);
+      if constexpr (!std::is_trivially_destructible_v<T>)
+        destructors_.push_back({object, [](void* p) { static_cast<T*>(p)->~T(); }});
+      return object;
+    }
+
+    /// Destroy all objects and return the memory blocks
+    void release()
+    {
+      for (auto i = destructors_.rbegin(); i != destructors_.rend(); ++i) i->destroy(i->object);
+      destructors_.clear();
+      resource_.release();
+    }
+
+   private:
+    struct Destructor
+    {
+      void* object;
+      void (*destroy)(void*);
+    };
+
+    std::pmr::monotonic_buffer_resource resource_;
+
+    std::vector<Destructor> destructors_;
+  };
+}  // namespace Cut
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -11,6 +11,7 @@
 #include "4C_cut_facet_integration.hpp"
 #include "4C_cut_kernel.hpp"
 #include "4C_cut_output.hpp"
+#include "4C_cut_time_monitor.hpp"
 #include "4C_cut_volume_integration.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
@@ -170,7 +171,7 @@ void Cut::DirectDivergence::list_facets(std::vector<plain_facet_set::const_itera
     // consider only facet whose x-direction normal componenet is non-zero
     if (fabs(RefPlaneTemp[0]) > TOL_EQN_PLANE)  // This could give issues with non-planar facets?
     {
-      TEUCHOS_FUNC_TIME_MONITOR("Cut::DirectDivergence::list_facets-tmp1");
+      FOUR_C_CUT_FUNC_TIME_MONITOR("Cut::DirectDivergence::list_facets-tmp1");
 
 #ifdef LOCAL
       if (warpFac.size() > 0)  // if there are warped facets that are not yet processed
@@ -12,6 +12,7 @@
 #include "4C_cut_line_integration.hpp"
 #include "4C_cut_options.hpp"
 #include "4C_cut_side.hpp"
+#include "4C_cut_time_monitor.hpp"
 #include "4C_cut_triangulateFacet.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
@@ -541,7 +542,7 @@ void Cut::FacetIntegration::boundary_facet_integration(
 void Cut::FacetIntegration::divergence_integration_rule(
     Mesh &mesh, Core::FE::CollectedGaussPoints &cgp)
 {
-  TEUCHOS_FUNC_TIME_MONITOR("Cut::FacetIntegration::divergence_integration_rule");
+  FOUR_C_CUT_FUNC_TIME_MONITOR("Cut::FacetIntegration::divergence_integration_rule");
 
   std::list<Teuchos::RCP<BoundaryCell>> divCells;
 
@@ -752,7 +753,7 @@ void Cut::FacetIntegration::temporary_quad4(
 void Cut::FacetIntegration::divergence_integration_rule_new(
     Mesh &mesh, Core::FE::CollectedGaussPoints &cgp)
 {
-  TEUCHOS_FUNC_TIME_MONITOR("Cut::FacetIntegration::divergence_integration_rule");
+  FOUR_C_CUT_FUNC_TIME_MONITOR("Cut::FacetIntegration::divergence_integration_rule");
 
   std::list<Teuchos::RCP<BoundaryCell>> divCells;
 
@@ -14,6 +14,8 @@
 #include "4C_cut_enum.hpp"
 #include "4C_cut_mesh.hpp"
 
+#include <list>
+
 FOUR_C_NAMESPACE_OPEN
 
 // #define DIRECTDIV_EXTENDED_DEBUG_OUTPUT
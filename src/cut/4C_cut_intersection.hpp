@@ -1282,13 +1282,13 @@ namespace Cut
     bool refined_bb_overlap_check(int maxstep = 10);
 
    protected:
-    static Core::LinAlg::Matrix<probdim, num_nodes_edge> xyze_lineElement_;
-    static Core::LinAlg::Matrix<probdim, num_nodes_side> xyze_surfaceElement_;
+    static thread_local Core::LinAlg::Matrix<probdim, num_nodes_edge> xyze_lineElement_;
+    static thread_local Core::LinAlg::Matrix<probdim, num_nodes_side> xyze_surfaceElement_;
 
-    static Core::LinAlg::Matrix<dimedge + dimside, 1> xsi_;
+    static thread_local Core::LinAlg::Matrix<dimedge + dimside, 1> xsi_;
     Core::LinAlg::Matrix<dimside, 1> xsi_side_;
     Core::LinAlg::Matrix<dimedge, 1> xsi_edge_;
-    static Core::LinAlg::Matrix<probdim, 1> x_;
+    static thread_local Core::LinAlg::Matrix<probdim, 1> x_;
 
     std::vector<Core::LinAlg::Matrix<dimside, 1>> multiple_xsi_side_;
     std::vector<Core::LinAlg::Matrix<dimedge, 1>> multiple_xsi_edge_;
@@ -1370,20 +1370,24 @@ namespace Cut
 // static members of intersection base class
 template <unsigned probdim, Core::FE::CellType edgetype, Core::FE::CellType sidetype, bool debug,
     unsigned dimedge, unsigned dimside, unsigned num_nodes_edge, unsigned num_nodes_side>
-Core::LinAlg::Matrix<probdim, num_nodes_edge> Cut::Intersection<probdim, edgetype, sidetype, debug,
-    dimedge, dimside, num_nodes_edge, num_nodes_side>::xyze_lineElement_;
+thread_local Core::LinAlg::Matrix<probdim, num_nodes_edge>
+    Cut::Intersection<probdim, edgetype, sidetype, debug, dimedge, dimside, num_nodes_edge,
+        num_nodes_side>::xyze_lineElement_;
 template <unsigned probdim, Core::FE::CellType edgetype, Core::FE::CellType sidetype, bool debug,
     unsigned dimedge, unsigned dimside, unsigned num_nodes_edge, unsigned num_nodes_side>
-Core::LinAlg::Matrix<probdim, num_nodes_side> Cut::Intersection<probdim, edgetype, sidetype, debug,
-    dimedge, dimside, num_nodes_edge, num_nodes_side>::xyze_surfaceElement_;
+thread_local Core::LinAlg::Matrix<probdim, num_nodes_side>
+    Cut::Intersection<probdim, edgetype, sidetype, debug, dimedge, dimside, num_nodes_edge,
+        num_nodes_side>::xyze_surfaceElement_;
 template <unsigned probdim, Core::FE::CellType edgetype, Core::FE::CellType sidetype, bool debug,
     unsigned dimedge, unsigned dimside, unsigned num_nodes_edge, unsigned num_nodes_side>
-Core::LinAlg::Matrix<dimedge + dimside, 1> Cut::Intersection<probdim, edgetype, sidetype, debug,
-    dimedge, dimside, num_nodes_edge, num_nodes_side>::xsi_;
+thread_local Core::LinAlg::Matrix<dimedge + dimside, 1>
+    Cut::Intersection<probdim, edgetype, sidetype, debug, dimedge, dimside, num_nodes_edge,
+        num_nodes_side>::xsi_;
 template <unsigned probdim, Core::FE::CellType edgetype, Core::FE::CellType sidetype, bool debug,
     unsigned dimedge, unsigned dimside, unsigned num_nodes_edge, unsigned num_nodes_side>
-Core::LinAlg::Matrix<probdim, 1> Cut::Intersection<probdim, edgetype, sidetype, debug, dimedge,
-    dimside, num_nodes_edge, num_nodes_side>::x_;
+thread_local Core::LinAlg::Matrix<probdim, 1>
+    Cut::Intersection<probdim, edgetype, sidetype, debug, dimedge, dimside, num_nodes_edge,
+        num_nodes_side>::x_;
 
 FOUR_C_NAMESPACE_CLOSE
 
@@ -9,6 +9,7 @@
 
 #include "4C_cut_point.hpp"
 #include "4C_cut_position.hpp"
+#include "4C_cut_time_monitor.hpp"
 #include "4C_io_pstream.hpp"
 
 #include <Teuchos_TimeMonitor.hpp>
@@ -432,7 +433,7 @@ vertices ---> so very general and robust
 std::vector<double> Cut::Kernel::eqn_plane_of_polygon(
     const std::vector<std::vector<double>>& vertices)
 {
-  TEUCHOS_FUNC_TIME_MONITOR("Cut::Kernel::EqnPlaneOfPolygon");
+  FOUR_C_CUT_FUNC_TIME_MONITOR("Cut::Kernel::EqnPlaneOfPolygon");
 
   // TODO: improvement by a factor of 4
 
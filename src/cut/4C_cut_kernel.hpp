@@ -11,6 +11,7 @@
 #include "4C_config.hpp"
 
 #include "4C_cut_enum.hpp"
+#include "4C_cut_kernel_double_double.hpp"
 #include "4C_cut_tolerance.hpp"
 #include "4C_cut_utils.hpp"
 #include "4C_fem_general_utils_fem_shapefunctions.hpp"
@@ -19,11 +20,13 @@
 #include "4C_utils_clnwrapper.hpp"
 #include "4C_utils_mathoperations_cln.hpp"
 
+#include <atomic>
 #include <unordered_map>
 
 
 // #define DEBUG_CUTKERNEL_OUTPUT
 #define CUT_CLN_CALC
+// #define CUT_KERNEL_STATISTICS  // count double, double-double and CLN runs of the kernel
 
 
 #ifdef DEBUG_CUTKERNEL_OUTPUT
@@ -39,7 +42,8 @@ namespace Cut::Kernel
 
   bool close_to_zero(const Core::CLN::ClnWrapper& a);
 
-  // Class to collects statistics about runs on double and cln in the cut intersection
+  /* Class to collects statistics about runs on double, double-double and cln in the cut
+   * intersection. The counters are only called if CUT_KERNEL_STATISTICS is defined. */
   class CutKernelStatistics
   {
    public:
@@ -50,24 +54,30 @@ namespace Cut::Kernel
     }
     void double_intersection_counter() { double_int_++; };
     void double_distance_counter() { double_dist_++; };
+    void double_double_intersection_counter() { double_double_int_++; };
+    void double_double_distance_counter() { double_double_dist_++; };
     void cln_intersection_counter() { cln_int_++; };
     void cln_distance_counter() { cln_dist_++; };
     ~CutKernelStatistics()
     {
       std::cout << "\n\n =====================INTERSECTION "
                    "STATISTICS====================================\n\n";
-      std::cout << "During compute intersection " << double_int_ << "/" << double_int_ + cln_int_
-                << " was done on double only " << std::endl;
-      std::cout << "During compute distance     " << double_dist_ << "/" << double_dist_ + cln_dist_
-                << " was done on double only " << std::endl;
+      std::cout << "During compute intersection " << double_int_ << "/"
+                << double_int_ + double_double_int_ + cln_int_ << " was done on double only, "
+                << double_double_int_ << " on double-double" << std::endl;
+      std::cout << "During compute distance     " << double_dist_ << "/"
+                << double_dist_ + double_double_dist_ + cln_dist_ << " was done on double only, "
+                << double_double_dist_ << " on double-double" << std::endl;
     }
 
    private:
     CutKernelStatistics(){/* blank */};
-    unsigned long long int double_int_;
-    unsigned long long int double_dist_;
-    unsigned long long int cln_int_;
-    unsigned long long int cln_dist_;
+    std::atomic<unsigned long long int> double_int_ = 0;
+    std::atomic<unsigned long long int> double_dist_ = 0;
+    std::atomic<unsigned long long int> double_double_int_ = 0;
+    std::atomic<unsigned long long int> double_double_dist_ = 0;
+    std::atomic<unsigned long long int> cln_int_ = 0;
+    std::atomic<unsigned long long int> cln_dist_ = 0;
   };
 
   /// Information about the location of the point on the surface
@@ -962,18 +972,18 @@ namespace Cut::Kernel
   struct ComputePositionStaticMembers
   {
     /// nodal shape function values at the position xsi_
-    static Core::LinAlg::Matrix<num_nodes_element, 1, FloatType> funct_;
+    static thread_local Core::LinAlg::Matrix<num_nodes_element, 1, FloatType> funct_;
     /** nodal first derivative shape function values at the position xsi_ */
-    static Core::LinAlg::Matrix<prob_dim, num_nodes_element, FloatType> deriv1_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, num_nodes_element, FloatType> deriv1_;
 
     /** \brief (extended) jacobian matrix
      *
      *  Keep in mind, that the jacobian has to be extended if dim < probDim! */
-    static Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> A_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> A_;
     /// right hand side vector b_ = -(px_ - x_(xsi_))
-    static Core::LinAlg::Matrix<prob_dim, 1, FloatType> b_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType> b_;
     /// newton increment (extended) parameter space coordinates
-    static Core::LinAlg::Matrix<prob_dim, 1, FloatType> dx_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType> dx_;
   };
 
   // Data storage of ComputePosition data members to inherit from
@@ -1719,7 +1729,7 @@ namespace Cut::Kernel
     PointOnSurfaceLoc location_;
 
     // touched edges ids
-    static std::vector<int> touched_edges_ids_;
+    static thread_local std::vector<int> touched_edges_ids_;
 
     // to hold the reference to cln calculation object
     Core::LinAlg::Matrix<dim, 1>& xsi_;
@@ -1788,7 +1798,7 @@ namespace Cut::Kernel
   struct ComputeDistanceStaticMembers
   {
     /// nodal shape function values at \c xsi
-    static Core::LinAlg::Matrix<num_nodes_side, 1, FloatType> sideFunct_;
+    static thread_local Core::LinAlg::Matrix<num_nodes_side, 1, FloatType> sideFunct_;
 
     /** nodal 1-st derivative values at \c xsi
      *
@@ -1796,7 +1806,7 @@ namespace Cut::Kernel
      *  dimension is \f$ dim \times numNodesSide \f$. The remaining
      *  entries are filled with zeros. This is due to the use of an
      *  UTILS function, which expects this input. */
-    static Core::LinAlg::Matrix<prob_dim, num_nodes_side, FloatType> sideDeriv1_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, num_nodes_side, FloatType> sideDeriv1_;
 
     /** \brief nodal 2-nd derivatives at \c xsi
      *
@@ -1806,25 +1816,26 @@ namespace Cut::Kernel
      *  2-D case: \f$ \left( x_{,\xi \xi}, \;x_{,\eta \eta}, \;
      *                       x_{,\xi\eta} \right)
      *                \;\in \mathbb{R}^{3 \times N} \f$ */
-    static Core::LinAlg::Matrix<2 * dim_side - 1, num_nodes_side, FloatType> sideDeriv2_;
+    static thread_local Core::LinAlg::Matrix<2 * dim_side - 1, num_nodes_side, FloatType>
+        sideDeriv2_;
 
     /// complete linearization matrix
-    static Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> A_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> A_;
     /// auxiliary matrix
-    static Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> B_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> B_;
     /** auxiliary matrix holding 2-nd derivatives at \c xsi_
      *  w.r.t. the parameter space coordinates */
-    static Core::LinAlg::Matrix<prob_dim, 2 * dim_side - 1, FloatType> C_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, 2 * dim_side - 1, FloatType> C_;
     /// right hand side vector
-    static Core::LinAlg::Matrix<prob_dim, 1, FloatType> b_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType> b_;
     /** \brief solution increment
      *
      * (parameter space coordinates of the side + distance increment) */
-    static Core::LinAlg::Matrix<prob_dim, 1, FloatType> dx_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType> dx_;
     /// (unscaled) normal vectors
-    static Core::LinAlg::Matrix<prob_dim, 2, FloatType> N_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, 2, FloatType> N_;
 
-    static Core::LinAlg::Matrix<prob_dim, 2, FloatType> nvec_;  // proper normal vector
+    static thread_local Core::LinAlg::Matrix<prob_dim, 2, FloatType> nvec_;  // proper normal vector
   };
 
   // Static storage class of compute_distance data members to inherit from
@@ -2895,10 +2906,10 @@ namespace Cut::Kernel
     }
 
     // touched edges ids
-    static std::vector<int> touched_edges_ids_;
+    static thread_local std::vector<int> touched_edges_ids_;
 
     // touched edges ids
-    static std::vector<int> touched_nodes_ids_;
+    static thread_local std::vector<int> touched_nodes_ids_;
 
     // variable for cln computation
     Core::LinAlg::Matrix<prob_dim, num_nodes_side, Core::CLN::ClnWrapper> clnxyze_side_;
@@ -2991,10 +3002,14 @@ namespace Cut::Kernel
 
         if (major_fail or result_fail)
         {
-          // CutKernelStatistics::get_cut_kernel_statistics().ClnDistanceCounter();
-
+          // a double solution that is only a few digits short is recovered on double-double,
+          // CLN is left for the degenerate cases
+          if (major_fail or not refine_double_double(xyze_side, px, distance, signeddistance))
 #endif
           {
+#ifdef CUT_KERNEL_STATISTICS
+            CutKernelStatistics::get_cut_kernel_statistics().cln_distance_counter();
+#endif
             ComputeDistanceAdaptivePrecision<
                 NewtonSolve<
                     ComputeDistanceStrategy<false, prob_dim, side_type, dim_side, num_nodes_side,
@@ -3024,7 +3039,9 @@ namespace Cut::Kernel
         }
         else
         {
-          // CutKernelStatistics::get_cut_kernel_statistics().double_distance_counter();
+#ifdef CUT_KERNEL_STATISTICS
+          CutKernelStatistics::get_cut_kernel_statistics().double_distance_counter();
+#endif
         }
 #endif
       }
@@ -3168,6 +3185,35 @@ namespace Cut::Kernel
     }
 
    private:
+    /* Refine the double solution of a point-surface distance in 3D on double-double. Returns
+     * true and updates the solution, the distance and the topology information if the refined
+     * solution meets the same error limit as a double solution. */
+    bool refine_double_double(const Core::LinAlg::Matrix<prob_dim, num_nodes_side>& xyze_side,
+        const Core::LinAlg::Matrix<prob_dim, 1>& px, double& distance, bool signeddistance)
+    {
+      if constexpr (prob_dim == 3 and dim_side == 2 and
+                    DoubleDoubleShapeFunctions<side_type>::available)
+      {
+        const std::pair<bool, double> cond_pair = this->condition_number();
+        if (not cond_pair.first or cond_pair.second > DOUBLE_DOUBLE_LIMIT_CONDITION) return false;
+
+        Core::LinAlg::Matrix<prob_dim, 1> xsi(xsi_ref_);
+        const double residual = refine_distance_double_double<side_type>(xyze_side, px, xsi);
+        if (residual < 0.0 or residual * cond_pair.second > DOUBLE_LIMIT_ERROR) return false;
+
+        xsi_ref_ = xsi;
+        if (not get_topology_information()) return false;
+
+        distance = signeddistance ? this->signed_distance()[0] : this->distance();
+#ifdef CUT_KERNEL_STATISTICS
+        CutKernelStatistics::get_cut_kernel_statistics().double_double_distance_counter();
+#endif
+        return true;
+      }
+      else
+        return false;
+    }
+
     enum PointOnSurfacePlane
     {
       above = 0,
@@ -3223,10 +3269,10 @@ namespace Cut::Kernel
     PointOnSurfaceLoc location_;
 
     // touched edges ids
-    static std::vector<int> touched_edges_ids_;
+    static thread_local std::vector<int> touched_edges_ids_;
 
     // touched nodes id
-    static std::vector<int> touched_nodes_ids_;
+    static thread_local std::vector<int> touched_nodes_ids_;
 
     // determines location of this point, with extended tolerance over side, that is shared for
     // another triangle (only for tri3)
@@ -3299,18 +3345,19 @@ namespace Cut::Kernel
       unsigned num_nodes_side = Core::FE::num_nodes<side_type>, typename FloatType = double>
   struct ComputeIntersectionStaticMembers
   {
-    static Core::LinAlg::Matrix<num_nodes_side, 1, FloatType> sideFunct_;
-    static Core::LinAlg::Matrix<num_nodes_edge, 1, FloatType> edgeFunct_;
-    static Core::LinAlg::Matrix<dim_side, num_nodes_side, FloatType> sideDeriv1_;
-    static Core::LinAlg::Matrix<dim_edge, num_nodes_edge, FloatType> edgeDeriv1_;
+    static thread_local Core::LinAlg::Matrix<num_nodes_side, 1, FloatType> sideFunct_;
+    static thread_local Core::LinAlg::Matrix<num_nodes_edge, 1, FloatType> edgeFunct_;
+    static thread_local Core::LinAlg::Matrix<dim_side, num_nodes_side, FloatType> sideDeriv1_;
+    static thread_local Core::LinAlg::Matrix<dim_edge, num_nodes_edge, FloatType> edgeDeriv1_;
 
-    static Core::LinAlg::Matrix<dim_edge + dim_side, dim_edge + dim_side, FloatType> A_;
-    static Core::LinAlg::Matrix<prob_dim, dim_edge + dim_side, FloatType> B_;
-    static Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType> b_;
-    static Core::LinAlg::Matrix<prob_dim, 1, FloatType> c_;
+    static thread_local Core::LinAlg::Matrix<dim_edge + dim_side, dim_edge + dim_side, FloatType>
+        A_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, dim_edge + dim_side, FloatType> B_;
+    static thread_local Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType> b_;
+    static thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType> c_;
 
     /// increment in local coordinates d(xi1_side, xi2_side, xi_line)
-    static Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType> dx_;
+    static thread_local Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType> dx_;
   };
 
 
@@ -4306,7 +4353,7 @@ namespace Cut::Kernel
 #endif
     }
 
-    static std::vector<int> touched_edges_ids_;
+    static thread_local std::vector<int> touched_edges_ids_;
 
     Core::LinAlg::Matrix<prob_dim, num_nodes_side, Core::CLN::ClnWrapper> clnxyze_side_;
 
@@ -4380,9 +4427,14 @@ namespace Cut::Kernel
 
         if (major_fail or result_fail)
         {
-//             CutKernelStatistics::get_cut_kernel_statistics().cln_intersection_counter();
+          // a double solution that is only a few digits short is recovered on double-double,
+          // CLN is left for the degenerate cases
+          if (major_fail or not refine_double_double(xyze_side, xyze_edge))
 #endif
           {
+#ifdef CUT_KERNEL_STATISTICS
+            CutKernelStatistics::get_cut_kernel_statistics().cln_intersection_counter();
+#endif
             ComputeIntersectionAdaptivePrecision<
                 NewtonSolve<ComputeIntersectionStrategy<false, prob_dim, edge_type, side_type,
                                 dim_edge, dim_side, num_nodes_edge, num_nodes_side,
@@ -4411,7 +4463,9 @@ namespace Cut::Kernel
         }
         else
         {
-          //             CutKernelStatistics::get_cut_kernel_statistics().double_intersection_counter();
+#ifdef CUT_KERNEL_STATISTICS
+          CutKernelStatistics::get_cut_kernel_statistics().double_intersection_counter();
+#endif
         }
 #endif
       }
@@ -4492,6 +4546,36 @@ namespace Cut::Kernel
     }
 
    private:
+    /* Refine the double solution of an edge-side intersection in 3D on double-double. Returns
+     * true and updates the solution and its topology information if the refined solution meets
+     * the same error limit as a double solution. */
+    bool refine_double_double(const Core::LinAlg::Matrix<prob_dim, num_nodes_side>& xyze_side,
+        const Core::LinAlg::Matrix<prob_dim, num_nodes_edge>& xyze_edge)
+    {
+      if constexpr (prob_dim == 3 and dim_edge + dim_side == prob_dim and
+                    DoubleDoubleShapeFunctions<edge_type>::available and
+                    DoubleDoubleShapeFunctions<side_type>::available)
+      {
+        const std::pair<bool, double> cond_pair = this->condition_number();
+        if (not cond_pair.first or cond_pair.second > DOUBLE_DOUBLE_LIMIT_CONDITION) return false;
+
+        Core::LinAlg::Matrix<prob_dim, 1> xsi(xsi_);
+        const double residual =
+            refine_intersection_double_double<edge_type, side_type>(xyze_side, xyze_edge, xsi);
+        if (residual < 0.0 or residual * cond_pair.second > DOUBLE_LIMIT_ERROR) return false;
+
+        xsi_ = xsi;
+        if (not get_topology_information()) return false;
+
+#ifdef CUT_KERNEL_STATISTICS
+        CutKernelStatistics::get_cut_kernel_statistics().double_double_intersection_counter();
+#endif
+        return true;
+      }
+      else
+        return false;
+    }
+
     // Get local tolerance and based on it get location of the point on the surface
     // as well as touched edges
     bool get_topology_information()
@@ -4580,7 +4664,7 @@ namespace Cut::Kernel
     }
 
     // touched edges ids
-    static std::vector<int> touched_edges_ids_;
+    static thread_local std::vector<int> touched_edges_ids_;
 
     // determines location of this point with respect to the edge that cuts it
     PointOnSurfaceLoc side_location_;
@@ -4673,123 +4757,135 @@ namespace Cut::Kernel
 // in compute position strategy
 template <bool debug, unsigned prob_dim, Core::FE::CellType element_type,
     unsigned num_nodes_element, unsigned dim, typename FloatType>
-Core::LinAlg::Matrix<num_nodes_element, 1, FloatType> Cut::Kernel::ComputePositionStaticMembers<
-    debug, prob_dim, element_type, num_nodes_element, dim, FloatType>::funct_;
+thread_local Core::LinAlg::Matrix<num_nodes_element, 1, FloatType>
+    Cut::Kernel::ComputePositionStaticMembers<debug, prob_dim, element_type, num_nodes_element, dim,
+        FloatType>::funct_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType element_type,
     unsigned num_nodes_element, unsigned dim, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, num_nodes_element, FloatType>
+thread_local Core::LinAlg::Matrix<prob_dim, num_nodes_element, FloatType>
     Cut::Kernel::ComputePositionStaticMembers<debug, prob_dim, element_type, num_nodes_element, dim,
         FloatType>::deriv1_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType element_type,
     unsigned num_nodes_element, unsigned dim, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> Cut::Kernel::ComputePositionStaticMembers<debug,
-    prob_dim, element_type, num_nodes_element, dim, FloatType>::A_;
+thread_local Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType>
+    Cut::Kernel::ComputePositionStaticMembers<debug, prob_dim, element_type, num_nodes_element, dim,
+        FloatType>::A_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType element_type,
     unsigned num_nodes_element, unsigned dim, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 1, FloatType> Cut::Kernel::ComputePositionStaticMembers<debug,
-    prob_dim, element_type, num_nodes_element, dim, FloatType>::b_;
+thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType>
+    Cut::Kernel::ComputePositionStaticMembers<debug, prob_dim, element_type, num_nodes_element, dim,
+        FloatType>::b_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType element_type,
     unsigned num_nodes_element, unsigned dim, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 1, FloatType> Cut::Kernel::ComputePositionStaticMembers<debug,
-    prob_dim, element_type, num_nodes_element, dim, FloatType>::dx_;
+thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType>
+    Cut::Kernel::ComputePositionStaticMembers<debug, prob_dim, element_type, num_nodes_element, dim,
+        FloatType>::dx_;
 
 // in compute distance strategy
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<num_nodes_side, 1, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<debug,
-    prob_dim, side_type, dim_side, num_nodes_side, FloatType>::sideFunct_;
+thread_local Core::LinAlg::Matrix<num_nodes_side, 1, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::sideFunct_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, num_nodes_side, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<
-    debug, prob_dim, side_type, dim_side, num_nodes_side, FloatType>::sideDeriv1_;
+thread_local Core::LinAlg::Matrix<prob_dim, num_nodes_side, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::sideDeriv1_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<2 * dim_side - 1, num_nodes_side, FloatType>
+thread_local Core::LinAlg::Matrix<2 * dim_side - 1, num_nodes_side, FloatType>
     Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
         FloatType>::sideDeriv2_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<debug,
-    prob_dim, side_type, dim_side, num_nodes_side, FloatType>::A_;
+thread_local Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::A_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<debug,
-    prob_dim, side_type, dim_side, num_nodes_side, FloatType>::B_;
+thread_local Core::LinAlg::Matrix<prob_dim, prob_dim, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::B_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 2 * dim_side - 1, FloatType>
+thread_local Core::LinAlg::Matrix<prob_dim, 2 * dim_side - 1, FloatType>
     Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
         FloatType>::C_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 1, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<debug,
-    prob_dim, side_type, dim_side, num_nodes_side, FloatType>::b_;
+thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::b_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 1, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<debug,
-    prob_dim, side_type, dim_side, num_nodes_side, FloatType>::dx_;
+thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::dx_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 2, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<debug,
-    prob_dim, side_type, dim_side, num_nodes_side, FloatType>::N_;
+thread_local Core::LinAlg::Matrix<prob_dim, 2, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::N_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side, typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 2, FloatType> Cut::Kernel::ComputeDistanceStaticMembers<debug,
-    prob_dim, side_type, dim_side, num_nodes_side, FloatType>::nvec_;
+thread_local Core::LinAlg::Matrix<prob_dim, 2, FloatType>
+    Cut::Kernel::ComputeDistanceStaticMembers<debug, prob_dim, side_type, dim_side, num_nodes_side,
+        FloatType>::nvec_;
 
 // in compute intersection strategy
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<num_nodes_side, 1, FloatType>
+thread_local Core::LinAlg::Matrix<num_nodes_side, 1, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::sideFunct_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<num_nodes_edge, 1, FloatType>
+thread_local Core::LinAlg::Matrix<num_nodes_edge, 1, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::edgeFunct_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<dim_side, num_nodes_side, FloatType>
+thread_local Core::LinAlg::Matrix<dim_side, num_nodes_side, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::sideDeriv1_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<dim_edge, num_nodes_edge, FloatType>
+thread_local Core::LinAlg::Matrix<dim_edge, num_nodes_edge, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::edgeDeriv1_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<dim_edge + dim_side, dim_edge + dim_side, FloatType>
+thread_local Core::LinAlg::Matrix<dim_edge + dim_side, dim_edge + dim_side, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::A_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<prob_dim, dim_edge + dim_side, FloatType>
+thread_local Core::LinAlg::Matrix<prob_dim, dim_edge + dim_side, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::B_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType>
+thread_local Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::b_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<prob_dim, 1, FloatType>
+thread_local Core::LinAlg::Matrix<prob_dim, 1, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::c_;
 template <bool debug, unsigned prob_dim, Core::FE::CellType edge_type, Core::FE::CellType side_type,
     unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge, unsigned num_nodes_side,
     typename FloatType>
-Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType>
+thread_local Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType>
     Cut::Kernel::ComputeIntersectionStaticMembers<debug, prob_dim, edge_type, side_type, dim_edge,
         dim_side, num_nodes_edge, num_nodes_side, FloatType>::dx_;
 
@@ -4798,26 +4894,30 @@ Core::LinAlg::Matrix<dim_edge + dim_side, 1, FloatType>
 template <class Strategy, unsigned prob_dim, Core::FE::CellType edge_type,
     Core::FE::CellType side_type, bool compute_cln, unsigned dim_edge, unsigned dim_side,
     unsigned num_nodes_edge, unsigned num_nodes_side>
-std::vector<int> Cut::Kernel::GenericComputeIntersection<Strategy, prob_dim, edge_type, side_type,
-    compute_cln, dim_edge, dim_side, num_nodes_edge, num_nodes_side>::touched_edges_ids_;
+thread_local std::vector<int>
+    Cut::Kernel::GenericComputeIntersection<Strategy, prob_dim, edge_type, side_type, compute_cln,
+        dim_edge, dim_side, num_nodes_edge, num_nodes_side>::touched_edges_ids_;
 
 // for generic compute distance
 template <class Strategy, unsigned prob_dim, Core::FE::CellType side_type, bool compute_cln,
     unsigned dim_side, unsigned num_nodes_side>
-std::vector<int> Cut::Kernel::GenericComputeDistance<Strategy, prob_dim, side_type, compute_cln,
-    dim_side, num_nodes_side>::touched_edges_ids_;
+thread_local std::vector<int>
+    Cut::Kernel::GenericComputeDistance<Strategy, prob_dim, side_type, compute_cln, dim_side,
+        num_nodes_side>::touched_edges_ids_;
 
 template <class Strategy, unsigned prob_dim, Core::FE::CellType side_type, bool compute_cln,
     unsigned dim_side, unsigned num_nodes_side>
-std::vector<int> Cut::Kernel::GenericComputeDistance<Strategy, prob_dim, side_type, compute_cln,
-    dim_side, num_nodes_side>::touched_nodes_ids_;
+thread_local std::vector<int>
+    Cut::Kernel::GenericComputeDistance<Strategy, prob_dim, side_type, compute_cln, dim_side,
+        num_nodes_side>::touched_nodes_ids_;
 
 #ifdef CUT_CLN_CALC
 // for generic compute position
 template <class Strategy, unsigned prob_dim, Core::FE::CellType element_type, bool compute_cln,
     unsigned num_nodes_element, unsigned dim>
-std::vector<int> Cut::Kernel::GenericComputePosition<Strategy, prob_dim, element_type, compute_cln,
-    num_nodes_element, dim>::touched_edges_ids_;
+thread_local std::vector<int>
+    Cut::Kernel::GenericComputePosition<Strategy, prob_dim, element_type, compute_cln,
+        num_nodes_element, dim>::touched_edges_ids_;
 #endif
 
 
@@ -4841,12 +4941,14 @@ size_t Cut::Kernel::ComputePositionAdaptivePrecision<Strategy, prob_dim, element
 
 template <class Strategy, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side>
-std::vector<int> Cut::Kernel::ComputeDistanceAdaptivePrecision<Strategy, prob_dim, side_type,
-    dim_side, num_nodes_side>::touched_edges_ids_;
+thread_local std::vector<int>
+    Cut::Kernel::ComputeDistanceAdaptivePrecision<Strategy, prob_dim, side_type, dim_side,
+        num_nodes_side>::touched_edges_ids_;
 template <class Strategy, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side>
-std::vector<int> Cut::Kernel::ComputeDistanceAdaptivePrecision<Strategy, prob_dim, side_type,
-    dim_side, num_nodes_side>::touched_nodes_ids_;
+thread_local std::vector<int>
+    Cut::Kernel::ComputeDistanceAdaptivePrecision<Strategy, prob_dim, side_type, dim_side,
+        num_nodes_side>::touched_nodes_ids_;
 template <class Strategy, unsigned prob_dim, Core::FE::CellType side_type, unsigned dim_side,
     unsigned num_nodes_side>
 bool Cut::Kernel::ComputeDistanceAdaptivePrecision<Strategy, prob_dim, side_type, dim_side,
@@ -4861,8 +4963,9 @@ size_t Cut::Kernel::ComputeDistanceAdaptivePrecision<Strategy, prob_dim, side_ty
 template <class Strategy, unsigned prob_dim, Core::FE::CellType edge_type,
     Core::FE::CellType side_type, unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge,
     unsigned num_nodes_side>
-std::vector<int> Cut::Kernel::ComputeIntersectionAdaptivePrecision<Strategy, prob_dim, edge_type,
-    side_type, dim_edge, dim_side, num_nodes_edge, num_nodes_side>::touched_edges_ids_;
+thread_local std::vector<int>
+    Cut::Kernel::ComputeIntersectionAdaptivePrecision<Strategy, prob_dim, edge_type, side_type,
+        dim_edge, dim_side, num_nodes_edge, num_nodes_side>::touched_edges_ids_;
 
 template <class Strategy, unsigned prob_dim, Core::FE::CellType edge_type,
     Core::FE::CellType side_type, unsigned dim_edge, unsigned dim_side, unsigned num_nodes_edge,
@@ -0,0 +1,321 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_CUT_KERNEL_DOUBLE_DOUBLE_HPP
+#define FOUR_C_CUT_KERNEL_DOUBLE_DOUBLE_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_fem_general_cell_type_traits.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_linalg_gauss_templates.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Cut::Kernel
+{
+  /*!
+  \brief Double-double number
+
+  The value is the unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi) / 2, which gives
+  about 32 significant decimal digits. Sums and products are built from error-free
+  transformations of double operations. This is a lot cheaper than CLN, but only correct as long
+  as the compiler does not reassociate floating point operations (no -ffast-math).
+  */
+  struct DoubleDouble
+  {
+    DoubleDouble() = default;
+
+    DoubleDouble(double a) : hi(a) {}
+
+    DoubleDouble(double h, double l) : hi(h), lo(l) {}
+
+    double hi = 0.0;
+    double lo = 0.0;
+  };
+
+  namespace DoubleDoubleArithmetic
+  {
+    //! s + e = a + b exactly
+    inline DoubleDouble two_sum(double a, double b)
+    {
+      const double s = a + b;
+      const double bb = s - a;
+      return {s, (a - (s - bb)) + (b - bb)};
+    }
+
+    //! s + e = a + b exactly, requires |a| >= |b|
+    inline DoubleDouble quick_two_sum(double a, double b)
+    {
+      const double s = a + b;
+      return {s, b - (s - a)};
+    }
+
+    //! p + e = a * b exactly
+    inline DoubleDouble two_prod(double a, double b)
+    {
+      const double p = a * b;
+      return {p, std::fma(a, b, -p)};
+    }
+  }  // namespace DoubleDoubleArithmetic
+
+  inline DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    using namespace DoubleDoubleArithmetic;
+    DoubleDouble s = two_sum(a.hi, b.hi);
+    const DoubleDouble t = two_sum(a.lo, b.lo);
+    s = quick_two_sum(s.hi, s.lo + t.hi);
+    return quick_two_sum(s.hi, s.lo + t.lo);
+  }
+
+  inline DoubleDouble operator-(const DoubleDouble& a) { return {-a.hi, -a.lo}; }
+
+  inline DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) { return a + (-b); }
+
+  inline DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b)
+  {
+    using namespace DoubleDoubleArithmetic;
+    const DoubleDouble p = two_prod(a.hi, b.hi);
+    return quick_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+  }
+
+  /*!
+  \brief Shape functions and first derivatives of linear cells on double-double
+
+  Only the cells that are evaluated by the double-double refinement of the cut kernel are
+  implemented. The derivatives are stored as deriv1[direction][node], the constant mixed second
+  derivatives of the 2D cells as deriv2_rs[node].
+  */
+  template <Core::FE::CellType cell_type>
+  struct DoubleDoubleShapeFunctions
+  {
+    static constexpr bool available = false;
+  };
+
+  template <>
+  struct DoubleDoubleShapeFunctions<Core::FE::CellType::line2>
+  {
+    static constexpr bool available = true;
+
+    static void evaluate(const DoubleDouble* xsi, std::array<DoubleDouble, 2>& funct,
+        std::array<std::array<DoubleDouble, 2>, 1>& deriv1)
+    {
+      const DoubleDouble& r = xsi[0];
+      funct = {0.5 * (1.0 - r), 0.5 * (1.0 + r)};
+      deriv1[0] = {-0.5, 0.5};
+    }
+  };
+
+  template <>
+  struct DoubleDoubleShapeFunctions<Core::FE::CellType::tri3>
+  {
+    static constexpr bool available = true;
+
+    static void evaluate(const DoubleDouble* xsi, std::array<DoubleDouble, 3>& funct,
+        std::array<std::array<DoubleDouble, 3>, 2>& deriv1)
+    {
+      const DoubleDouble& r = xsi[0];
+      const DoubleDouble& s = xsi[1];
+      funct = {1.0 - r - s, r, s};
+      deriv1[0] = {-1.0, 1.0, 0.0};
+      deriv1[1] = {-1.0, 0.0, 1.0};
+    }
+
+    static constexpr std::array<double, 3> deriv2_rs = {0.0, 0.0, 0.0};
+  };
+
+  template <>
+  struct DoubleDoubleShapeFunctions<Core::FE::CellType::quad4>
+  {
+    static constexpr bool available = true;
+
+    static void evaluate(const DoubleDouble* xsi, std::array<DoubleDouble, 4>& funct,
+        std::array<std::array<DoubleDouble, 4>, 2>& deriv1)
+    {
+      const DoubleDouble rp = 1.0 + xsi[0];
+      const DoubleDouble rm = 1.0 - xsi[0];
+      const DoubleDouble sp = 1.0 + xsi[1];
+      const DoubleDouble sm = 1.0 - xsi[1];
+      funct = {0.25 * rm * sm, 0.25 * rp * sm, 0.25 * rp * sp, 0.25 * rm * sp};
+      deriv1[0] = {-0.25 * sm, 0.25 * sm, 0.25 * sp, -0.25 * sp};
+      deriv1[1] = {-0.25 * rm, -0.25 * rp, 0.25 * rp, 0.25 * rm};
+    }
+
+    static constexpr std::array<double, 4> deriv2_rs = {0.25, -0.25, 0.25, -0.25};
+  };
+
+  namespace DoubleDoubleArithmetic
+  {
+    //! Interpolate the nodal coordinates @p xyze and their derivatives at @p xsi
+    template <Core::FE::CellType cell_type, unsigned num_nodes = Core::FE::num_nodes<cell_type>,
+        std::size_t dim = Core::FE::dim<cell_type>>
+    void interpolate(const Core::LinAlg::Matrix<3, num_nodes>& xyze, const DoubleDouble* xsi,
+        std::array<DoubleDouble, 3>& x, std::array<std::array<DoubleDouble, 3>, dim>& dx)
+    {
+      std::array<DoubleDouble, num_nodes> funct;
+      std::array<std::array<DoubleDouble, num_nodes>, dim> deriv1;
+      DoubleDoubleShapeFunctions<cell_type>::evaluate(xsi, funct, deriv1);
+
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        x[i] = 0.0;
+        for (unsigned d = 0; d < dim; ++d) dx[d][i] = 0.0;
+        for (unsigned k = 0; k < num_nodes; ++k)
+        {
+          x[i] = x[i] + xyze(i, k) * funct[k];
+          for (unsigned d = 0; d < dim; ++d) dx[d][i] = dx[d][i] + xyze(i, k) * deriv1[d][k];
+        }
+      }
+    }
+
+    inline std::array<DoubleDouble, 3> cross(
+        const std::array<DoubleDouble, 3>& a, const std::array<DoubleDouble, 3>& b)
+    {
+      return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+
+    inline double norm2(const std::array<DoubleDouble, 3>& a)
+    {
+      return std::sqrt(a[0].hi * a[0].hi + a[1].hi * a[1].hi + a[2].hi * a[2].hi);
+    }
+  }  // namespace DoubleDoubleArithmetic
+
+  /*!
+  \brief Refine the intersection of an edge and a side in 3D by Newton steps on double-double
+
+  Starting from the double solution @p xsi = (xsi_side, xsi_edge), the residual
+  x_edge(xsi_edge) - x_side(xsi_side) and the solution are kept in double-double, while the
+  Jacobian is solved on double. Since the double solution is already close, a few steps reach
+  about double-double accuracy as long as the problem is not close to singular.
+
+  \return l2-norm of the residual at the refined @p xsi, or a negative value if the Jacobian is
+  singular
+  */
+  template <Core::FE::CellType edge_type, Core::FE::CellType side_type,
+      unsigned num_nodes_edge = Core::FE::num_nodes<edge_type>,
+      unsigned num_nodes_side = Core::FE::num_nodes<side_type>>
+  double refine_intersection_double_double(const Core::LinAlg::Matrix<3, num_nodes_side>& xyze_side,
+      const Core::LinAlg::Matrix<3, num_nodes_edge>& xyze_edge, Core::LinAlg::Matrix<3, 1>& xsi,
+      unsigned num_steps = 2)
+  {
+    static_assert(Core::FE::dim<edge_type> == 1 and Core::FE::dim<side_type> == 2);
+
+    std::array<DoubleDouble, 3> xsi_dd = {xsi(0), xsi(1), xsi(2)};
+    std::array<DoubleDouble, 3> x_side, x_edge, residual;
+    std::array<std::array<DoubleDouble, 3>, 2> dx_side;
+    std::array<std::array<DoubleDouble, 3>, 1> dx_edge;
+
+    for (unsigned step = 0;; ++step)
+    {
+      DoubleDoubleArithmetic::interpolate<side_type>(xyze_side, xsi_dd.data(), x_side, dx_side);
+      DoubleDoubleArithmetic::interpolate<edge_type>(xyze_edge, xsi_dd.data() + 2, x_edge, dx_edge);
+      for (unsigned i = 0; i < 3; ++i) residual[i] = x_edge[i] - x_side[i];
+
+      const double residual_norm = DoubleDoubleArithmetic::norm2(residual);
+      if (step == num_steps or residual_norm == 0.0)
+      {
+        for (unsigned i = 0; i < 3; ++i) xsi(i) = xsi_dd[i].hi;
+        return residual_norm;
+      }
+
+      Core::LinAlg::Matrix<3, 3> A;
+      Core::LinAlg::Matrix<3, 1> b;
+      Core::LinAlg::Matrix<3, 1> dx;
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        A(i, 0) = -dx_side[0][i].hi;
+        A(i, 1) = -dx_side[1][i].hi;
+        A(i, 2) = dx_edge[0][i].hi;
+        b(i) = -residual[i].hi;
+      }
+      if (Core::LinAlg::gauss_elimination<true, 3>(A, b, dx) == 0.0) return -1.0;
+
+      for (unsigned i = 0; i < 3; ++i) xsi_dd[i] = xsi_dd[i] + dx(i);
+    }
+  }
+
+  /*!
+  \brief Refine the signed distance between a point and a side in 3D by Newton steps on
+  double-double
+
+  The distance @p xsi(2) is measured along the unit normal of the side, as in the
+  ComputeDistanceStrategy. Internally, the residual px - x_side(xsi_side) - delta * n(xsi_side)
+  is used with the unscaled normal n, which avoids divisions and square roots on double-double.
+  The residual and the solution are kept in double-double, the Jacobian is solved on double.
+
+  \return l2-norm of the residual at the refined @p xsi, or a negative value if the Jacobian is
+  singular
+  */
+  template <Core::FE::CellType side_type, unsigned num_nodes_side = Core::FE::num_nodes<side_type>>
+  double refine_distance_double_double(const Core::LinAlg::Matrix<3, num_nodes_side>& xyze_side,
+      const Core::LinAlg::Matrix<3, 1>& px, Core::LinAlg::Matrix<3, 1>& xsi,
+      unsigned num_steps = 2)
+  {
+    static_assert(Core::FE::dim<side_type> == 2);
+    using DoubleDoubleArithmetic::cross;
+    using DoubleDoubleArithmetic::norm2;
+
+    std::array<DoubleDouble, 3> xsi_dd = {xsi(0), xsi(1), 0.0};
+    std::array<DoubleDouble, 3> x_side, normal, residual;
+    std::array<std::array<DoubleDouble, 3>, 2> dx_side;
+
+    // the mixed second derivative of the side coordinates is constant for linear cells
+    std::array<DoubleDouble, 3> dx_side_rs;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      dx_side_rs[i] = 0.0;
+      for (unsigned k = 0; k < num_nodes_side; ++k)
+        dx_side_rs[i] =
+            dx_side_rs[i] + xyze_side(i, k) * DoubleDoubleShapeFunctions<side_type>::deriv2_rs[k];
+    }
+
+    DoubleDoubleArithmetic::interpolate<side_type>(xyze_side, xsi_dd.data(), x_side, dx_side);
+    xsi_dd[2] = xsi(2) / norm2(cross(dx_side[0], dx_side[1]));
+
+    for (unsigned step = 0;; ++step)
+    {
+      DoubleDoubleArithmetic::interpolate<side_type>(xyze_side, xsi_dd.data(), x_side, dx_side);
+      normal = cross(dx_side[0], dx_side[1]);
+      for (unsigned i = 0; i < 3; ++i) residual[i] = px(i) - x_side[i] - xsi_dd[2] * normal[i];
+
+      const double residual_norm = norm2(residual);
+      if (step == num_steps or residual_norm == 0.0)
+      {
+        xsi(0) = xsi_dd[0].hi;
+        xsi(1) = xsi_dd[1].hi;
+        xsi(2) = xsi_dd[2].hi * norm2(normal);
+        return residual_norm;
+      }
+
+      // linearization of the unscaled normal n = x_r x x_s with x_rr = x_ss = 0
+      const std::array<DoubleDouble, 3> dnormal_r = cross(dx_side[0], dx_side_rs);
+      const std::array<DoubleDouble, 3> dnormal_s = cross(dx_side_rs, dx_side[1]);
+
+      Core::LinAlg::Matrix<3, 3> A;
+      Core::LinAlg::Matrix<3, 1> b;
+      Core::LinAlg::Matrix<3, 1> dx;
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        A(i, 0) = dx_side[0][i].hi + xsi_dd[2].hi * dnormal_r[i].hi;
+        A(i, 1) = dx_side[1][i].hi + xsi_dd[2].hi * dnormal_s[i].hi;
+        A(i, 2) = normal[i].hi;
+        b(i) = residual[i].hi;
+      }
+      if (Core::LinAlg::gauss_elimination<true, 3>(A, b, dx) == 0.0) return -1.0;
+
+      for (unsigned i = 0; i < 3; ++i) xsi_dd[i] = xsi_dd[i] + dx(i);
+    }
+  }
+}  // namespace Cut::Kernel
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
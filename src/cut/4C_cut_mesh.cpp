@@ -20,6 +20,8 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <exception>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*
@@ -217,6 +219,7 @@ Cut::Side* Cut::Mesh::create_quad4_side(int sid, const std::vector<int>& nids)
 Cut::Point* Cut::Mesh::new_point(
     const double* x, Edge* cut_edge, Side* cut_side, double tolerance, double tol_scale)
 {
+  std::lock_guard<std::mutex> lock(mutex_);
   bb_->add_point(x);  // add the point to the mesh's bounding box
   // Point* p = pp_->NewPoint( x, cut_edge, cut_side, setup_ ? SETUPNODECATCHTOL : MINIMALTOL );
   Point* p = pp_->new_point(x, cut_edge, cut_side, tolerance);  // add the point in the point pool
@@ -283,8 +286,8 @@ Cut::Line* Cut::Mesh::new_line_internal(
   Line* line = p1->common_line(p2);
   if (not line)
   {
-    line = new Line(p1, p2, cut_side1, cut_side2, cut_element);
-    lines_.push_back(Teuchos::RCP(line));
+    line = arena_.create<Line>(p1, p2, cut_side1, cut_side2, cut_element);
+    lines_.push_back(line);
   }
   else  // line already exists. just add cut side details to the line
   {
@@ -352,8 +355,8 @@ Cut::Facet* Cut::Mesh::new_facet(const std::vector<Point*>& points, Side* side,
     }
   }
 
-  Facet* f = new Facet(*this, points, side, cutsurface);
-  facets_.push_back(Teuchos::RCP(f));
+  Facet* f = arena_.create<Facet>(*this, points, side, cutsurface);
+  facets_.push_back(f);
 
   return f;
 }
@@ -365,8 +368,8 @@ Cut::Facet* Cut::Mesh::new_facet(const std::vector<Point*>& points, Side* side,
 Cut::VolumeCell* Cut::Mesh::new_volume_cell(const plain_facet_set& facets,
     const std::map<std::pair<Point*, Point*>, plain_facet_set>& volume_lines, Element* element)
 {
-  VolumeCell* c = new VolumeCell(facets, volume_lines, element);
-  cells_.push_back(Teuchos::RCP(c));  // store the pointer in mesh's cells_
+  VolumeCell* c = arena_.create<VolumeCell>(facets, volume_lines, element);
+  cells_.push_back(c);  // store the pointer in mesh's cells_
   return c;
 }
 
@@ -382,8 +385,9 @@ Cut::Point1BoundaryCell* Cut::Mesh::new_point1_cell(
   Core::LinAlg::SerialDenseMatrix xyz(3, 1);
   points[0]->coordinates(&xyz(0, 0));
 
-  Point1BoundaryCell* bc = new Point1BoundaryCell(xyz, facet, points);
-  boundarycells_.push_back(Teuchos::RCP(bc));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Point1BoundaryCell* bc = arena_.create<Point1BoundaryCell>(xyz, facet, points);
+  boundarycells_.push_back(bc);
 
   return bc;
 }
@@ -402,8 +406,9 @@ Cut::Line2BoundaryCell* Cut::Mesh::new_line2_cell(
     points[i]->coordinates(&xyze(0, i));
   }
 
-  Line2BoundaryCell* bc = new Line2BoundaryCell(xyze, facet, points);
-  boundarycells_.push_back(Teuchos::RCP(bc));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Line2BoundaryCell* bc = arena_.create<Line2BoundaryCell>(xyze, facet, points);
+  boundarycells_.push_back(bc);
 
   return bc;
 }
@@ -424,9 +429,10 @@ Cut::Tri3BoundaryCell* Cut::Mesh::new_tri3_cell(
     points[i]->coordinates(&xyz(0, i));
   }
 
-  Tri3BoundaryCell* bc = new Tri3BoundaryCell(xyz, facet, points);
+  std::lock_guard<std::mutex> lock(mutex_);
+  Tri3BoundaryCell* bc = arena_.create<Tri3BoundaryCell>(xyz, facet, points);
   bc->set_new_cubature_degree(options_.bc_cubaturedegree());
-  boundarycells_.push_back(Teuchos::RCP(bc));
+  boundarycells_.push_back(bc);
 
   return bc;
 }
@@ -448,9 +454,10 @@ Cut::Quad4BoundaryCell* Cut::Mesh::new_quad4_cell(
     points[i]->coordinates(&xyz(0, i));
   }
 
-  Quad4BoundaryCell* bc = new Quad4BoundaryCell(xyz, facet, points);
+  std::lock_guard<std::mutex> lock(mutex_);
+  Quad4BoundaryCell* bc = arena_.create<Quad4BoundaryCell>(xyz, facet, points);
   bc->set_new_cubature_degree(options_.bc_cubaturedegree());
-  boundarycells_.push_back(Teuchos::RCP(bc));
+  boundarycells_.push_back(bc);
 
   return bc;
 }
@@ -471,8 +478,10 @@ Cut::ArbitraryBoundaryCell* Cut::Mesh::new_arbitrary_cell(VolumeCell* volume, Fa
     points[i]->coordinates(&xyz(0, i));
   }
 
-  ArbitraryBoundaryCell* bc = new ArbitraryBoundaryCell(xyz, facet, points, gaussRule, normal);
-  boundarycells_.push_back(Teuchos::RCP(bc));
+  std::lock_guard<std::mutex> lock(mutex_);
+  ArbitraryBoundaryCell* bc =
+      arena_.create<ArbitraryBoundaryCell>(xyz, facet, points, gaussRule, normal);
+  boundarycells_.push_back(bc);
 
   return bc;
 }
@@ -490,8 +499,9 @@ Cut::Line2IntegrationCell* Cut::Mesh::new_line2_cell(
   {
     points[i]->coordinates(&xyze(0, i));
   }
-  Line2IntegrationCell* c = new Line2IntegrationCell(position, xyze, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Line2IntegrationCell* c = arena_.create<Line2IntegrationCell>(position, xyze, points, cell);
+  integrationcells_.push_back(c);
 
   return c;
 }
@@ -509,8 +519,9 @@ Cut::Tri3IntegrationCell* Cut::Mesh::new_tri3_cell(
   {
     points[i]->coordinates(&xyze(0, i));
   }
-  Tri3IntegrationCell* c = new Tri3IntegrationCell(position, xyze, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Tri3IntegrationCell* c = arena_.create<Tri3IntegrationCell>(position, xyze, points, cell);
+  integrationcells_.push_back(c);
 
   return c;
 }
@@ -528,8 +539,9 @@ Cut::Quad4IntegrationCell* Cut::Mesh::new_quad4_cell(
   {
     points[i]->coordinates(&xyze(0, i));
   }
-  Quad4IntegrationCell* c = new Quad4IntegrationCell(position, xyze, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Quad4IntegrationCell* c = arena_.create<Quad4IntegrationCell>(position, xyze, points, cell);
+  integrationcells_.push_back(c);
 
   return c;
 }
@@ -546,8 +558,9 @@ Cut::Hex8IntegrationCell* Cut::Mesh::new_hex8_cell(
     points[i]->coordinates(&xyz(0, i));
   }
 
-  Hex8IntegrationCell* c = new Hex8IntegrationCell(position, xyz, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Hex8IntegrationCell* c = arena_.create<Hex8IntegrationCell>(position, xyz, points, cell);
+  integrationcells_.push_back(c);
 
   return c;
 }
@@ -566,8 +579,9 @@ Cut::Tet4IntegrationCell* Cut::Mesh::new_tet4_cell(
     points[i]->coordinates(&xyz(0, i));
   }
 
-  Tet4IntegrationCell* c = new Tet4IntegrationCell(position, xyz, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Tet4IntegrationCell* c = arena_.create<Tet4IntegrationCell>(position, xyz, points, cell);
+  integrationcells_.push_back(c);
 
   return c;
 }
@@ -580,8 +594,9 @@ Cut::Tet4IntegrationCell* Cut::Mesh::new_tet4_cell(
     Point::PointPosition position, const Core::LinAlg::SerialDenseMatrix& xyz, VolumeCell* cell)
 {
   std::vector<Point*> points;  // empty list of points
-  Tet4IntegrationCell* c = new Tet4IntegrationCell(position, xyz, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Tet4IntegrationCell* c = arena_.create<Tet4IntegrationCell>(position, xyz, points, cell);
+  integrationcells_.push_back(c);
   return c;
 }
 
@@ -598,8 +613,9 @@ Cut::Wedge6IntegrationCell* Cut::Mesh::new_wedge6_cell(
     points[i]->coordinates(&xyz(0, i));
   }
 
-  Wedge6IntegrationCell* c = new Wedge6IntegrationCell(position, xyz, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Wedge6IntegrationCell* c = arena_.create<Wedge6IntegrationCell>(position, xyz, points, cell);
+  integrationcells_.push_back(c);
 
   return c;
 }
@@ -617,8 +633,10 @@ Cut::Pyramid5IntegrationCell* Cut::Mesh::new_pyramid5_cell(
     points[i]->coordinates(&xyz(0, i));
   }
 
-  Pyramid5IntegrationCell* c = new Pyramid5IntegrationCell(position, xyz, points, cell);
-  integrationcells_.push_back(Teuchos::RCP(c));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Pyramid5IntegrationCell* c =
+      arena_.create<Pyramid5IntegrationCell>(position, xyz, points, cell);
+  integrationcells_.push_back(c);
 
   return c;
 }
@@ -1152,7 +1170,7 @@ void Cut::Mesh::find_facet_positions()
 
   plain_volumecell_set undecided;
 
-  for (std::list<Teuchos::RCP<VolumeCell>>::iterator i = cells_.begin(); i != cells_.end(); ++i)
+  for (std::vector<VolumeCell*>::iterator i = cells_.begin(); i != cells_.end(); ++i)
   {
     VolumeCell* c = &**i;
     //     if ( c->Empty() )
@@ -1259,7 +1277,7 @@ void Cut::Mesh::find_facet_positions()
 
   // second pass
 
-  //   for ( std::list<Teuchos::RCP<VolumeCell> >::iterator i=cells_.begin(); i!=cells_.end(); ++i )
+  //   for ( std::vector<VolumeCell*>::iterator i=cells_.begin(); i!=cells_.end(); ++i )
   //   {
   //     VolumeCell * c = &**i;
   //     const plain_facet_set & facets = c->Facets();
@@ -1399,7 +1417,7 @@ void Cut::Mesh::find_nodal_dof_sets(bool include_inner)
     n->find_dof_sets(include_inner);
   }
 
-  for (std::list<Teuchos::RCP<VolumeCell>>::iterator i = cells_.begin(); i != cells_.end(); ++i)
+  for (std::vector<VolumeCell*>::iterator i = cells_.begin(); i != cells_.end(); ++i)
   {
     VolumeCell* cell = &**i;
     cell->connect_nodal_dof_sets(include_inner);
@@ -1500,6 +1518,12 @@ void Cut::Mesh::moment_fit_gauss_weights(bool include_inner, Cut::BCellGaussPts
  *-------------------------------------------------------------------------------------*/
 void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGaussPts Bcellgausstype)
 {
+  if (options_.finalize_num_threads() > 1)
+  {
+    direct_divergence_gauss_rule_colored(include_inner, Bcellgausstype);
+    return;
+  }
+
   for (std::map<int, Teuchos::RCP<Element>>::iterator i = elements_.begin(); i != elements_.end();
        ++i)
   {
@@ -1531,6 +1555,96 @@ void Cut::Mesh::direct_divergence_gauss_rule(bool include_inner, Cut::BCellGauss
 }
 
 
+/*-------------------------------------------------------------------------------------*
+ * Greedy coloring of all elements and shadow elements: elements sharing a node or a cut
+ * side get different colors, so elements of one color have no points, facets or sides in
+ * common
+ *-------------------------------------------------------------------------------------*/
+std::vector<std::vector<Cut::Element*>> Cut::Mesh::build_element_coloring()
+{
+  std::vector<std::vector<Element*>> colors;
+
+  // colors of all elements adjacent to a node or cut by a side that were colored so far
+  std::map<const Node*, std::vector<int>> node_colors;
+  std::map<const Side*, std::vector<int>> cut_side_colors;
+  std::vector<bool> forbidden;
+
+  auto color_element = [&](Element* e)
+  {
+    forbidden.assign(colors.size(), false);
+    for (const Node* n : e->nodes())
+      for (int c : node_colors[n]) forbidden[c] = true;
+    for (const Side* s : e->cut_sides())
+      for (int c : cut_side_colors[s]) forbidden[c] = true;
+
+    int color = 0;
+    while (color < static_cast<int>(colors.size()) and forbidden[color]) ++color;
+    if (color == static_cast<int>(colors.size())) colors.emplace_back();
+
+    colors[color].push_back(e);
+    for (const Node* n : e->nodes()) node_colors[n].push_back(color);
+    for (const Side* s : e->cut_sides()) cut_side_colors[s].push_back(color);
+  };
+
+  for (auto& [eid, e] : elements_) color_element(e.get());
+  for (auto& [eid, e] : shadow_elements_) color_element(e.get());
+
+  return colors;
+}
+
+
+/*-------------------------------------------------------------------------------------*
+ * DirectDivergence integration rules of all elements, the elements of one color are
+ * distributed over the threads
+ *-------------------------------------------------------------------------------------*/
+void Cut::Mesh::direct_divergence_gauss_rule_colored(
+    bool include_inner, Cut::BCellGaussPts Bcellgausstype)
+{
+  const std::vector<std::vector<Element*>> colors = build_element_coloring();
+
+  // exceptions must not leave a parallel region, so the first one is kept and rethrown afterwards
+  std::exception_ptr exception = nullptr;
+  Element* failed_element = nullptr;
+
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp parallel num_threads(options_.finalize_num_threads())
+#endif
+  {
+    for (const auto& color : colors)
+    {
+      // the implicit barrier at the end of the work-sharing loop separates the colors
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp for schedule(dynamic, 4)
+#endif
+      for (std::size_t i = 0; i < color.size(); ++i)
+      {
+        try
+        {
+          color[i]->direct_divergence_gauss_rule(*this, include_inner, Bcellgausstype);
+        }
+        catch (...)
+        {
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp critical(cut_mesh_direct_divergence_exception)
+#endif
+          if (!exception)
+          {
+            exception = std::current_exception();
+            failed_element = color[i];
+          }
+        }
+      }
+    }
+  }
+
+  if (exception)
+  {
+    debug_dump(failed_element, __FILE__, __LINE__);
+    std::rethrow_exception(exception);
+  }
+}
+
+
 /*-------------------------------------------------------------------------------------*
  * ?
  *-------------------------------------------------------------------------------------*/
@@ -1834,7 +1948,7 @@ void Cut::Mesh::print_facets()
   //     std::cout << "\n";
   //   }
 
-  for (std::list<Teuchos::RCP<Facet>>::iterator i = facets_.begin(); i != facets_.end(); ++i)
+  for (std::vector<Facet*>::iterator i = facets_.begin(); i != facets_.end(); ++i)
   {
     Facet& f = **i;
     f.print();
@@ -1907,7 +2021,7 @@ void Cut::Mesh::dump_gmsh(std::string name)
   if (lines_.size() > 0)
   {
     Cut::Output::gmsh_new_section(file, "Lines");
-    for (std::list<Teuchos::RCP<Line>>::iterator i = lines_.begin(); i != lines_.end(); ++i)
+    for (std::vector<Line*>::iterator i = lines_.begin(); i != lines_.end(); ++i)
       Cut::Output::gmsh_line_dump(file, &(**i));
     Cut::Output::gmsh_end_section(file);
   }
@@ -1917,19 +2031,19 @@ void Cut::Mesh::dump_gmsh(std::string name)
   {
     // ###############write all facets (or basically the facet lines)###############
     Cut::Output::gmsh_new_section(file, "Facet_Lines");
-    for (std::list<Teuchos::RCP<Facet>>::iterator i = facets_.begin(); i != facets_.end(); ++i)
+    for (std::vector<Facet*>::iterator i = facets_.begin(); i != facets_.end(); ++i)
       Cut::Output::gmsh_facet_dump(file, &(**i), "lines");
     Cut::Output::gmsh_end_section(file);
 
     // ###############write all triangulated facets ###############
     Cut::Output::gmsh_new_section(file, "Facets");
-    for (std::list<Teuchos::RCP<Facet>>::iterator i = facets_.begin(); i != facets_.end(); ++i)
+    for (std::vector<Facet*>::iterator i = facets_.begin(); i != facets_.end(); ++i)
       Cut::Output::gmsh_facet_dump(file, &(**i), "sides");
     Cut::Output::gmsh_end_section(file);
 
     // ###############write all cut facets all ###############
     Cut::Output::gmsh_new_section(file, "cut_Facets");
-    for (std::list<Teuchos::RCP<Facet>>::iterator i = facets_.begin(); i != facets_.end(); ++i)
+    for (std::vector<Facet*>::iterator i = facets_.begin(); i != facets_.end(); ++i)
     {
       if ((*i)->parent_side()->is_cut_side())
         Cut::Output::gmsh_facet_dump(file, &(**i), "sides", true);
@@ -1938,7 +2052,7 @@ void Cut::Mesh::dump_gmsh(std::string name)
 
     // ###############write all triangulated facets all ###############
     Cut::Output::gmsh_new_section(file, "ele_Facets");
-    for (std::list<Teuchos::RCP<Facet>>::iterator i = facets_.begin(); i != facets_.end(); ++i)
+    for (std::vector<Facet*>::iterator i = facets_.begin(); i != facets_.end(); ++i)
     {
       if (!(*i)->parent_side()->is_cut_side())
         Cut::Output::gmsh_facet_dump(file, &(**i), "sides", true);
@@ -1991,7 +2105,7 @@ void Cut::Mesh::dump_gmsh_volume_cells(std::string name, bool include_inner)
   file.precision(16);
 
   file << "View \"VolumeCells\" {\n";
-  for (std::list<Teuchos::RCP<VolumeCell>>::iterator i = cells_.begin(); i != cells_.end(); ++i)
+  for (std::vector<VolumeCell*>::iterator i = cells_.begin(); i != cells_.end(); ++i)
   {
     VolumeCell* vc = &**i;
 
@@ -2127,7 +2241,7 @@ void Cut::Mesh::dump_gmsh_integration_cells(std::string name)
 {
   std::ofstream file(name.c_str());
   file << "View \"IntegrationCells\" {\n";
-  for (std::list<Teuchos::RCP<IntegrationCell>>::iterator i = integrationcells_.begin();
+  for (std::vector<IntegrationCell*>::iterator i = integrationcells_.begin();
        i != integrationcells_.end(); ++i)
   {
     IntegrationCell* ic = &**i;
@@ -2146,7 +2260,7 @@ void Cut::Mesh::dump_gmsh_boundary_cells(std::ofstream& file, Point::PointPositi
 {
   // Write BCs for "pos" VolumeCell:
   file << "View \"BoundaryCells " << Point::point_position_to_string(pos) << "\" {\n";
-  for (std::list<Teuchos::RCP<VolumeCell>>::iterator i = cells_.begin(); i != cells_.end(); ++i)
+  for (std::vector<VolumeCell*>::iterator i = cells_.begin(); i != cells_.end(); ++i)
   {
     VolumeCell* volcell = &**i;
     if (volcell->position() == pos)
@@ -2163,7 +2277,7 @@ void Cut::Mesh::dump_gmsh_boundary_cells(std::ofstream& file, Point::PointPositi
 
   // write normal for boundary cells
   file << "View \"BoundaryCellsNormal " << Point::point_position_to_string(pos) << "\" {\n";
-  for (std::list<Teuchos::RCP<VolumeCell>>::iterator i = cells_.begin(); i != cells_.end(); ++i)
+  for (std::vector<VolumeCell*>::iterator i = cells_.begin(); i != cells_.end(); ++i)
   {
     VolumeCell* volcell = &**i;
     if (volcell->position() == pos)
@@ -2201,7 +2315,7 @@ void Cut::Mesh::dump_gmsh_volume_cells(std::string name)
 
   file << "View \"BoundaryCells\" {\n";
   bool haslevelsetside = false;
-  for (std::list<Teuchos::RCP<BoundaryCell>>::iterator i = boundarycells_.begin();
+  for (std::vector<BoundaryCell*>::iterator i = boundarycells_.begin();
        i != boundarycells_.end(); ++i)
   {
     BoundaryCell* bc = &**i;
@@ -2925,9 +3039,9 @@ int Cut::Mesh::create_side_ids_all_cut_test(int lastid)
  *----------------------------------------------------------------------------*/
 void Cut::Mesh::assign_other_volume_cells_cut_test(const Mesh& other)
 {
-  const std::list<Teuchos::RCP<VolumeCell>>& other_cells = other.volume_cells();
+  const std::vector<VolumeCell*>& other_cells = other.volume_cells();
   plain_volumecell_set cells;
-  for (std::list<Teuchos::RCP<VolumeCell>>::const_iterator i = other_cells.begin();
+  for (std::vector<VolumeCell*>::const_iterator i = other_cells.begin();
        i != other_cells.end(); ++i)
   {
     VolumeCell* vc = &**i;
@@ -2976,7 +3090,7 @@ void Cut::Mesh::assign_other_volume_cells_cut_test(const Mesh& other)
  *----------------------------------------------------------------------------*/
 void Cut::Mesh::test_facet_area(bool istetmeshintersection)
 {
-  for (std::list<Teuchos::RCP<Facet>>::iterator i = facets_.begin(); i != facets_.end(); ++i)
+  for (std::vector<Facet*>::iterator i = facets_.begin(); i != facets_.end(); ++i)
   {
     Facet* f = &**i;
 
@@ -10,6 +10,7 @@
 
 #include "4C_config.hpp"
 
+#include "4C_cut_arena.hpp"
 #include "4C_cut_boundingbox.hpp"
 #include "4C_cut_edge.hpp"
 #include "4C_cut_facet.hpp"
@@ -18,7 +19,8 @@
 #include <Shards_BasicTopologies.hpp>
 #include <Shards_CellTopologyTraits.hpp>
 
-#include <list>
+#include <mutex>
+#include <vector>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -466,7 +468,7 @@ namespace Cut
     Teuchos::RCP<PointPool> points() { return pp_; }
 
     /// get a list of all volumecells
-    const std::list<Teuchos::RCP<VolumeCell>>& volume_cells() const { return cells_; }
+    const std::vector<VolumeCell*>& volume_cells() const { return cells_; }
 
     /// ???
     const std::map<plain_int_set, Teuchos::RCP<Edge>>& edges() const { return edges_; }
@@ -570,6 +572,14 @@ namespace Cut
     Cut::Line* new_line_internal(
         Point* p1, Point* p2, Side* cut_side1, Side* cut_side2, Element* cut_element);
 
+    /// Group all elements and shadow elements such that no two elements of a group share a node
+    /// or a cut side
+    std::vector<std::vector<Element*>> build_element_coloring();
+
+    /// Thread-parallel version of direct_divergence_gauss_rule() over the element colors
+    void direct_divergence_gauss_rule_colored(
+        bool include_inner, Cut::BCellGaussPts Bcellgausstype);
+
 
     /*========================================================================*/
     //! @name private member variables
@@ -608,12 +618,15 @@ namespace Cut
     //! @name Containers that hold all those mesh objects
     /*========================================================================*/
 
-    /// Plain pointers are used within the library. Memory management is done here.
-    std::list<Teuchos::RCP<Line>> lines_;
-    std::list<Teuchos::RCP<Facet>> facets_;
-    std::list<Teuchos::RCP<VolumeCell>> cells_;
-    std::list<Teuchos::RCP<BoundaryCell>> boundarycells_;
-    std::list<Teuchos::RCP<IntegrationCell>> integrationcells_;
+    /// Plain pointers are used within the library. Memory management is done here: lines,
+    /// facets and cells are placed in the arena and destroyed together with the mesh.
+    Arena arena_;
+
+    std::vector<Line*> lines_;
+    std::vector<Facet*> facets_;
+    std::vector<VolumeCell*> cells_;
+    std::vector<BoundaryCell*> boundarycells_;
+    std::vector<IntegrationCell*> integrationcells_;
 
     /// nodes by unique id, contains also shadow nodes with negative node-Ids
     /// Remark: the negative nids of shadow nodes are not unique over processors!
@@ -658,6 +671,9 @@ namespace Cut
     /// processor id --> required just for output!
     int myrank_;
 
+    /// guards the point pool and the cell containers when elements are processed by threads
+    std::mutex mutex_;
+
     //@}
   };
 
@@ -8,6 +8,7 @@
 #include "4C_cut_options.hpp"
 
 #include "4C_cut_position.hpp"
+#include "4C_utils_exceptions.hpp"
 #include "4C_utils_parameter_list.hpp"
 
 FOUR_C_NAMESPACE_OPEN
@@ -33,6 +34,19 @@ void Cut::Options::init_by_paramlist(const Teuchos::ParameterList& cutparams)
   selfcut_island_geom_multiplicator_ = cutparams.get<int>("SELFCUT_MESHCORRECTION_MULTIPLICATOR");
   bc_cubaturedegree_ = cutparams.get<int>("BOUNDARYCELL_CUBATURDEGREE");
   integrate_inside_cells_ = cutparams.get<bool>("INTEGRATE_INSIDE_CELLS");
+
+  finalize_num_threads_ = cutparams.get<int>("FINALIZE_NUM_THREADS");
+  if (finalize_num_threads_ < 1) FOUR_C_THROW("FINALIZE_NUM_THREADS must be positive.");
+  if (finalize_num_threads_ > 1)
+  {
+#ifndef FOUR_C_WITH_OPENMP
+    FOUR_C_THROW("FINALIZE_NUM_THREADS > 1 requires 4C to be configured with OpenMP.");
+#endif
+    // the precision of the CLN numbers is a global setting
+    if (general_position_dist_floattype_ == floattype_cln or
+        general_position_pos_floattype_ == floattype_cln)
+      FOUR_C_THROW("FINALIZE_NUM_THREADS > 1 does not work with CLN positions.");
+  }
 }
 
 /// Initializes Cut Parameters for Cuttests (use full cln) -- slowest option
@@ -45,7 +45,8 @@ namespace Cut
           selfcut_island_geom_multiplicator_(2),
           gen_bcell_position_(bcells_on_cut_side),
           split_cutsides_(true),
-          bc_cubaturedegree_(20)
+          bc_cubaturedegree_(20),
+          finalize_num_threads_(1)
     {
     }
 
@@ -130,6 +131,9 @@ namespace Cut
      * the selfcut*/
     int self_cut_island_geom_multiplicator() { return selfcut_island_geom_multiplicator_; }
 
+    /** \brief Number of threads used to create the integration rules of the cut elements */
+    int finalize_num_threads() const { return finalize_num_threads_; }
+
    private:
     /** \brief Float_type for geometric intersection computation */
     Cut::CutFloatType geomintersect_floattype_;
@@ -199,6 +203,9 @@ namespace Cut
 
     /** \brief Cubaturedegree for creating of integrationpoints on boundarycells */
     int bc_cubaturedegree_;
+
+    /** \brief Number of threads used to create the integration rules of the cut elements */
+    int finalize_num_threads_;
   };
 
 }  // namespace Cut
@@ -576,8 +576,8 @@ void Cut::TetMeshIntersection::map_volume_cells(Mesh& parent_mesh, Element* elem
             std::inserter(done_child_cells, done_child_cells.begin()));
       }
 
-      const std::list<Teuchos::RCP<VolumeCell>>& all_child_cells = mesh_.volume_cells();
-      for (std::list<Teuchos::RCP<VolumeCell>>::const_iterator i = all_child_cells.begin();
+      const std::vector<VolumeCell*>& all_child_cells = mesh_.volume_cells();
+      for (std::vector<VolumeCell*>::const_iterator i = all_child_cells.begin();
            i != all_child_cells.end(); ++i)
       {
         VolumeCell* child_vc = &**i;
@@ -615,8 +615,8 @@ void Cut::TetMeshIntersection::map_volume_cells(Mesh& parent_mesh, Element* elem
       }
 
       bool found = false;
-      const std::list<Teuchos::RCP<VolumeCell>>& all_child_cells = mesh_.volume_cells();
-      for (std::list<Teuchos::RCP<VolumeCell>>::const_iterator i = all_child_cells.begin();
+      const std::vector<VolumeCell*>& all_child_cells = mesh_.volume_cells();
+      for (std::vector<VolumeCell*>::const_iterator i = all_child_cells.begin();
            i != all_child_cells.end(); ++i)
       {
         VolumeCell* child_vc = &**i;
@@ -746,8 +746,8 @@ void Cut::TetMeshIntersection::seed_cells(Mesh& parent_mesh,
   // look at all points of each free child volume cell and see if there is a
   // unique parent volume cell to these points
 
-  const std::list<Teuchos::RCP<VolumeCell>>& all_child_cells = mesh_.volume_cells();
-  for (std::list<Teuchos::RCP<VolumeCell>>::const_iterator i = all_child_cells.begin();
+  const std::vector<VolumeCell*>& all_child_cells = mesh_.volume_cells();
+  for (std::vector<VolumeCell*>::const_iterator i = all_child_cells.begin();
        i != all_child_cells.end(); ++i)
   {
     VolumeCell* child_vc = &**i;
@@ -0,0 +1,37 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_CUT_TIME_MONITOR_HPP
+#define FOUR_C_CUT_TIME_MONITOR_HPP
+
+#include "4C_config.hpp"
+
+#include <Teuchos_TimeMonitor.hpp>
+
+#ifdef FOUR_C_WITH_OPENMP
+#include <omp.h>
+
+#include <optional>
+#endif
+
+#ifdef FOUR_C_WITH_OPENMP
+/*!
+ * \brief TEUCHOS_FUNC_TIME_MONITOR for cut routines that may run inside an OpenMP parallel region
+ *
+ * Teuchos timers are not thread-safe, so the time is only measured outside of parallel regions.
+ * The timer itself is created in a thread-safe static initialization.
+ */
+#define FOUR_C_CUT_FUNC_TIME_MONITOR(FUNCNAME)                                                     \
+  static const Teuchos::RCP<Teuchos::Time> cut_func_timer =                                        \
+      Teuchos::TimeMonitor::getNewCounter(FUNCNAME);                                               \
+  std::optional<Teuchos::TimeMonitor> cut_func_time_monitor;                                       \
+  if (!omp_in_parallel()) cut_func_time_monitor.emplace(*cut_func_timer)
+#else
+#define FOUR_C_CUT_FUNC_TIME_MONITOR(FUNCNAME) TEUCHOS_FUNC_TIME_MONITOR(FUNCNAME)
+#endif
+
+#endif
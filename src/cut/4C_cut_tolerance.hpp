@@ -105,6 +105,10 @@
 // limiting error after which double will be switched to cln
 #define DOUBLE_LIMIT_ERROR (4 * 1e-15)
 
+// limiting condition number, until which a failed double result is refined on double-double
+// before switching to cln
+#define DOUBLE_DOUBLE_LIMIT_CONDITION 1e12
+
 // whether we run on double + (soemtimes) cln or double + (always) cln
 #define DOUBLE_PLUS_CLN_COMPUTE true
 
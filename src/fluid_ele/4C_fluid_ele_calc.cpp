@@ -37,6 +37,8 @@
 
 #include <Sacado.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -1432,81 +1434,66 @@ void Discret::Elements::FluidEleCalc<distype, enrtype>::body_force(Discret::Elem
     const auto* val = &myneumcond[0]->parameters().get<std::vector<double>>("VAL");
     const auto* functions = &myneumcond[0]->parameters().get<std::vector<int>>("FUNCT");
 
-    // factor given by spatial function
-    double functionfac = 1.0;
-    int functnum = -1;
+    // for xwall, only the linear shape functions contribute to the bodyforce,
+    // since the sum of all shape functions sum(N_j) != 1.0 if the enriched shape functions are
+    // included
+    constexpr int node_stride = (enrtype == Discret::Elements::Fluid::xwall) ? 2 : 1;
+    constexpr int num_points = (nen_ + node_stride - 1) / node_stride;
+
+    // evaluate functions at the positions of the contributing nodes, all nodes at once
+    // ------------------------------------------------------
+    // comment: this introduces an additional error compared to an
+    // evaluation at the integration point. However, we need a node
+    // based element bodyforce vector for prescribed pressure gradients
+    // in some fancy turbulance stuff.
+    Core::LinAlg::Matrix<3, num_points> point_coordinates(true);
+    bool have_point_coordinates = false;
 
+    // factors given by spatial function
+    Core::LinAlg::Matrix<num_points, 1> functionfacs;
 
     // set this condition to the ebofoaf array
     for (int isd = 0; isd < nsd_; isd++)
     {
       // get factor given by spatial function
-      if (functions)
-        functnum = (*functions)[isd];
-      else
-        functnum = -1;
+      const int functnum = functions ? (*functions)[isd] : -1;
 
-      double num = (*onoff)[isd] * (*val)[isd];
+      const double num = (*onoff)[isd] * (*val)[isd];
 
-      if (enrtype == Discret::Elements::Fluid::xwall)
+      if (functnum > 0)
       {
-        // for xwall, only the linear shape functions contribute to the bodyforce,
-        // since the sum of all shape functions sum(N_j) != 1.0 if the enriched shape functions are
-        // included
-        for (int jnode = 0; jnode < nen_; jnode += 2)
+        if (!have_point_coordinates)
         {
-          if (functnum > 0)
+          for (int point = 0; point < num_points; ++point)
           {
-            // evaluate function at the position of the current node
-            // ------------------------------------------------------
-            // comment: this introduces an additional error compared to an
-            // evaluation at the integration point. However, we need a node
-            // based element bodyforce vector for prescribed pressure gradients
-            // in some fancy turbulance stuff.
-            functionfac = Global::Problem::instance()
-                              ->function_by_id<Core::Utils::FunctionOfSpaceTime>(functnum - 1)
-                              .evaluate((ele->nodes()[jnode])->x().data(), time, isd);
+            const auto& x = ele->nodes()[point * node_stride]->x();
+            for (std::size_t i = 0; i < std::min<std::size_t>(3, x.size()); ++i)
+              point_coordinates(i, point) = x[i];
           }
-          else
-            functionfac = 1.0;
-
-          // get usual body force
-          if (condtype == "neum_dead" or condtype == "neum_live")
-            ebofoaf(isd, jnode) = num * functionfac;
-          // get prescribed pressure gradient
-          else if (condtype == "neum_pgrad")
-            eprescpgaf(isd, jnode) = num * functionfac;
-          else
-            FOUR_C_THROW("Unknown Neumann condition");
+          have_point_coordinates = true;
         }
+
+        Global::Problem::instance()
+            ->function_by_id<Core::Utils::FunctionOfSpaceTime>(functnum - 1)
+            .evaluate_points(
+                point_coordinates.data(), num_points, time, isd, functionfacs.data());
       }
       else
-        for (int jnode = 0; jnode < nen_; ++jnode)
-        {
-          if (functnum > 0)
-          {
-            // evaluate function at the position of the current node
-            // ------------------------------------------------------
-            // comment: this introduces an additional error compared to an
-            // evaluation at the integration point. However, we need a node
-            // based element bodyforce vector for prescribed pressure gradients
-            // in some fancy turbulance stuff.
-            functionfac = Global::Problem::instance()
-                              ->function_by_id<Core::Utils::FunctionOfSpaceTime>(functnum - 1)
-                              .evaluate((ele->nodes()[jnode])->x().data(), time, isd);
-          }
-          else
-            functionfac = 1.0;
-
-          // get usual body force
-          if (condtype == "neum_dead" or condtype == "neum_live")
-            ebofoaf(isd, jnode) = num * functionfac;
-          // get prescribed pressure gradient
-          else if (condtype == "neum_pgrad")
-            eprescpgaf(isd, jnode) = num * functionfac;
-          else
-            FOUR_C_THROW("Unknown Neumann condition");
-        }
+        functionfacs.put_scalar(1.0);
+
+      for (int point = 0; point < num_points; ++point)
+      {
+        const int jnode = point * node_stride;
+
+        // get usual body force
+        if (condtype == "neum_dead" or condtype == "neum_live")
+          ebofoaf(isd, jnode) = num * functionfacs(point);
+        // get prescribed pressure gradient
+        else if (condtype == "neum_pgrad")
+          eprescpgaf(isd, jnode) = num * functionfacs(point);
+        else
+          FOUR_C_THROW("Unknown Neumann condition");
+      }
     }
   }
 
@@ -173,6 +173,8 @@ void Global::Problem::open_control_file(const Epetra_Comm& comm, const std::stri
   outputcontrol_ = Teuchos::make_rcp<Core::IO::OutputControl>(comm, problem_name(),
       spatial_approximation_type(), inputfile, restartkenner, std::move(prefix), n_dim(), restart(),
       io_params().get<int>("FILESTEPS"), io_params().get<bool>("OUTPUT_BIN"), true);
+  outputcontrol_->set_write_collective_binary_output(
+      io_params().get<bool>("OUTPUT_BIN_COLLECTIVE"));
 
   if (!io_params().get<bool>("OUTPUT_BIN") && comm.MyPID() == 0)
   {
@@ -40,6 +40,7 @@
 
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 
+#include <sstream>
 #include <string>
 
 FOUR_C_NAMESPACE_OPEN
@@ -1341,6 +1342,9 @@ void Global::read_fields(
       break;
   }
 
+  set_evaluate_threads(problem);
+  set_element_matrix_caching(problem);
+
   if (read_mesh)  // now read and allocate!
   {
     // we read nodes and elements for the desired fields as specified above
@@ -1372,6 +1376,44 @@ void Global::read_fields(
   }  // if(read_mesh)
 }
 
+void Global::set_evaluate_threads(Global::Problem& problem)
+{
+  const auto& evaluate_threads =
+      problem.get_parameter_list()->sublist("DISCRETISATION").get<std::string>("EVALUATE_THREADS");
+  if (evaluate_threads == "none") return;
+
+  std::istringstream stream(evaluate_threads);
+  std::string name;
+  int num_threads;
+  while (stream >> name)
+  {
+    if (!(stream >> num_threads))
+      FOUR_C_THROW("EVALUATE_THREADS expects pairs of discretization name and number of threads.");
+    if (!problem.does_exist_dis(name))
+      FOUR_C_THROW("EVALUATE_THREADS: discretization '%s' does not exist.", name.c_str());
+
+    problem.get_dis(name)->set_num_evaluate_threads(num_threads);
+  }
+}
+
+void Global::set_element_matrix_caching(Global::Problem& problem)
+{
+  const auto& cached_discretizations = problem.get_parameter_list()
+                                           ->sublist("DISCRETISATION")
+                                           .get<std::string>("CACHE_ELEMENT_MATRICES");
+  if (cached_discretizations == "none") return;
+
+  std::istringstream stream(cached_discretizations);
+  std::string name;
+  while (stream >> name)
+  {
+    if (!problem.does_exist_dis(name))
+      FOUR_C_THROW("CACHE_ELEMENT_MATRICES: discretization '%s' does not exist.", name.c_str());
+
+    problem.get_dis(name)->set_element_matrix_caching(true);
+  }
+}
+
 void Global::read_micro_fields(Global::Problem& problem, const std::filesystem::path& input_path)
 {
   // check whether micro material is specified
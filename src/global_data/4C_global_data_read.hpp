@@ -22,6 +22,12 @@ namespace Global
   void read_fields(
       Global::Problem& problem, Core::IO::DatFileReader& reader, const bool read_mesh = true);
 
+  /// set the number of element loop threads of the discretizations named in EVALUATE_THREADS
+  void set_evaluate_threads(Global::Problem& problem);
+
+  /// switch on element matrix caching of the discretizations named in CACHE_ELEMENT_MATRICES
+  void set_element_matrix_caching(Global::Problem& problem);
+
   void read_micro_fields(Global::Problem& problem, const std::filesystem::path& input_path);
 
   /// set up supporting processors for micro-scale discretizations
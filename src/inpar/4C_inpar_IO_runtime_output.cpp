@@ -44,9 +44,28 @@ namespace Inpar
 
       // data format for written numeric data
       setStringToIntegralParameter<Core::IO::OutputDataFormat>("OUTPUT_DATA_FORMAT", "binary",
-          "data format for written numeric data", tuple<std::string>("binary", "ascii"),
-          tuple<Core::IO::OutputDataFormat>(
-              Core::IO::OutputDataFormat::binary, Core::IO::OutputDataFormat::ascii),
+          "data format for written numeric data: base64 encoded binary data inline, ascii data "
+          "inline or raw binary data appended to the end of each file",
+          tuple<std::string>("binary", "ascii", "appended"),
+          tuple<Core::IO::OutputDataFormat>(Core::IO::OutputDataFormat::binary,
+              Core::IO::OutputDataFormat::ascii, Core::IO::OutputDataFormat::appended),
+          &sublist_IO_VTK_structure);
+
+      // compression of binary numeric data
+      setStringToIntegralParameter<Core::IO::OutputCompression>("OUTPUT_COMPRESSION", "zlib",
+          "compression of binary numeric data", tuple<std::string>("none", "zlib"),
+          tuple<Core::IO::OutputCompression>(
+              Core::IO::OutputCompression::none, Core::IO::OutputCompression::zlib),
+          &sublist_IO_VTK_structure);
+
+      Core::Utils::int_parameter("OUTPUT_COMPRESSION_LEVEL", 9,
+          "zlib compression level between 0 (no compression) and 9 (smallest files). Lower levels "
+          "trade file size for faster output.",
+          &sublist_IO_VTK_structure);
+
+      // write floating point data in single precision
+      Core::Utils::bool_parameter("OUTPUT_SINGLE_PRECISION", "No",
+          "write floating point data in single precision to halve the size of the output",
           &sublist_IO_VTK_structure);
 
       // specify the maximum digits in the number of time steps that shall be written
@@ -76,6 +95,12 @@ namespace Inpar
           tuple<std::string>("vtu_per_rank"),
           tuple<Core::IO::OutputWriter>(Core::IO::OutputWriter::vtu_per_rank),
           &sublist_IO_VTK_structure);
+
+      // whether to write the output on a background thread
+      Core::Utils::bool_parameter("WRITE_ASYNCHRONOUSLY", "No",
+          "Copy the visualization data of a step and write it to disk on a background thread while "
+          "the simulation continues",
+          &sublist_IO_VTK_structure);
     }
 
 
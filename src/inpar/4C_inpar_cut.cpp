@@ -86,6 +86,12 @@ void Inpar::Cut::set_valid_parameters(Teuchos::ParameterList& list)
   // Integrate inside volume cells
   Core::Utils::bool_parameter("INTEGRATE_INSIDE_CELLS", "Yes",
       "Should the integration be done on inside cells", &cut_general);
+
+  // Threads used to create the integration rules of the cut elements
+  Core::Utils::int_parameter("FINALIZE_NUM_THREADS", 1,
+      "Number of threads used to create the DirectDivergence integration rules of the cut "
+      "elements. Elements sharing a node or a cut side are never processed at the same time.",
+      &cut_general);
 }
 
 FOUR_C_NAMESPACE_CLOSE
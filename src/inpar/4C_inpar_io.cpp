@@ -25,6 +25,10 @@ void Inpar::IO::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter("OUTPUT_ROT", "No", "", &io);
   Core::Utils::bool_parameter("OUTPUT_SPRING", "No", "", &io);
   Core::Utils::bool_parameter("OUTPUT_BIN", "yes", "Do you want to have binary output?", &io);
+  Core::Utils::bool_parameter("OUTPUT_BIN_COLLECTIVE", "no",
+      "Write the binary results of all processors collectively to one shared file per result file "
+      "instead of one file per processor. Requires HDF5 with MPI support.",
+      &io);
 
   // Output every iteration (for debugging purposes)
   Core::Utils::bool_parameter("OUTPUT_EVERY_ITER", "no",
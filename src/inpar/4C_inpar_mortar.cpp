@@ -35,9 +35,9 @@ void Inpar::Mortar::set_valid_parameters(Teuchos::ParameterList& list)
   setStringToIntegralParameter<Inpar::Mortar::SearchAlgorithm>("SEARCH_ALGORITHM", "Binarytree",
       "Type of contact search",
       tuple<std::string>("BruteForce", "bruteforce", "BruteForceEleBased", "bruteforceelebased",
-          "BinaryTree", "Binarytree", "binarytree"),
+          "BinaryTree", "Binarytree", "binarytree", "BoundingVolumeHierarchy", "bvh"),
       tuple<Inpar::Mortar::SearchAlgorithm>(search_bfele, search_bfele, search_bfele, search_bfele,
-          search_binarytree, search_binarytree, search_binarytree),
+          search_binarytree, search_binarytree, search_binarytree, search_bvh, search_bvh),
       &mortar);
 
   setStringToIntegralParameter<Inpar::Mortar::BinaryTreeUpdateType>("BINARYTREE_UPDATETYPE",
@@ -98,6 +98,12 @@ void Inpar::Mortar::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::int_parameter(
       "NUMGP_PER_DIM", 0, "Number of employed integration points per dimension", &mortar);
 
+  Core::Utils::int_parameter("NUM_THREADS", 1,
+      "Number of threads for the segment-to-segment coupling of the slave elements (a single "
+      "one without OpenMP, interfaces with quadratic or NURBS elements are always coupled "
+      "serially)",
+      &mortar);
+
   setStringToIntegralParameter<Inpar::Mortar::Triangulation>("TRIANGULATION", "Delaunay",
       "Type of triangulation for segment-based integration",
       tuple<std::string>("Delaunay", "delaunay", "Center", "center"),
@@ -51,8 +51,9 @@ namespace Inpar
     /// (this enum represents the input file parameter SEARCH_ALGORITHM)
     enum SearchAlgorithm
     {
-      search_bfele,      ///< brute force element-based
-      search_binarytree  ///< binary tree element based
+      search_bfele,       ///< brute force element-based
+      search_binarytree,  ///< binary tree element based
+      search_bvh          ///< bounding volume hierarchy element based (requires ArborX)
     };
 
     /// Local definition of problemtype to avoid use of globalproblem.H
@@ -71,6 +71,11 @@ void Inpar::PARTICLE::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter(
       "TRANSFER_EVERY", "no", "transfer particles to new bins every time step", &particledyn);
 
+  // reorder particles along a space-filling curve over bins
+  Core::Utils::bool_parameter("REORDER_PARTICLES", "no",
+      "reorder particles along a space-filling curve over bins when particles are transferred",
+      &particledyn);
+
   // considered particle phases with dynamic load balance weighting factor
   Core::Utils::string_parameter("PHASE_TO_DYNLOADBALFAC", "none",
       "considered particle phases with dynamic load balance weighting factor", &particledyn);
@@ -162,6 +167,20 @@ void Inpar::PARTICLE::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter("WRITE_PARTICLE_WALL_INTERACTION", "no",
       "write particle-wall interaction output", &particledynsph);
 
+  // skin distance of verlet list of particle pairs
+  Core::Utils::double_parameter("VERLET_LIST_SKIN", 0.0,
+      "skin distance of verlet list of particle pairs (disabled if not positive)",
+      &particledynsph);
+
+  // number of threads for evaluation of particle interactions
+  Core::Utils::int_parameter("NUM_THREADS", 1,
+      "number of threads per processor for evaluation of particle pair interactions",
+      &particledynsph);
+
+  // overlap refresh of ghosted particles with evaluation of interactions
+  Core::Utils::bool_parameter("ASYNC_GHOST_REFRESH", "no",
+      "overlap refresh of ghosted particles with evaluation of interactions", &particledynsph);
+
   // type of smoothed particle hydrodynamics kernel
   setStringToIntegralParameter<KernelType>("KERNEL", "CubicSpline",
       "type of smoothed particle hydrodynamics kernel",
@@ -435,6 +454,11 @@ void Inpar::PARTICLE::set_valid_parameters(Teuchos::ParameterList& list)
   Core::Utils::bool_parameter("WRITE_PARTICLE_WALL_INTERACTION", "no",
       "write particle-wall interaction output", &particledyndem);
 
+  // skin distance of verlet list of particle pairs
+  Core::Utils::double_parameter("VERLET_LIST_SKIN", 0.0,
+      "skin distance of verlet list of particle pairs (disabled if not positive)",
+      &particledyndem);
+
   // type of normal contact law
   setStringToIntegralParameter<NormalContact>("NORMALCONTACTLAW", "NormalLinearSpring",
       "normal contact law for particles",
@@ -33,6 +33,19 @@ void Inpar::Rebalance::set_valid_parameters(Teuchos::ParameterList& list)
       "Tolerance for relative imbalance of subdomain sizes for graph partitioning of unstructured "
       "meshes read from input files.",
       &meshpartitioning);
+
+  Core::Utils::bool_parameter("PARALLEL_READ", "No",
+      "Read the node and element sections of the input file in chunks on all processors instead "
+      "of reading them on processor 0 only. Requires the input file to be accessible from all "
+      "processors, e.g., on a shared file system.",
+      &meshpartitioning);
+
+  Core::Utils::bool_parameter("BINARY_MESH", "No",
+      "Store the partitioned mesh in a binary file next to the input file and read it from there "
+      "in subsequent runs with the same input file and number of processors. The file is "
+      "rewritten whenever the input file changes. Requires the file to be accessible from all "
+      "processors.",
+      &meshpartitioning);
 }
 
 FOUR_C_NAMESPACE_CLOSE
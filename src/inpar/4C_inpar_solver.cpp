@@ -48,13 +48,15 @@ namespace Inpar::SOLVER
           "Note! this preconditioner will only be used if the input operator\n"
           "supports the Epetra_RowMatrix interface and the client does not pass\n"
           "in an external preconditioner!",
-          Teuchos::tuple<std::string>("ILU", "MueLu", "MueLu_contactSP", "AMGnxn", "Teko"),
+          Teuchos::tuple<std::string>(
+              "ILU", "MueLu", "MueLu_contactSP", "AMGnxn", "Teko", "Chebyshev"),
           Teuchos::tuple<Core::LinearSolver::PreconditionerType>(
               Core::LinearSolver::PreconditionerType::ilu,
               Core::LinearSolver::PreconditionerType::multigrid_muelu,
               Core::LinearSolver::PreconditionerType::multigrid_muelu_contactsp,
               Core::LinearSolver::PreconditionerType::multigrid_nxn,
-              Core::LinearSolver::PreconditionerType::block_teko),
+              Core::LinearSolver::PreconditionerType::block_teko,
+              Core::LinearSolver::PreconditionerType::chebyshev),
           &list);
     }
 
@@ -71,6 +73,19 @@ namespace Inpar::SOLVER
           "Combine mode for Ifpack Additive Schwarz", &list, ifpack_combine_valid_input);
     }
 
+    // Chebyshev options
+    {
+      Core::Utils::int_parameter("CHEBYSHEV_DEGREE", 3,
+          "Polynomial degree of the \"Chebyshev\" preconditioner. It only needs the diagonal "
+          "and the application of the operator, so it also works with matrix-free operators.",
+          &list);
+
+      Core::Utils::double_parameter("CHEBYSHEV_EIGENVALUE_RATIO", 30.0,
+          "Ratio of the estimated largest eigenvalue of the Jacobi scaled operator to the lower "
+          "bound of the eigenvalue interval smoothed by the \"Chebyshev\" preconditioner",
+          &list);
+    }
+
     // Iterative solver options
     {
       Core::Utils::int_parameter("AZITER", 1000,
@@ -94,6 +109,12 @@ namespace Inpar::SOLVER
       Core::Utils::int_parameter(
           "AZREUSE", 0, "The number specifying how often to recompute some preconditioners", &list);
 
+      Core::Utils::double_parameter("AZREUSE_ITERATION_GROWTH", 0.0,
+          "Recompute the preconditioner as soon as a solve needs more than this factor times the "
+          "iterations of the first solve after the last recomputation. If positive, AZREUSE = 0 "
+          "allows unlimited reuse. Deactivated if zero.",
+          &list);
+
       Core::Utils::int_parameter("AZSUB", 50,
           "The maximum size of the Krylov subspace used with \"GMRES\" before\n"
           "a restart is performed.",
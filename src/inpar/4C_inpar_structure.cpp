@@ -291,6 +291,23 @@ namespace Inpar
 
       Core::Utils::bool_parameter("NEGLECTINERTIA", "No", "Neglect inertia", &sdyn);
 
+      Core::Utils::bool_parameter("FREEZE_MATRIX_PATTERN", "No",
+          "Cache the positions of all element matrix entries in the stiffness matrix after the "
+          "first assembly and add subsequent element matrices there directly",
+          &sdyn);
+
+      Core::Utils::bool_parameter("BATCHED_ELEMENT_EVALUATION", "No",
+          "Evaluate and assemble force and stiffness of eligible solid elements (hex8/tet10, "
+          "nonlinear kinematics, St. Venant-Kirchhoff) in vectorized batches",
+          &sdyn);
+
+      Core::Utils::bool_parameter("MATRIX_FREE_SOLVE", "No",
+          "Solve the linear systems of the Newton method with an operator that evaluates the "
+          "element stiffness matrices on the fly instead of the assembled stiffness matrix. Only "
+          "for INT_STRATEGY Old and statics without the TangDis predictor and LOADLIN, and only "
+          "with a preconditioner that does not need the matrix entries, e.g. AZPREC Chebyshev",
+          &sdyn);
+
       // Since predictor "none" would be misleading, the usage of no predictor is called vague.
       setStringToIntegralParameter<Solid::PredEnum>("PREDICT", "ConstDis", "Type of predictor",
           tuple<std::string>("Vague", "ConstDis", "ConstVel", "ConstAcc", "ConstDisVelAcc",
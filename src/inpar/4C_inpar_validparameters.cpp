@@ -343,6 +343,15 @@ Teuchos::RCP<const Teuchos::ParameterList> Input::valid_parameters()
   Core::Utils::int_parameter("NUMTHERMDIS", 1, "Number of meshes in thermal field", &discret);
   Core::Utils::int_parameter("NUMAIRWAYSDIS", 1,
       "Number of meshes in reduced dimensional airways network field", &discret);
+  Core::Utils::string_parameter("EVALUATE_THREADS", "none",
+      "Number of threads for the element loop of single discretizations, given as pairs of "
+      "discretization name and number of threads, e.g. 'structure 4 fluid 2'. Only use this for "
+      "discretizations whose elements evaluate thread-safe.",
+      &discret);
+  Core::Utils::string_parameter("CACHE_ELEMENT_MATRICES", "none",
+      "Names of the discretizations that reuse the stiffness matrices of elements with a "
+      "state-independent tangent (e.g. linear solid elements), e.g. 'structure'.",
+      &discret);
 
   /*----------------------------------------------------------------------*/
   Teuchos::ParameterList& size = list->sublist("PROBLEM SIZE", false, "");
@@ -0,0 +1,158 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_mortar_bounding_volume_search.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_geometric_search_bvh.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_mortar_element.hpp"
+#include "4C_mortar_node.hpp"
+
+#include <Teuchos_TimeMonitor.hpp>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+Mortar::BoundingVolumeSearch::BoundingVolumeSearch(Core::FE::Discretization& discret,
+    Teuchos::RCP<Epetra_Map> selements, Teuchos::RCP<Epetra_Map> melements, int dim, double eps,
+    bool useauxpos)
+    : idiscret_(discret), dim_(dim), eps_(eps), useauxpos_(useauxpos)
+{
+  if (dim_ != 2 && dim_ != 3) FOUR_C_THROW("Problem dimension must be either 2D or 3D.");
+
+  auto collect_elements =
+      [&](const Epetra_Map& elements, std::vector<Mortar::Element*>& mrtrelements,
+          std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>>& volumes)
+  {
+    mrtrelements.reserve(elements.NumMyElements());
+    volumes.reserve(elements.NumMyElements());
+    for (int i = 0; i < elements.NumMyElements(); ++i)
+    {
+      const int gid = elements.GID(i);
+      Core::Elements::Element* element = idiscret_.g_element(gid);
+      if (!element) FOUR_C_THROW("Cannot find element with gid %i", gid);
+      mrtrelements.emplace_back(dynamic_cast<Mortar::Element*>(element));
+      volumes.emplace_back(gid, Core::GeometricSearch::BoundingVolume());
+    }
+  };
+
+  collect_elements(*selements, selements_, svolumes_);
+  collect_elements(*melements, melements_, mvolumes_);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Mortar::BoundingVolumeSearch::evaluate_search()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Mortar::BoundingVolumeSearch::evaluate_search");
+
+  // reset candidates of all slave elements
+  for (Mortar::Element* sele : selements_) sele->mo_data().search_elements().resize(0);
+
+  // refit bounding volumes to current configuration
+  const double enlarge = eps_ * minimal_edge_size();
+  refit_bounding_volumes(selements_, svolumes_, enlarge);
+  refit_bounding_volumes(melements_, mvolumes_, enlarge);
+
+  // new collision search once a bounding volume left its enlarged one of the last search
+  if (numcollisionsearches_ == 0 or not is_inside_last_search_volumes())
+  {
+    // the skin equals the enlargement of the bounding volumes
+    searchsvolumes_ = svolumes_;
+    searchmvolumes_ = mvolumes_;
+    for (auto& [gid, volume] : searchsvolumes_) volume.extend_boundaries(enlarge);
+    for (auto& [gid, volume] : searchmvolumes_) volume.extend_boundaries(enlarge);
+
+    // intersect slave elements (predicates) with master elements (primitives)
+    const auto [indices, offsets] = Core::GeometricSearch::collision_search(
+        searchmvolumes_, searchsvolumes_, idiscret_.get_comm(), Core::IO::minimal);
+
+    candidates_.assign(selements_.size(), std::vector<int>());
+    for (std::size_t i = 0; i < selements_.size(); ++i)
+      for (int j = offsets[i]; j < offsets[i + 1]; ++j)
+        candidates_[i].push_back(searchmvolumes_[indices[j]].first);
+
+    ++numcollisionsearches_;
+  }
+
+  for (std::size_t i = 0; i < selements_.size(); ++i)
+    for (const int mgid : candidates_[i]) selements_[i]->add_search_elements(mgid);
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+bool Mortar::BoundingVolumeSearch::is_inside_last_search_volumes() const
+{
+  for (std::size_t i = 0; i < svolumes_.size(); ++i)
+    if (not searchsvolumes_[i].second.contains(svolumes_[i].second)) return false;
+
+  for (std::size_t i = 0; i < mvolumes_.size(); ++i)
+    if (not searchmvolumes_[i].second.contains(mvolumes_[i].second)) return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Mortar::BoundingVolumeSearch::refit_bounding_volumes(
+    const std::vector<Mortar::Element*>& elements,
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>>& volumes,
+    double enlarge) const
+{
+  Core::LinAlg::Matrix<3, 1> position;
+
+  for (std::size_t i = 0; i < elements.size(); ++i)
+  {
+    Mortar::Element* mrtrelement = elements[i];
+    Core::GeometricSearch::BoundingVolume& volume = volumes[i].second;
+    volume = Core::GeometricSearch::BoundingVolume();
+
+    Core::Nodes::Node** nodes = mrtrelement->nodes();
+    for (int k = 0; k < mrtrelement->num_node(); ++k)
+    {
+      const auto* mrtrnode = dynamic_cast<const Mortar::Node*>(nodes[k]);
+      for (int j = 0; j < 3; ++j) position(j) = mrtrnode->xspatial()[j];
+      volume.add_point(position);
+
+      // enlarge bounding volume with auxiliary position
+      if (useauxpos_)
+      {
+        // calculate element normal at current node
+        double xi[2] = {0.0, 0.0};
+        double normal[3] = {0.0, 0.0, 0.0};
+        mrtrelement->local_coordinates_of_node(k, xi);
+        mrtrelement->compute_unit_normal_at_xi(xi, normal);
+
+        double scalar = 0.0;
+        for (int j = 0; j < dim_; ++j)
+          scalar += (mrtrnode->x()[j] + mrtrnode->uold()[j] - mrtrnode->xspatial()[j]) * normal[j];
+
+        for (int j = 0; j < dim_; ++j) position(j) = mrtrnode->xspatial()[j] + scalar * normal[j];
+        volume.add_point(position);
+      }
+    }
+
+    volume.extend_boundaries(enlarge);
+  }
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+double Mortar::BoundingVolumeSearch::minimal_edge_size() const
+{
+  double lmin = 1.0e12;
+  for (const Mortar::Element* sele : selements_) lmin = std::min(lmin, sele->min_edge_size());
+  for (const Mortar::Element* mele : melements_) lmin = std::min(lmin, mele->min_edge_size());
+
+  if (lmin <= 0.0) FOUR_C_THROW("Minimal element length <= 0!");
+
+  return lmin;
+}
+
+FOUR_C_NAMESPACE_CLOSE
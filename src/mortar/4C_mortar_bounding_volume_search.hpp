@@ -0,0 +1,126 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_MORTAR_BOUNDING_VOLUME_SEARCH_HPP
+#define FOUR_C_MORTAR_BOUNDING_VOLUME_SEARCH_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_fem_geometric_search_bounding_volume.hpp"
+
+#include <Epetra_Map.h>
+#include <Teuchos_RCP.hpp>
+
+#include <utility>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Core::FE
+{
+  class Discretization;
+}  // namespace Core::FE
+
+namespace Mortar
+{
+  class Element;
+
+  /*!
+  \brief Contact search based on a bounding volume hierarchy
+
+  The slave elements (column map) are intersected with the master elements (full map) using the
+  ArborX-backed collision search of Core::GeometricSearch. The element sets are resolved once on
+  construction, i.e. whenever the interface topology changes. Every subsequent search only refits
+  the stored k-DOPs to the current nodal positions in place, so no element lookup or reallocation
+  happens per search.
+
+  The collision search itself is performed with bounding volumes enlarged by an additional skin.
+  As long as all refitted bounding volumes stay inside the enlarged ones of the last collision
+  search, the candidates found there are a superset of the current ones and are reused without
+  building and querying a new hierarchy.
+
+  */
+  class BoundingVolumeSearch
+  {
+   public:
+    /*!
+    \brief Standard constructor
+
+    \param discret (in): interface discretization
+    \param selements (in): all slave elements (column map)
+    \param melements (in): all master elements (full map)
+    \param dim (in): problem dimension
+    \param eps (in): factor used to enlarge the bounding volumes
+    \param useauxpos (in): flag indicating usage of auxiliary position for calculation of
+                           bounding volumes
+    */
+    BoundingVolumeSearch(Core::FE::Discretization& discret, Teuchos::RCP<Epetra_Map> selements,
+        Teuchos::RCP<Epetra_Map> melements, int dim, double eps, bool useauxpos);
+
+    /*!
+    \brief Evaluate search and store the master elements found for each slave element
+
+    The search elements of all slave elements are reset before the search.
+    */
+    void evaluate_search();
+
+    //! number of collision searches, i.e. searches that could not reuse the last candidates
+    int number_of_collision_searches() const { return numcollisionsearches_; }
+
+   private:
+    //! check whether all bounding volumes lie inside the enlarged ones of the last collision search
+    bool is_inside_last_search_volumes() const;
+
+    //! refit the bounding volumes to the current configuration of the given elements
+    void refit_bounding_volumes(const std::vector<Mortar::Element*>& elements,
+        std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>>& volumes,
+        double enlarge) const;
+
+    //! minimal edge length of all slave and master elements
+    double minimal_edge_size() const;
+
+    //! interface discretization
+    Core::FE::Discretization& idiscret_;
+
+    //! problem dimension
+    const int dim_;
+
+    //! factor used to enlarge the bounding volumes
+    const double eps_;
+
+    //! flag indicating usage of auxiliary position for calculation of bounding volumes
+    const bool useauxpos_;
+
+    //! all slave elements (column map)
+    std::vector<Mortar::Element*> selements_;
+
+    //! all master elements (full map)
+    std::vector<Mortar::Element*> melements_;
+
+    //! bounding volumes of slave elements (predicates), same order as selements_
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> svolumes_;
+
+    //! bounding volumes of master elements (primitives), same order as melements_
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> mvolumes_;
+
+    //! bounding volumes of slave elements used in the last collision search, enlarged by the skin
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> searchsvolumes_;
+
+    //! bounding volumes of master elements used in the last collision search, enlarged by the skin
+    std::vector<std::pair<int, Core::GeometricSearch::BoundingVolume>> searchmvolumes_;
+
+    //! master element candidates of each slave element found in the last collision search
+    std::vector<std::vector<int>> candidates_;
+
+    //! number of collision searches
+    int numcollisionsearches_ = 0;
+  };
+}  // namespace Mortar
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
@@ -17,6 +17,8 @@
 #include "4C_mortar_projector.hpp"
 #include "4C_mortar_utils.hpp"
 
+#include <atomic>
+
 FOUR_C_NAMESPACE_OPEN
 
 
@@ -1374,7 +1376,8 @@ void Mortar::Coupling3d::polygon_clipping(std::vector<Vertex>& poly1, std::vecto
     // - plot the result polygon and its vertex numbering
     // **********************************************************************
     std::ostringstream filename;
-    static int gmshcount = 0;
+    static std::atomic<int> numclipoutputs = 0;
+    const int gmshcount = numclipoutputs++;
     filename << "o/gmsh_output/"
              << "clipping_";
     if (gmshcount < 10)
@@ -1386,7 +1389,6 @@ void Mortar::Coupling3d::polygon_clipping(std::vector<Vertex>& poly1, std::vecto
     else if (gmshcount < 10000)
       FOUR_C_THROW("Gmsh output implemented for a maximum of 9.999 clip polygons");
     filename << gmshcount << ".pos";
-    gmshcount++;
 
     // do output to file in c-style
     FILE* fp = nullptr;
@@ -1665,7 +1667,8 @@ bool Mortar::Coupling3d::polygon_clipping_convex_hull(std::vector<Vertex>& poly1
       if (nearcheck && out)
       {
         std::ostringstream filename;
-        static int problemcount = 0;
+        static std::atomic<int> numproblemoutputs = 0;
+        const int problemcount = numproblemoutputs++;
         filename << "o/gmsh_output/"
                  << "problem_";
         if (problemcount < 10)
@@ -1682,7 +1685,6 @@ bool Mortar::Coupling3d::polygon_clipping_convex_hull(std::vector<Vertex>& poly1
         else
           FOUR_C_THROW("Gmsh output implemented for a maximum of 9.999 problem polygons");
         filename << problemcount << "_" << sid << "_" << mid << ".pos";
-        problemcount++;
 
         // do output to file in c-style
         FILE* fp = nullptr;
@@ -2486,7 +2488,8 @@ bool Mortar::Coupling3d::polygon_clipping_convex_hull(std::vector<Vertex>& poly1
   if (out)
   {
     std::ostringstream filename;
-    static int gmshcount = 0;
+    static std::atomic<int> numclipoutputs = 0;
+    const int gmshcount = numclipoutputs++;
     filename << "o/gmsh_output/"
              << "clipping_";
     if (gmshcount < 10)
@@ -2503,7 +2506,6 @@ bool Mortar::Coupling3d::polygon_clipping_convex_hull(std::vector<Vertex>& poly1
     else
       FOUR_C_THROW("Gmsh output implemented for a maximum of 9.999 clip polygons");
     filename << gmshcount << ".pos";
-    gmshcount++;
 
     // do output to file in c-style
     FILE* fp = nullptr;
@@ -3485,52 +3487,56 @@ void Mortar::Coupling3d::gmsh_output_cells(int lid) const
   // do output to file in c-style
   FILE* fp = nullptr;
 
-  // static variable
-  static int count = 0;
+  // the cell file and its counter are shared by all threads
+#pragma omp critical(mortar_coupling3d_gmsh_output_cells)
+  {
+    // static variable
+    static int count = 0;
 
-  // open file
-  if (count == 0)
-    fp = fopen(filename.str().c_str(), "w");
-  else
-    fp = fopen(filename.str().c_str(), "a");
+    // open file
+    if (count == 0)
+      fp = fopen(filename.str().c_str(), "w");
+    else
+      fp = fopen(filename.str().c_str(), "a");
 
-  // plot current integration cell
-  const Core::LinAlg::Matrix<3, 3>& coord = cells()[lid]->coords();
+    // plot current integration cell
+    const Core::LinAlg::Matrix<3, 3>& coord = cells()[lid]->coords();
 
-  // write output to temporary std::stringstream
-  std::stringstream gmshfilecontent;
+    // write output to temporary std::stringstream
+    std::stringstream gmshfilecontent;
 
-  // header and dummy elements
-  if (count == 0)
-  {
-    // header
-    gmshfilecontent << "View \"Integration Cells Proc " << proc << "\" {" << std::endl;
-
-    // dummy element 1
-    gmshfilecontent << "ST(" << std::scientific << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0
-                    << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << ")";
-    gmshfilecontent << "{" << std::scientific << 0 << "," << 0 << "," << 0 << "};" << std::endl;
-
-    // dummy element 1
-    gmshfilecontent << "ST(" << std::scientific << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0
-                    << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << ")";
-    gmshfilecontent << "{" << std::scientific << nproc - 1 << "," << nproc - 1 << "," << nproc - 1
-                    << "};" << std::endl;
-  }
+    // header and dummy elements
+    if (count == 0)
+    {
+      // header
+      gmshfilecontent << "View \"Integration Cells Proc " << proc << "\" {" << std::endl;
+
+      // dummy element 1
+      gmshfilecontent << "ST(" << std::scientific << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0
+                      << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << ")";
+      gmshfilecontent << "{" << std::scientific << 0 << "," << 0 << "," << 0 << "};" << std::endl;
+
+      // dummy element 1
+      gmshfilecontent << "ST(" << std::scientific << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0
+                      << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << "," << 0.0 << ")";
+      gmshfilecontent << "{" << std::scientific << nproc - 1 << "," << nproc - 1 << "," << nproc - 1
+                      << "};" << std::endl;
+    }
 
-  // plot cell itself
-  gmshfilecontent << "ST(" << std::scientific << coord(0, 0) << "," << coord(1, 0) << ","
-                  << coord(2, 0) << "," << coord(0, 1) << "," << coord(1, 1) << "," << coord(2, 1)
-                  << "," << coord(0, 2) << "," << coord(1, 2) << "," << coord(2, 2) << ")";
-  gmshfilecontent << "{" << std::scientific << proc << "," << proc << "," << proc << "};"
-                  << std::endl;
+    // plot cell itself
+    gmshfilecontent << "ST(" << std::scientific << coord(0, 0) << "," << coord(1, 0) << ","
+                    << coord(2, 0) << "," << coord(0, 1) << "," << coord(1, 1) << "," << coord(2, 1)
+                    << "," << coord(0, 2) << "," << coord(1, 2) << "," << coord(2, 2) << ")";
+    gmshfilecontent << "{" << std::scientific << proc << "," << proc << "," << proc << "};"
+                    << std::endl;
 
-  // move everything to gmsh post-processing files and close them
-  fprintf(fp, "%s", gmshfilecontent.str().c_str());
-  fclose(fp);
+    // move everything to gmsh post-processing files and close them
+    fprintf(fp, "%s", gmshfilecontent.str().c_str());
+    fclose(fp);
 
-  // increase static variable
-  count += 1;
+    // increase static variable
+    count += 1;
+  }
 
   return;
 }
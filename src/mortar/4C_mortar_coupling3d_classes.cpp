@@ -812,8 +812,8 @@ void Mortar::IntCell::deriv_jacobian(Core::Gen::Pairedvector<int, double>& deriv
   else if (shape() == Core::FE::CellType::tri3)
   {
     // metrics routine gives local basis vectors
-    static std::vector<double> gxi(3);
-    static std::vector<double> geta(3);
+    static thread_local std::vector<double> gxi(3);
+    static thread_local std::vector<double> geta(3);
 
     for (int k = 0; k < 3; ++k)
     {
@@ -719,9 +719,9 @@ void Mortar::IntegratorCalc<distype_s, distype_m>::integrate_ele_based_2d(Mortar
   int nodemaster = meles[0]->num_node();
 
   // create empty vectors for shape fct. evaluation
-  static Core::LinAlg::Matrix<ns_, 1> sval;
-  static Core::LinAlg::Matrix<nm_, 1> mval;
-  static Core::LinAlg::Matrix<ns_, 1> lmval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> sval;
+  static thread_local Core::LinAlg::Matrix<nm_, 1> mval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> lmval;
 
   // get slave element nodes themselves
   Core::Nodes::Node** mynodes = sele.nodes();
@@ -857,9 +857,9 @@ void Mortar::IntegratorCalc<distype_s, distype_m>::integrate_segment_2d(Mortar::
   int ndof = dynamic_cast<Mortar::Node*>(sele.nodes()[0])->num_dof();
 
   // create empty vectors for shape fct. evaluation
-  static Core::LinAlg::Matrix<ns_, 1> sval;
-  static Core::LinAlg::Matrix<nm_, 1> mval;
-  static Core::LinAlg::Matrix<ns_, 1> lmval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> sval;
+  static thread_local Core::LinAlg::Matrix<nm_, 1> mval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> lmval;
 
   // get slave element nodes themselves
   Core::Nodes::Node** mynodes = sele.nodes();
@@ -1404,9 +1404,9 @@ void Mortar::IntegratorCalc<distype_s, distype_m>::integrate_ele_based_3d(Mortar
   int ndof = dynamic_cast<Mortar::Node*>(sele.nodes()[0])->num_dof();
 
   // create empty vectors for shape fct. evaluation
-  static Core::LinAlg::Matrix<ns_, 1> sval;
-  static Core::LinAlg::Matrix<nm_, 1> mval;
-  static Core::LinAlg::Matrix<ns_, 1> lmval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> sval;
+  static thread_local Core::LinAlg::Matrix<nm_, 1> mval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> lmval;
 
   //**********************************************************************
   // loop over all Gauss points for integration
@@ -1534,9 +1534,9 @@ void Mortar::IntegratorCalc<distype_s, distype_m>::integrate_cell_3d_aux_plane(
   int ndof = dynamic_cast<Mortar::Node*>(sele.nodes()[0])->num_dof();
 
   // create empty vectors for shape fct. evaluation
-  static Core::LinAlg::Matrix<ns_, 1> sval;
-  static Core::LinAlg::Matrix<nm_, 1> mval;
-  static Core::LinAlg::Matrix<ns_, 1> lmval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> sval;
+  static thread_local Core::LinAlg::Matrix<nm_, 1> mval;
+  static thread_local Core::LinAlg::Matrix<ns_, 1> lmval;
 
   //---------------------------------
   // do trafo for bound elements
@@ -19,6 +19,7 @@
 #include "4C_linalg_utils_sparse_algebra_manipulation.hpp"
 #include "4C_linalg_vector.hpp"
 #include "4C_mortar_binarytree.hpp"
+#include "4C_mortar_bounding_volume_search.hpp"
 #include "4C_mortar_coupling2d.hpp"
 #include "4C_mortar_coupling3d.hpp"
 #include "4C_mortar_coupling3d_classes.hpp"
@@ -28,6 +29,7 @@
 #include "4C_mortar_integrator.hpp"
 #include "4C_mortar_interface_utils.hpp"
 #include "4C_mortar_node.hpp"
+#include "4C_mortar_projector.hpp"
 #include "4C_mortar_utils.hpp"
 #include "4C_poroelast_scatra_utils.hpp"
 #include "4C_rebalance_binning_based.hpp"
@@ -39,8 +41,14 @@
 #include <Teuchos_Time.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <exception>
+#include <set>
 #include <utility>
 
+#ifdef FOUR_C_WITH_OPENMP
+#include <omp.h>
+#endif
+
 FOUR_C_NAMESPACE_OPEN
 
 /*----------------------------------------------------------------------------*
@@ -78,6 +86,7 @@ Mortar::InterfaceDataContainer::InterfaceDataContainer()
       maxdofglobal_(-1),
       searchalgo_(Inpar::Mortar::search_binarytree),
       binarytree_(Teuchos::null),
+      boundingvolumesearch_(Teuchos::null),
       searchparam_(-1.0),
       searchuseauxpos_(false),
       inttime_interface_(0.0),
@@ -127,6 +136,7 @@ Mortar::Interface::Interface(Teuchos::RCP<Mortar::InterfaceDataContainer> interf
       maxdofglobal_(interface_data_->max_dof_global()),
       searchalgo_(interface_data_->search_algorithm()),
       binarytree_(interface_data_->binary_tree()),
+      boundingvolumesearch_(interface_data_->bounding_volume_search()),
       searchparam_(interface_data_->search_param()),
       searchuseauxpos_(interface_data_->search_use_aux_pos()),
       inttime_interface_(interface_data_->int_time_interface()),
@@ -197,6 +207,7 @@ Mortar::Interface::Interface(Teuchos::RCP<InterfaceDataContainer> interfaceData,
       maxdofglobal_(interface_data_->max_dof_global()),
       searchalgo_(interface_data_->search_algorithm()),
       binarytree_(interface_data_->binary_tree()),
+      boundingvolumesearch_(interface_data_->bounding_volume_search()),
       searchparam_(interface_data_->search_param()),
       searchuseauxpos_(interface_data_->search_use_aux_pos()),
       inttime_interface_(interface_data_->int_time_interface()),
@@ -1561,8 +1572,9 @@ void Mortar::Interface::create_search_tree()
     std::cout << "*****************************************************************\n";
   }
 #endif
-  // binary tree search
-  if (search_alg() == Inpar::Mortar::search_binarytree)
+  // binary tree or bounding volume hierarchy search
+  if (search_alg() == Inpar::Mortar::search_binarytree ||
+      search_alg() == Inpar::Mortar::search_bvh)
   {
     // create fully overlapping map of all master elements
     // for non-redundant storage (RRloop) we handle the master elements
@@ -1570,10 +1582,6 @@ void Mortar::Interface::create_search_tree()
     auto strat = Teuchos::getIntegralValue<Inpar::Mortar::ExtendGhosting>(
         interface_params().sublist("PARALLEL REDISTRIBUTION"), "GHOSTING_STRATEGY");
 
-    // get update type of binary tree
-    auto updatetype = Teuchos::getIntegralValue<Inpar::Mortar::BinaryTreeUpdateType>(
-        interface_params(), "BINARYTREE_UPDATETYPE");
-
     Teuchos::RCP<Epetra_Map> melefullmap = Teuchos::null;
     switch (strat)
     {
@@ -1596,11 +1604,25 @@ void Mortar::Interface::create_search_tree()
       }
     }
 
-    // create binary tree object for search and setup tree
-    binarytree_ = Teuchos::make_rcp<Mortar::BinaryTree>(discret(), selecolmap_, melefullmap,
-        n_dim(), search_param(), updatetype, search_use_aux_pos());
-    // initialize the binary tree
-    binarytree_->init();
+    if (search_alg() == Inpar::Mortar::search_binarytree)
+    {
+      // get update type of binary tree
+      auto updatetype = Teuchos::getIntegralValue<Inpar::Mortar::BinaryTreeUpdateType>(
+          interface_params(), "BINARYTREE_UPDATETYPE");
+
+      // create binary tree object for search and setup tree
+      binarytree_ = Teuchos::make_rcp<Mortar::BinaryTree>(discret(), selecolmap_, melefullmap,
+          n_dim(), search_param(), updatetype, search_use_aux_pos());
+      // initialize the binary tree
+      binarytree_->init();
+    }
+    else
+    {
+      // create bounding volume search object for the current interface topology, its bounding
+      // volumes are only refitted in subsequent searches
+      boundingvolumesearch_ = Teuchos::make_rcp<Mortar::BoundingVolumeSearch>(discret(),
+          selecolmap_, melefullmap, n_dim(), search_param(), search_use_aux_pos());
+    }
   }
 }
 
@@ -2156,12 +2178,7 @@ void Mortar::Interface::evaluate_geometry(std::vector<Teuchos::RCP<Mortar::IntCe
   //**********************************************************************
   // search algorithm
   //**********************************************************************
-  if (search_alg() == Inpar::Mortar::search_bfele)
-    evaluate_search_brute_force(search_param());
-  else if (search_alg() == Inpar::Mortar::search_binarytree)
-    evaluate_search_binarytree();
-  else
-    FOUR_C_THROW("Invalid search algorithm");
+  evaluate_search();
 
   // create normals
   evaluate_nodal_normals();
@@ -2380,6 +2397,23 @@ void Mortar::Interface::evaluate_sts(
 {
   TEUCHOS_FUNC_TIME_MONITOR("Mortar::Interface::EvaluateSTS");
 
+  const int requestedthreads = interface_params().get<int>("NUM_THREADS", 1);
+  if (requestedthreads < 1)
+    FOUR_C_THROW("Number of threads must be positive, got %d", requestedthreads);
+
+  // without OpenMP the slave elements are coupled on a single thread
+#ifdef FOUR_C_WITH_OPENMP
+  const int numthreads = requestedthreads;
+#else
+  const int numthreads = 1;
+#endif
+
+  // slave elements and their candidate master elements for threaded coupling
+  const bool threaded = numthreads > 1 and is_mortar_coupling_thread_safe();
+  std::vector<Mortar::Element*> selements;
+  std::vector<std::vector<Mortar::Element*>> melementsofslave;
+  bool linear = true;
+
   // loop over all slave col elements
   for (int i = 0; i < selecolmap.NumMyElements(); ++i)
   {
@@ -2410,9 +2444,138 @@ void Mortar::Interface::evaluate_sts(
       melements.push_back(melement);
     }
 
+    if (threaded)
+    {
+      // only linear Lagrange elements are coupled without shared integration elements
+      for (const Mortar::Element* element : melements)
+        linear = linear and not element->is_quad() and not element->is_nurbs();
+      linear = linear and not selement->is_quad() and not selement->is_nurbs();
+
+      selements.emplace_back(selement);
+      melementsofslave.emplace_back(std::move(melements));
+      continue;
+    }
+
     // concrete coupling evaluation routine
     mortar_coupling(selement, melements, mparams_ptr);
   }
+
+  if (not threaded) return;
+
+  if (linear)
+  {
+    evaluate_sts_threaded(selements, melementsofslave, mparams_ptr, numthreads);
+  }
+  else
+  {
+    for (std::size_t i = 0; i < selements.size(); ++i)
+      mortar_coupling(selements[i], melementsofslave[i], mparams_ptr);
+  }
+}
+
+/*----------------------------------------------------------------------*
+ *----------------------------------------------------------------------*/
+void Mortar::Interface::evaluate_sts_threaded(const std::vector<Mortar::Element*>& selements,
+    const std::vector<std::vector<Mortar::Element*>>& melements,
+    const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr, const int numthreads)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Mortar::Interface::evaluate_sts_threaded");
+
+  // the projector and integrator singletons are created lazily, which is not thread-safe, so all
+  // of them are created here for every combination of element shapes
+  std::set<std::pair<Core::FE::CellType, Core::FE::CellType>> shapes;
+  for (std::size_t i = 0; i < selements.size(); ++i)
+  {
+    for (Mortar::Element* melement : melements[i])
+    {
+      if (not shapes.emplace(selements[i]->shape(), melement->shape()).second) continue;
+
+      Mortar::Projector::impl(*selements[i]);
+      Mortar::Projector::impl(*melement);
+      Mortar::Projector::impl(*selements[i], *melement);
+      Mortar::Integrator::impl(*selements[i], *melement, interface_params());
+    }
+  }
+
+  // greedy coloring such that slave elements of one color share no slave node, the forbidden
+  // colors are marked with the index of the current slave element to avoid resetting them
+  std::vector<int> elementcolor(discret().num_my_col_elements(), -1);
+  std::vector<int> forbidden;
+  std::vector<std::vector<int>> colors;
+
+  for (std::size_t i = 0; i < selements.size(); ++i)
+  {
+    Core::Nodes::Node** nodes = selements[i]->nodes();
+    for (int k = 0; k < selements[i]->num_node(); ++k)
+    {
+      Core::Elements::Element** adjacentelements = nodes[k]->elements();
+      for (int j = 0; j < nodes[k]->num_element(); ++j)
+      {
+        const int adjacentcolor = elementcolor[adjacentelements[j]->lid()];
+        if (adjacentcolor >= 0) forbidden[adjacentcolor] = static_cast<int>(i);
+      }
+    }
+
+    int color = 0;
+    while (color < static_cast<int>(colors.size()) and forbidden[color] == static_cast<int>(i))
+      ++color;
+
+    if (color == static_cast<int>(colors.size()))
+    {
+      colors.emplace_back();
+      forbidden.emplace_back(-1);
+    }
+
+    elementcolor[selements[i]->lid()] = color;
+    colors[color].emplace_back(static_cast<int>(i));
+  }
+
+  // reading a parameter marks it as used and reading a missing one with a default inserts it, so
+  // every thread works on its own copy of the interface parameters, which is made up front since
+  // copying touches the reference counts of parameters held by RCP
+  std::vector<Teuchos::ParameterList> threadparams(numthreads, interface_params());
+
+  // exceptions must not leave a parallel region, so the first one is kept and rethrown afterwards
+  std::exception_ptr exception = nullptr;
+
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp parallel num_threads(numthreads)
+#endif
+  {
+    // non-owning handle per thread, such that reference counting does not touch the shared node
+    const Teuchos::RCP<Mortar::ParamsInterface> threadmparams_ptr =
+        mparams_ptr.is_null() ? Teuchos::null : Teuchos::rcpFromRef(*mparams_ptr);
+
+#ifdef FOUR_C_WITH_OPENMP
+    Teuchos::ParameterList& params = threadparams[omp_get_thread_num()];
+#else
+    Teuchos::ParameterList& params = threadparams[0];
+#endif
+
+    for (const auto& color : colors)
+    {
+      // the implicit barrier at the end of the work-sharing loop separates the colors
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp for schedule(dynamic, 4)
+#endif
+      for (std::size_t i = 0; i < color.size(); ++i)
+      {
+        try
+        {
+          mortar_coupling(selements[color[i]], melements[color[i]], threadmparams_ptr, params);
+        }
+        catch (...)
+        {
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp critical(mortar_evaluate_sts_threaded_exception)
+#endif
+          if (!exception) exception = std::current_exception();
+        }
+      }
+    }
+  }
+
+  if (exception) std::rethrow_exception(exception);
 }
 
 
@@ -2498,12 +2661,7 @@ void Mortar::Interface::pre_evaluate(const int& step, const int& iter)
   //**********************************************************************
   // search algorithm
   //**********************************************************************
-  if (search_alg() == Inpar::Mortar::search_bfele)
-    evaluate_search_brute_force(search_param());
-  else if (search_alg() == Inpar::Mortar::search_binarytree)
-    evaluate_search_binarytree();
-  else
-    FOUR_C_THROW("Invalid search algorithm");
+  evaluate_search();
 
     // TODO: maybe we can remove this debug functionality
 #ifdef MORTARGMSHCELLS
@@ -3055,11 +3213,31 @@ bool Mortar::Interface::evaluate_search_binarytree()
   return true;
 }
 
+/*----------------------------------------------------------------------*
+ |  Search for potentially coupling sl/ma pairs (public)                |
+ *----------------------------------------------------------------------*/
+void Mortar::Interface::evaluate_search()
+{
+  if (search_alg() == Inpar::Mortar::search_bfele)
+    evaluate_search_brute_force(search_param());
+  else if (search_alg() == Inpar::Mortar::search_binarytree)
+    evaluate_search_binarytree();
+  else if (search_alg() == Inpar::Mortar::search_bvh)
+    evaluate_search_bvh();
+  else
+    FOUR_C_THROW("Invalid search algorithm");
+}
+
+/*----------------------------------------------------------------------*
+ |  Search for potentially coupling sl/ma pairs with BVH (public)       |
+ *----------------------------------------------------------------------*/
+void Mortar::Interface::evaluate_search_bvh() { boundingvolumesearch_->evaluate_search(); }
+
 /*----------------------------------------------------------------------*
  |  Integrate matrix M and gap g on slave/master overlap      popp 11/08|
  *----------------------------------------------------------------------*/
 bool Mortar::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Mortar::Element*> mele,
-    const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr)
+    const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr, Teuchos::ParameterList& params)
 {
   pre_mortar_coupling(sele, mele, mparams_ptr);
 
@@ -3082,7 +3260,7 @@ bool Mortar::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Morta
     // interpolation need any special treatment in the 2d case
 
     // create Coupling2dManager and evaluate
-    Mortar::Coupling2dManager(discret(), n_dim(), quadratic, interface_params(), sele, mele)
+    Mortar::Coupling2dManager(discret(), n_dim(), quadratic, params, sele, mele)
         .evaluate_coupling(mparams_ptr);
   }
   // ************************************************************** 3D ***
@@ -3092,7 +3270,7 @@ bool Mortar::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Morta
     if (!quadratic)
     {
       // create Coupling3dManager and evaluate
-      Mortar::Coupling3dManager(discret(), n_dim(), false, interface_params(), sele, mele)
+      Mortar::Coupling3dManager(discret(), n_dim(), false, params, sele, mele)
           .evaluate_coupling(mparams_ptr);
     }
 
@@ -3100,7 +3278,7 @@ bool Mortar::Interface::mortar_coupling(Mortar::Element* sele, std::vector<Morta
     else
     {
       // create Coupling3dQuadManager and evaluate
-      Mortar::Coupling3dQuadManager(discret(), n_dim(), false, interface_params(), sele, mele)
+      Mortar::Coupling3dQuadManager(discret(), n_dim(), false, params, sele, mele)
           .evaluate_coupling(mparams_ptr);
     }  // quadratic
   }    // 3D
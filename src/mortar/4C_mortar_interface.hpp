@@ -56,6 +56,7 @@ namespace Mortar
   class Element;
   class IntElement;
   class BinaryTree;
+  class BoundingVolumeSearch;
   class IntCell;
   class ParamsInterface;
 
@@ -340,6 +341,16 @@ namespace Mortar
 
     inline Teuchos::RCP<const Mortar::BinaryTree> binary_tree() const { return binarytree_; }
 
+    inline Teuchos::RCP<Mortar::BoundingVolumeSearch>& bounding_volume_search()
+    {
+      return boundingvolumesearch_;
+    }
+
+    inline Teuchos::RCP<const Mortar::BoundingVolumeSearch> bounding_volume_search() const
+    {
+      return boundingvolumesearch_;
+    }
+
     inline double& search_param() { return searchparam_; }
 
     inline double search_param() const { return searchparam_; }
@@ -531,6 +542,9 @@ namespace Mortar
     //! binary searchtree
     Teuchos::RCP<Mortar::BinaryTree> binarytree_;
 
+    //! bounding volume hierarchy search
+    Teuchos::RCP<Mortar::BoundingVolumeSearch> boundingvolumesearch_;
+
     //! search parameter
     double searchparam_;
 
@@ -1095,7 +1109,8 @@ namespace Mortar
     /*!
     \brief Create binary search tree
 
-    The methods creates a binary tree object for efficient search.
+    The methods creates a binary tree object for efficient search. For the bounding volume
+    hierarchy search, the element sets of the bounding volume search object are set up instead.
 
     */
     virtual void create_search_tree();
@@ -1247,9 +1262,21 @@ namespace Mortar
     /*!
     \brief Integrate Mortar matrices D and M and gap g on slave/master overlaps
 
+    */
+    bool mortar_coupling(Mortar::Element* sele, std::vector<Mortar::Element*> mele,
+        const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr)
+    {
+      return mortar_coupling(sele, mele, mparams_ptr, interface_params());
+    }
+
+    /*!
+    \brief Integrate Mortar matrices D and M and gap g on slave/master overlaps
+
+    The interface parameters are passed explicitly, such that concurrent calls can each work on
+    their own copy.
     */
     virtual bool mortar_coupling(Mortar::Element* sele, std::vector<Mortar::Element*> mele,
-        const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr);
+        const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr, Teuchos::ParameterList& params);
 
     /*!
     \brief Assemble lagrange multipliers into global z vector (penalty strategy)
@@ -1307,6 +1334,12 @@ namespace Mortar
     void create_volume_ghosting(
         const std::map<std::string, Teuchos::RCP<Core::FE::Discretization>>& discretization_map);
 
+    /*!
+    \brief Search for potentially coupling slave / master pairs with the
+           search algorithm chosen for this interface
+    */
+    void evaluate_search();
+
     /*!
     \brief Binary tree search algorithm for potentially coupling
            slave / master pairs (element-based algorithm)
@@ -1319,6 +1352,12 @@ namespace Mortar
     */
     void evaluate_search_brute_force(const double& eps);
 
+    /*!
+    \brief Bounding volume hierarchy search algorithm for potentially coupling
+           slave / master pairs (element-based algorithm)
+    */
+    void evaluate_search_bvh();
+
     /*!
     \brief find meles for one snode
     */
@@ -1472,6 +1511,14 @@ namespace Mortar
     virtual void evaluate_sts(
         const Epetra_Map& selecolmap, const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr);
 
+    /*!
+    \brief Return whether mortar_coupling() may be called concurrently for slave elements which
+    share no slave node
+
+    This requires the coupling of one slave element to write only to its own slave nodes.
+    */
+    virtual bool is_mortar_coupling_thread_safe() const { return true; }
+
     /*!
     \brief Evaluate node-to-segment coupling
 
@@ -1776,6 +1823,16 @@ namespace Mortar
     */
     void set_shape_function_type();
 
+    /*!
+    \brief Evaluate segment-to-segment coupling of the given slave elements on several threads
+
+    The slave elements are colored such that elements of one color share no slave node. All
+    elements of one color are coupled concurrently, the colors are processed one after another.
+    */
+    void evaluate_sts_threaded(const std::vector<Mortar::Element*>& selements,
+        const std::vector<std::vector<Mortar::Element*>>& melements,
+        const Teuchos::RCP<Mortar::ParamsInterface>& mparams_ptr, int numthreads);
+
     /// pointer to the interface data object
     Teuchos::RCP<InterfaceDataContainer> interface_data_;
 
@@ -1839,6 +1896,8 @@ namespace Mortar
 
     Inpar::Mortar::SearchAlgorithm& searchalgo_;    ///< ref. to type of search algorithm
     Teuchos::RCP<Mortar::BinaryTree>& binarytree_;  ///< ref. to binary searchtree
+    Teuchos::RCP<Mortar::BoundingVolumeSearch>&
+        boundingvolumesearch_;                      ///< ref. to bounding volume hierarchy search
     double& searchparam_;                           ///< ref. to search parameter
     bool& searchuseauxpos_;      ///< ref. to use auxiliary position when computing dops
     double& inttime_interface_;  ///< ref. to integration time
@@ -26,6 +26,10 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -38,6 +42,7 @@ PARTICLEENGINE::ParticleEngine::ParticleEngine(
       params_(params),
       minbinsize_(0.0),
       typevectorsize_(0),
+      potentialparticleneighborsbuildcount_(0),
       validownedparticles_(false),
       validghostedparticles_(false),
       validparticleneighbors_(false),
@@ -298,6 +303,9 @@ void PARTICLEENGINE::ParticleEngine::distribute_particles(
   // insert owned particles received from other processors
   insert_owned_particles(particlestoinsert);
 
+  // reorder owned particles along a space-filling curve
+  if (params_.get<bool>("REORDER_PARTICLES")) reorder_owned_particles_along_space_filling_curve();
+
   // store particle positions after transfer of particles
   store_positions_after_particle_transfer();
 
@@ -316,6 +324,9 @@ void PARTICLEENGINE::ParticleEngine::transfer_particles()
   // relate owned particles to bins
   if (not validownedparticles_) relate_owned_particles_to_bins();
 
+  // finish pending refresh of particles
+  finish_refresh_particles();
+
   // check particles for periodic boundaries/leaving domain
   check_particles_at_boundaries(particlestoremove);
 
@@ -331,6 +342,9 @@ void PARTICLEENGINE::ParticleEngine::transfer_particles()
   // insert owned particles received from other processors
   insert_owned_particles(particlestoinsert);
 
+  // reorder owned particles along a space-filling curve
+  if (params_.get<bool>("REORDER_PARTICLES")) reorder_owned_particles_along_space_filling_curve();
+
   // store particle positions after transfer of particles
   store_positions_after_particle_transfer();
 
@@ -349,6 +363,9 @@ void PARTICLEENGINE::ParticleEngine::ghost_particles()
   std::vector<std::vector<std::pair<int, ParticleObjShrdPtr>>> particlestoinsert(typevectorsize_);
   std::map<int, std::map<ParticleType, std::map<int, std::pair<int, int>>>> directghosting;
 
+  // finish pending refresh of particles
+  finish_refresh_particles();
+
   // clear all containers of ghosted particles
   particlecontainerbundle_->clear_all_containers_of_specific_status(Ghosted);
 
@@ -405,6 +422,51 @@ void PARTICLEENGINE::ParticleEngine::refresh_particles_of_specific_states_and_ty
   insert_refreshed_particles(particlestoinsert);
 }
 
+void PARTICLEENGINE::ParticleEngine::start_refresh_particles_of_specific_states_and_types(
+    const StatesOfTypesToRefresh& particlestatestotypes) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "PARTICLEENGINE::ParticleEngine::start_refresh_particles_of_specific_states_and_types");
+
+  // finish pending refresh of particles
+  finish_refresh_particles();
+
+  std::vector<std::vector<ParticleObjShrdPtr>> particlestosend(comm_.NumProc());
+  std::map<int, std::vector<char>> sdata;
+
+  // determine particles that need to be refreshed
+  determine_specific_states_of_particles_of_specific_types_to_be_refreshed(
+      particlestatestotypes, particlestosend);
+
+  // pack data for sending
+  pack_particles(particlestosend, sdata);
+
+  // start communication of data via non-blocking send from proc to proc
+  pendingrefresh_ = std::make_unique<COMMUNICATION::PendingCommunication>();
+  COMMUNICATION::immediate_recv_immediate_send_start(comm_, sdata, *pendingrefresh_);
+}
+
+void PARTICLEENGINE::ParticleEngine::finish_refresh_particles() const
+{
+  // no pending refresh of particles
+  if (not pendingrefresh_) return;
+
+  TEUCHOS_FUNC_TIME_MONITOR("PARTICLEENGINE::ParticleEngine::finish_refresh_particles");
+
+  std::map<int, std::vector<char>> rdata;
+  std::vector<std::vector<std::pair<int, ParticleObjShrdPtr>>> particlestoinsert(typevectorsize_);
+
+  // finish communication of data
+  COMMUNICATION::immediate_recv_immediate_send_finish(*pendingrefresh_, rdata);
+  pendingrefresh_.reset();
+
+  // unpack and store received data
+  unpack_particles(rdata, particlestoinsert);
+
+  // insert refreshed particles received from other processors
+  insert_refreshed_particles(particlestoinsert);
+}
+
 void PARTICLEENGINE::ParticleEngine::dynamic_load_balancing()
 {
   TEUCHOS_FUNC_TIME_MONITOR("PARTICLEENGINE::ParticleEngine::dynamic_load_balancing");
@@ -586,6 +648,9 @@ void PARTICLEENGINE::ParticleEngine::build_particle_to_particle_neighbors()
     }
   }
 
+  // increase number of builds of potential particle neighbors
+  ++potentialparticleneighborsbuildcount_;
+
   // validate flag denoting validity of particle neighbors map
   validparticleneighbors_ = true;
 }
@@ -1704,10 +1769,27 @@ void PARTICLEENGINE::ParticleEngine::communicate_particles(
     std::vector<std::vector<ParticleObjShrdPtr>>& particlestosend,
     std::vector<std::vector<std::pair<int, ParticleObjShrdPtr>>>& particlestoreceive) const
 {
+  // finish pending refresh of particles
+  finish_refresh_particles();
+
   // prepare buffer for sending and receiving
   std::map<int, std::vector<char>> sdata;
   std::map<int, std::vector<char>> rdata;
 
+  // pack data for sending
+  pack_particles(particlestosend, sdata);
+
+  // communicate data via non-buffered send from proc to proc
+  COMMUNICATION::immediate_recv_blocking_send(comm_, sdata, rdata);
+
+  // unpack and store received data
+  unpack_particles(rdata, particlestoreceive);
+}
+
+void PARTICLEENGINE::ParticleEngine::pack_particles(
+    std::vector<std::vector<ParticleObjShrdPtr>>& particlestosend,
+    std::map<int, std::vector<char>>& sdata) const
+{
   // pack data for sending
   for (int torank = 0; torank < comm_.NumProc(); ++torank)
   {
@@ -1723,18 +1805,17 @@ void PARTICLEENGINE::ParticleEngine::communicate_particles(
 
   // clear after all particles are packed
   particlestosend.clear();
+}
 
-  // communicate data via non-buffered send from proc to proc
-  COMMUNICATION::immediate_recv_blocking_send(comm_, sdata, rdata);
-
+void PARTICLEENGINE::ParticleEngine::unpack_particles(const std::map<int, std::vector<char>>& rdata,
+    std::vector<std::vector<std::pair<int, ParticleObjShrdPtr>>>& particlestoreceive) const
+{
   // unpack and store received data
   for (const auto& p : rdata)
   {
     const int msgsource = p.first;
     const std::vector<char>& rmsg = p.second;
 
-
-
     Core::Communication::UnpackBuffer buffer(rmsg);
     while (!buffer.at_end())
     {
@@ -1899,6 +1980,17 @@ void PARTICLEENGINE::ParticleEngine::insert_ghosted_particles(
     // get container of ghosted particles of current particle type
     ParticleContainer* container = particlecontainerbundle_->get_specific_container(type, Ghosted);
 
+    // insert ghosted particles ordered along a space-filling curve
+    if (params_.get<bool>("REORDER_PARTICLES"))
+    {
+      std::stable_sort(particlestoinsert[type].begin(), particlestoinsert[type].end(),
+          [&](const auto& a, const auto& b)
+          {
+            return get_space_filling_curve_key_of_bin(a.second->return_bin_gid()) <
+                   get_space_filling_curve_key_of_bin(b.second->return_bin_gid());
+          });
+    }
+
     // iterate over particle objects pairs
     for (const auto& objectpair : particlestoinsert[type])
     {
@@ -2030,6 +2122,74 @@ void PARTICLEENGINE::ParticleEngine::store_positions_after_particle_transfer()
   }
 }
 
+void PARTICLEENGINE::ParticleEngine::reorder_owned_particles_along_space_filling_curve()
+{
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "PARTICLEENGINE::ParticleEngine::reorder_owned_particles_along_space_filling_curve");
+
+  std::vector<std::uint64_t> keys;
+  std::vector<int> neworder;
+
+  // iterate over particle types
+  for (const auto& type : particlecontainerbundle_->get_particle_types())
+  {
+    // get container of owned particles of current particle type
+    ParticleContainer* container = particlecontainerbundle_->get_specific_container(type, Owned);
+
+    // get number of particles stored in container
+    const int particlestored = container->particles_stored();
+
+    // no owned particles of current particle type
+    if (particlestored <= 1) continue;
+
+    // get pointer to particle position
+    const double* pos = container->get_ptr_to_state(Position, 0);
+
+    // get particle state dimension
+    int statedim = container->get_state_dim(Position);
+
+    // determine key of bin of each particle
+    keys.resize(particlestored);
+    for (int index = 0; index < particlestored; ++index)
+    {
+      const int gidofbin = binstrategy_->convert_pos_to_gid(&pos[statedim * index]);
+      keys[index] = get_space_filling_curve_key_of_bin(gidofbin);
+    }
+
+    // sort particles by key keeping the current order of particles within a bin
+    neworder.resize(particlestored);
+    std::iota(neworder.begin(), neworder.end(), 0);
+    std::stable_sort(neworder.begin(), neworder.end(),
+        [&](const int a, const int b) { return keys[a] < keys[b]; });
+
+    container->reorder_particles(neworder);
+  }
+}
+
+std::uint64_t PARTICLEENGINE::ParticleEngine::get_space_filling_curve_key_of_bin(
+    int gidofbin) const
+{
+  // particles outside the bounding box are sorted to the end
+  if (gidofbin < 0) return std::numeric_limits<std::uint64_t>::max();
+
+  int ijk[3];
+  binstrategy_->convert_gid_to_ijk(gidofbin, ijk);
+
+  // spread the lower 21 bits of a bin index such that two zero bits follow each bit
+  const auto spread_bits = [](std::uint64_t x)
+  {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+  };
+
+  return spread_bits(ijk[0]) | (spread_bits(ijk[1]) << 1) | (spread_bits(ijk[2]) << 2);
+}
+
 void PARTICLEENGINE::ParticleEngine::relate_owned_particles_to_bins()
 {
   // clear vector relating (owned and ghosted) particles to col bins
@@ -2121,6 +2281,9 @@ void PARTICLEENGINE::ParticleEngine::determine_bin_weights()
 
 void PARTICLEENGINE::ParticleEngine::invalidate_particle_safety_flags()
 {
+  // finish pending refresh of particles
+  finish_refresh_particles();
+
   validownedparticles_ = false;
   validghostedparticles_ = false;
   validparticleneighbors_ = false;
@@ -20,6 +20,8 @@
 #include <Epetra_Comm.h>
 #include <Epetra_Map.h>
 
+#include <cstdint>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -32,6 +34,11 @@ namespace PARTICLEENGINE
   class ParticleObject;
   class UniqueGlobalIdHandler;
   class ParticleRuntimeVtpWriter;
+
+  namespace COMMUNICATION
+  {
+    struct PendingCommunication;
+  }
 }  // namespace PARTICLEENGINE
 
 namespace Core::Binstrategy
@@ -234,6 +241,27 @@ namespace PARTICLEENGINE
     void refresh_particles_of_specific_states_and_types(
         const StatesOfTypesToRefresh& particlestatestotypes) const override;
 
+    /*!
+     * \brief start refresh of specific states of particles of specific types
+     *
+     * Post the communication of specific states of particles of specific types from owned
+     * particles to processors ghosting that respective particles without waiting for its
+     * completion. A pending refresh is finished before any other communication of particles.
+     *
+     * \param[in] particlestatestotypes particle types and corresponding particle states to be
+     *                                  refreshed
+     */
+    void start_refresh_particles_of_specific_states_and_types(
+        const StatesOfTypesToRefresh& particlestatestotypes) const override;
+
+    /*!
+     * \brief finish pending refresh of particles
+     *
+     * Wait for the completion of a pending refresh and insert the refreshed particles received
+     * from other processors.
+     */
+    void finish_refresh_particles() const override;
+
     /*!
      * \brief dynamic load balancing
      *
@@ -354,6 +382,11 @@ namespace PARTICLEENGINE
 
     const PotentialParticleNeighbors& get_potential_particle_neighbors() const override;
 
+    int get_potential_particle_neighbors_build_count() const override
+    {
+      return potentialparticleneighborsbuildcount_;
+    };
+
     const std::vector<std::vector<int>>& get_communicated_particle_targets() const override
     {
       return communicatedparticletargets_;
@@ -683,6 +716,24 @@ namespace PARTICLEENGINE
     void communicate_particles(std::vector<std::vector<ParticleObjShrdPtr>>& particlestosend,
         std::vector<std::vector<std::pair<int, ParticleObjShrdPtr>>>& particlestoreceive) const;
 
+    /*!
+     * \brief pack particles to be send to other processors
+     *
+     * \param[in]  particlestosend particles to be send to other processors
+     * \param[out] sdata           send buffers related to corresponding target processors
+     */
+    void pack_particles(std::vector<std::vector<ParticleObjShrdPtr>>& particlestosend,
+        std::map<int, std::vector<char>>& sdata) const;
+
+    /*!
+     * \brief unpack particles received from other processors
+     *
+     * \param[in]  rdata              receive buffers related to corresponding source processors
+     * \param[out] particlestoreceive particles to be received on this processor
+     */
+    void unpack_particles(const std::map<int, std::vector<char>>& rdata,
+        std::vector<std::vector<std::pair<int, ParticleObjShrdPtr>>>& particlestoreceive) const;
+
     /*!
      * \brief communicate and build map for direct ghosting
      *
@@ -751,6 +802,25 @@ namespace PARTICLEENGINE
      */
     void relate_owned_particles_to_bins();
 
+    /*!
+     * \brief reorder owned particles along a space-filling curve
+     *
+     * The owned particles of each type are sorted by the key of the bin they are located in, such
+     * that particles of the same and of neighboring bins are stored close to each other.
+     */
+    void reorder_owned_particles_along_space_filling_curve();
+
+    /*!
+     * \brief get key of bin along a space-filling curve
+     *
+     * The key is the Morton code of the bin, i.e., the interleaved bits of its ijk indices.
+     *
+     * \param[in] gidofbin global id of bin
+     *
+     * \return key of bin
+     */
+    std::uint64_t get_space_filling_curve_key_of_bin(int gidofbin) const;
+
     /*!
      * \brief determine minimum relevant bin size
      *
@@ -820,6 +890,9 @@ namespace PARTICLEENGINE
     //! relate potential particle neighbors of all types and statuses
     PotentialParticleNeighbors potentialparticleneighbors_;
 
+    //! number of builds of potential particle neighbors
+    int potentialparticleneighborsbuildcount_;
+
     //! owned particles being communicated (transfered/distributed) to target processors
     std::vector<std::vector<int>> communicatedparticletargets_;
 
@@ -832,6 +905,9 @@ namespace PARTICLEENGINE
     //! relate half surrounding neighboring bins (including owned bin itself) to owned bins
     std::vector<std::set<int>> halfneighboringbinstobins_;
 
+    //! pending refresh of particles
+    mutable std::unique_ptr<COMMUNICATION::PendingCommunication> pendingrefresh_;
+
     //! flag denoting valid relation of owned particles to bins
     bool validownedparticles_;
 
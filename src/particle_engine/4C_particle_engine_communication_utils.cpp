@@ -72,7 +72,7 @@ void PARTICLEENGINE::COMMUNICATION::immediate_recv_blocking_send(const Epetra_Co
   {
     // probe for any message to come
     MPI_Status status;
-    MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, mpicomm->Comm(), &status);
+    MPI_Probe(MPI_ANY_SOURCE, 1234, mpicomm->Comm(), &status);
 
     // get message sender and tag
     int const msgsource = status.MPI_SOURCE;
@@ -144,4 +144,120 @@ void PARTICLEENGINE::COMMUNICATION::immediate_recv_blocking_send(const Epetra_Co
   MPI_Waitall(numrecvfromprocs, recvrequest.data(), MPI_STATUSES_IGNORE);
 }
 
+void PARTICLEENGINE::COMMUNICATION::immediate_recv_immediate_send_start(const Epetra_Comm& comm,
+    std::map<int, std::vector<char>>& sdata, PendingCommunication& pending)
+{
+  // number of processors
+  int const numproc = comm.NumProc();
+
+  // processor id
+  int const myrank = comm.MyPID();
+
+  // mpi communicator
+  const auto* mpicomm = dynamic_cast<const Epetra_MpiComm*>(&comm);
+  if (!mpicomm) FOUR_C_THROW("dynamic cast to Epetra_MpiComm failed!");
+
+  // take over send buffer
+  pending.sdata.swap(sdata);
+  sdata.clear();
+  pending.rdata.clear();
+
+  // number of processors receiving data from this processor
+  int const numsendtoprocs = pending.sdata.size();
+
+  // ---- communicate target processors to all processors ----
+  std::vector<int> targetprocs(numproc, 0);
+  std::vector<int> summedtargets(numproc, 0);
+
+  for (const auto& p : pending.sdata) targetprocs[p.first] = 1;
+
+  comm.SumAll(targetprocs.data(), summedtargets.data(), numproc);
+
+  // number of processors this processor receives data from
+  int const numrecvfromprocs = summedtargets[myrank];
+
+  // ---- send size of messages and data to receiving processors ----
+  pending.sendsize.resize(numsendtoprocs);
+  pending.sizerequest.resize(numsendtoprocs);
+  pending.sendrequest.resize(numsendtoprocs);
+  int counter = 0;
+  for (auto& p : pending.sdata)
+  {
+    int const torank = p.first;
+    if (myrank == torank) FOUR_C_THROW("processor should not send messages to itself!");
+    if (torank < 0) FOUR_C_THROW("processor can not send messages to processor < 0!");
+
+    std::vector<char>& sbuffer = p.second;
+    pending.sendsize[counter] = static_cast<int>(sbuffer.size());
+
+    // check sending size of message
+    if (not(pending.sendsize[counter] > 0))
+      FOUR_C_THROW(
+          "sending non-positive message size %i to proc %i!", pending.sendsize[counter], torank);
+
+    // perform non-blocking send operations
+    MPI_Isend(&pending.sendsize[counter], 1, MPI_INT, torank, 1234, mpicomm->Comm(),
+        &pending.sizerequest[counter]);
+    MPI_Isend((void*)(sbuffer.data()), pending.sendsize[counter], MPI_CHAR, torank, 5679,
+        mpicomm->Comm(), &pending.sendrequest[counter]);
+
+    ++counter;
+  }
+
+  // ---- receive size of messages and post receive operations of data ----
+  pending.recvrequest.resize(numrecvfromprocs);
+  for (int rec = 0; rec < numrecvfromprocs; ++rec)
+  {
+    // probe for any message size to come
+    MPI_Status status;
+    MPI_Probe(MPI_ANY_SOURCE, 1234, mpicomm->Comm(), &status);
+
+    // get message sender
+    int const msgsource = status.MPI_SOURCE;
+
+    // get message size
+    int msgsize = -1;
+    MPI_Get_count(&status, MPI_INT, &msgsize);
+
+    // check size of message
+    if (msgsize != 1) FOUR_C_THROW("message size not correct (one int expected)!");
+
+    // perform blocking receive operation
+    int msgsizetorecv = -1;
+    MPI_Recv(&msgsizetorecv, msgsize, MPI_INT, msgsource, 1234, mpicomm->Comm(), MPI_STATUS_IGNORE);
+
+    // check received size of message
+    if (not(msgsizetorecv > 0))
+      FOUR_C_THROW("received non-positive message size %i from proc %i!", msgsizetorecv, msgsource);
+
+    // resize receiving buffer to received size
+    std::vector<char>& rbuffer = pending.rdata[msgsource];
+    rbuffer.resize(msgsizetorecv);
+
+    // perform non-blocking receive operation
+    MPI_Irecv((void*)(rbuffer.data()), msgsizetorecv, MPI_CHAR, msgsource, 5679, mpicomm->Comm(),
+        &pending.recvrequest[rec]);
+  }
+}
+
+void PARTICLEENGINE::COMMUNICATION::immediate_recv_immediate_send_finish(
+    PendingCommunication& pending, std::map<int, std::vector<char>>& rdata)
+{
+  // ---- wait for completion of send operations ----
+  MPI_Waitall(static_cast<int>(pending.sizerequest.size()), pending.sizerequest.data(),
+      MPI_STATUSES_IGNORE);
+  MPI_Waitall(static_cast<int>(pending.sendrequest.size()), pending.sendrequest.data(),
+      MPI_STATUSES_IGNORE);
+
+  // ---- wait for completion of receive operations ----
+  MPI_Waitall(static_cast<int>(pending.recvrequest.size()), pending.recvrequest.data(),
+      MPI_STATUSES_IGNORE);
+
+  // hand over receive buffer
+  rdata.swap(pending.rdata);
+
+  // clear pending communication
+  pending = PendingCommunication();
+}
+
 FOUR_C_NAMESPACE_CLOSE
@@ -46,6 +46,61 @@ namespace PARTICLEENGINE
     void immediate_recv_blocking_send(const Epetra_Comm& comm,
         std::map<int, std::vector<char>>& sdata, std::map<int, std::vector<char>>& rdata);
 
+    /*!
+     * \brief pending non-blocking communication of data from processor to processor
+     *
+     * Holds the send and receive buffers and the requests of a communication started via
+     * immediate_recv_immediate_send_start() until completion via
+     * immediate_recv_immediate_send_finish().
+     */
+    struct PendingCommunication
+    {
+      //! send buffers related to corresponding target processors
+      std::map<int, std::vector<char>> sdata;
+
+      //! receive buffers related to corresponding source processors
+      std::map<int, std::vector<char>> rdata;
+
+      //! size of messages send to target processors
+      std::vector<int> sendsize;
+
+      //! requests of send operations of message sizes
+      std::vector<MPI_Request> sizerequest;
+
+      //! requests of send operations of data
+      std::vector<MPI_Request> sendrequest;
+
+      //! requests of receive operations of data
+      std::vector<MPI_Request> recvrequest;
+    };
+
+    /*!
+     * \brief start communication of data via non-blocking send from processor to processor
+     *
+     * The size of the messages is communicated before returning, while the data itself is
+     * communicated via non-blocking point-to-point communication. The communication has to be
+     * completed via immediate_recv_immediate_send_finish() before any other communication from
+     * processor to processor is started.
+     *
+     * \note This method has to be called by all processors of the communicator as it contains
+     * collective communication.
+     *
+     * \param[in]  comm    communicator
+     * \param[in]  sdata   send buffers related to corresponding target processors
+     * \param[out] pending pending communication
+     */
+    void immediate_recv_immediate_send_start(const Epetra_Comm& comm,
+        std::map<int, std::vector<char>>& sdata, PendingCommunication& pending);
+
+    /*!
+     * \brief finish communication of data via non-blocking send from processor to processor
+     *
+     * \param[in]  pending pending communication
+     * \param[out] rdata   receive buffers related to corresponding source processors
+     */
+    void immediate_recv_immediate_send_finish(
+        PendingCommunication& pending, std::map<int, std::vector<char>>& rdata);
+
   }  // namespace COMMUNICATION
 
 }  // namespace PARTICLEENGINE
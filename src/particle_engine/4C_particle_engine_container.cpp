@@ -9,6 +9,8 @@
 
 #include "4C_utils_exceptions.hpp"
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -221,6 +223,37 @@ void PARTICLEENGINE::ParticleContainer::remove_particle(int index)
   }
 }
 
+void PARTICLEENGINE::ParticleContainer::reorder_particles(const std::vector<int>& neworder)
+{
+  if (static_cast<int>(neworder.size()) != particlestored_)
+    FOUR_C_THROW("size of new order %d does not match number of particles stored %d!",
+        static_cast<int>(neworder.size()), particlestored_);
+
+  // reorder global ids
+  {
+    std::vector<int> reordered(particlestored_);
+    for (int index = 0; index < particlestored_; ++index)
+      reordered[index] = globalids_[neworder[index]];
+
+    std::copy(reordered.begin(), reordered.end(), globalids_.begin());
+  }
+
+  // iterate over states stored in container
+  std::vector<double> reordered;
+  for (const auto& state : storedstates_)
+  {
+    const int statedim = statedim_[state];
+    const std::vector<double>& oldstate = states_[state];
+
+    reordered.resize(particlestored_ * statedim);
+    for (int index = 0; index < particlestored_; ++index)
+      for (int dim = 0; dim < statedim; ++dim)
+        reordered[index * statedim + dim] = oldstate[neworder[index] * statedim + dim];
+
+    std::copy(reordered.begin(), reordered.end(), states_[state].begin());
+  }
+}
+
 double PARTICLEENGINE::ParticleContainer::get_min_value_of_state(ParticleState state) const
 {
 #ifdef FOUR_C_ENABLE_ASSERTIONS
@@ -164,6 +164,19 @@ namespace PARTICLEENGINE
      */
     void remove_particle(int index);
 
+    /*!
+     * \brief reorder particles in particle container
+     *
+     * Rearrange the particles stored in the particle container such that the particle previously
+     * stored at index neworder[i] is stored at index i afterwards. The global ids and all stored
+     * states are permuted accordingly.
+     *
+     * \note All indices of particles in this container held elsewhere are invalidated.
+     *
+     * \param[in] neworder old index of particle for each new index
+     */
+    void reorder_particles(const std::vector<int>& neworder);
+
     //! @}
 
     /*!
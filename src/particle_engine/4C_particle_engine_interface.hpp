@@ -84,6 +84,26 @@ namespace PARTICLEENGINE
     virtual void refresh_particles_of_specific_states_and_types(
         const StatesOfTypesToRefresh& particlestatestotypes) const = 0;
 
+    /*!
+     * \brief start refresh of specific states of particles of specific types
+     *
+     * The refreshed states of ghosted particles are available only after calling
+     * finish_refresh_particles(), allowing to overlap the communication with computations not
+     * involving the refreshed states of ghosted particles.
+     *
+     * \param[in] particlestatestotypes particle types and corresponding particle states to be
+     *                                  refreshed
+     */
+    virtual void start_refresh_particles_of_specific_states_and_types(
+        const StatesOfTypesToRefresh& particlestatestotypes) const = 0;
+
+    /*!
+     * \brief finish pending refresh of particles
+     *
+     * Nothing is done in case no refresh of particles is pending.
+     */
+    virtual void finish_refresh_particles() const = 0;
+
     /*!
      * \brief hand over particles to be removed
      *
@@ -122,6 +142,16 @@ namespace PARTICLEENGINE
      */
     virtual const PotentialParticleNeighbors& get_potential_particle_neighbors() const = 0;
 
+    /*!
+     * \brief get number of builds of potential particle neighbors
+     *
+     * The number of builds allows to detect a rebuild of the potential particle neighbors, e.g.,
+     * to invalidate data relying on the local indices of particles.
+     *
+     * \return number of builds of potential particle neighbors
+     */
+    virtual int get_potential_particle_neighbors_build_count() const = 0;
+
     /*!
      * \brief get reference to particles being communicated to target processors
      *
@@ -211,7 +211,7 @@ void ParticleInteraction::ParticleInteractionDEM::set_current_step_size(
 void ParticleInteraction::ParticleInteractionDEM::init_neighbor_pair_handler()
 {
   // create neighbor pair handler
-  neighborpairs_ = std::make_shared<ParticleInteraction::DEMNeighborPairs>();
+  neighborpairs_ = std::make_shared<ParticleInteraction::DEMNeighborPairs>(params_dem_);
 
   // init neighbor pair handler
   neighborpairs_->init();
@@ -16,16 +16,33 @@
 #include "4C_particle_interaction_utils.hpp"
 #include "4C_particle_wall_interface.hpp"
 
+#include <Teuchos_ParameterList.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
-ParticleInteraction::DEMNeighborPairs::DEMNeighborPairs()
+ParticleInteraction::DEMNeighborPairs::DEMNeighborPairs(const Teuchos::ParameterList& params)
 {
-  // empty constructor
+  // skin distance of verlet list
+  const double skin = params.get<double>("VERLET_LIST_SKIN");
+
+  // create verlet list of particle pairs
+  if (skin > 0.0)
+  {
+    // adhesion distance of particle pairs
+    const double adhesion_distance = std::max(0.0, params.get<double>("ADHESION_DISTANCE"));
+
+    // interaction distance of particle pairs given by contact and adhesion
+    auto interactiondistance = [adhesion_distance](double rad_i, double rad_j)
+    { return rad_i + rad_j + adhesion_distance; };
+
+    verletlist_ = std::make_unique<ParticleInteraction::VerletList>(skin, interactiondistance);
+  }
 }
 
 void ParticleInteraction::DEMNeighborPairs::init()
@@ -45,6 +62,9 @@ void ParticleInteraction::DEMNeighborPairs::setup(
 
   // set interface to particle wall handler
   particlewallinterface_ = particlewallinterface;
+
+  // setup verlet list of particle pairs
+  if (verletlist_) verletlist_->setup(particleengineinterface_);
 }
 
 void ParticleInteraction::DEMNeighborPairs::evaluate_neighbor_pairs()
@@ -66,6 +86,14 @@ void ParticleInteraction::DEMNeighborPairs::evaluate_neighbor_pairs_adhesion(
   if (particlewallinterface_) evaluate_particle_wall_pairs_adhesion(adhesion_distance);
 }
 
+const PARTICLEENGINE::PotentialParticleNeighbors&
+ParticleInteraction::DEMNeighborPairs::get_particle_pairs_to_evaluate()
+{
+  if (verletlist_) return verletlist_->get_particle_pairs();
+
+  return particleengineinterface_->get_potential_particle_neighbors();
+}
+
 void ParticleInteraction::DEMNeighborPairs::evaluate_particle_pairs()
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::DEMNeighborPairs::evaluate_particle_pairs");
@@ -74,8 +102,7 @@ void ParticleInteraction::DEMNeighborPairs::evaluate_particle_pairs()
   particlepairdata_.clear();
 
   // iterate over potential particle neighbors
-  for (const auto& potentialneighbors :
-      particleengineinterface_->get_potential_particle_neighbors())
+  for (const auto& potentialneighbors : get_particle_pairs_to_evaluate())
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -365,8 +392,7 @@ void ParticleInteraction::DEMNeighborPairs::evaluate_particle_pairs_adhesion(
   particlepairadhesiondata_.clear();
 
   // iterate over potential particle neighbors
-  for (const auto& potentialneighbors :
-      particleengineinterface_->get_potential_particle_neighbors())
+  for (const auto& potentialneighbors : get_particle_pairs_to_evaluate())
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
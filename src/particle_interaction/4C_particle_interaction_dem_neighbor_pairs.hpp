@@ -16,6 +16,8 @@
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 #include "4C_particle_interaction_dem_neighbor_pair_struct.hpp"
+#include "4C_particle_interaction_verlet_list.hpp"
+#include "4C_utils_parameter_list.fwd.hpp"
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -51,7 +53,7 @@ namespace ParticleInteraction
   {
    public:
     //! constructor
-    explicit DEMNeighborPairs();
+    explicit DEMNeighborPairs(const Teuchos::ParameterList& params);
 
     //! init neighbor pair handler
     void init();
@@ -92,6 +94,9 @@ namespace ParticleInteraction
     void evaluate_neighbor_pairs_adhesion(const double& adhesion_distance);
 
    private:
+    //! get particle pairs to evaluate either from verlet list or potential particle neighbors
+    const PARTICLEENGINE::PotentialParticleNeighbors& get_particle_pairs_to_evaluate();
+
     //! evaluate particle pairs
     void evaluate_particle_pairs();
 
@@ -124,6 +129,9 @@ namespace ParticleInteraction
 
     //! interface to particle wall handler
     std::shared_ptr<PARTICLEWALL::WallHandlerInterface> particlewallinterface_;
+
+    //! verlet list of particle pairs
+    std::unique_ptr<ParticleInteraction::VerletList> verletlist_;
   };
 
 }  // namespace ParticleInteraction
@@ -356,6 +356,11 @@ void ParticleInteraction::ParticleInteractionSPH::evaluate_interactions()
   // compute pressure using equation of state and density
   pressure_->compute_pressure();
 
+  // finish refresh of pressure of ghosted particles required before evaluation of momentum
+  if (surfacetension_ or temperature_ or dirichletopenboundary_ or neumannopenboundary_ or
+      boundaryparticle_ or virtualwallparticle_)
+    particleengineinterface_->finish_refresh_particles();
+
   // compute interface quantities
   if (surfacetension_) surfacetension_->compute_interface_quantities();
 
@@ -483,7 +488,7 @@ void ParticleInteraction::ParticleInteractionSPH::init_equation_of_state_bundle(
 void ParticleInteraction::ParticleInteractionSPH::init_neighbor_pair_handler()
 {
   // create neighbor pair handler
-  neighborpairs_ = std::make_shared<ParticleInteraction::SPHNeighborPairs>();
+  neighborpairs_ = std::make_shared<ParticleInteraction::SPHNeighborPairs>(params_sph_);
 
   // init neighbor pair handler
   neighborpairs_->init();
@@ -539,8 +544,8 @@ void ParticleInteraction::ParticleInteractionSPH::init_density_handler()
 void ParticleInteraction::ParticleInteractionSPH::init_pressure_handler()
 {
   // create pressure handler
-  pressure_ =
-      std::unique_ptr<ParticleInteraction::SPHPressure>(new ParticleInteraction::SPHPressure());
+  pressure_ = std::unique_ptr<ParticleInteraction::SPHPressure>(
+      new ParticleInteraction::SPHPressure(params_sph_));
 
   // init pressure handler
   pressure_->init();
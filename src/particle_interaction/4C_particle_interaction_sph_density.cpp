@@ -159,8 +159,8 @@ void ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_contributio
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
+  // evaluate particle pair
+  auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -193,7 +193,10 @@ void ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_contributio
     // sum contribution of neighboring particle i
     if (denssum_j and status_j == PARTICLEENGINE::Owned)
       denssum_j[0] += particlepair.Wji_ * mass_j[0];
-  }
+  };
+
+  // iterate over particle pairs
+  neighborpairs_->for_each_particle_pair(evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHDensityBase::sum_weighted_mass_particle_wall_contribution() const
@@ -326,8 +329,8 @@ void ParticleInteraction::SPHDensityBase::sum_colorfield_particle_contribution()
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::sum_colorfield_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
+  // evaluate particle pair
+  auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -379,7 +382,10 @@ void ParticleInteraction::SPHDensityBase::sum_colorfield_particle_contribution()
     // sum contribution of neighboring particle i
     if (colorfield_j and status_j == PARTICLEENGINE::Owned)
       colorfield_j[0] += (particlepair.Wji_ / dens_i[0]) * mass_i[0];
-  }
+  };
+
+  // iterate over particle pairs
+  neighborpairs_->for_each_particle_pair(evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHDensityBase::sum_colorfield_particle_wall_contribution() const
@@ -489,8 +495,8 @@ void ParticleInteraction::SPHDensityBase::continuity_equation_particle_contribut
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHDensityBase::continuity_equation_particle_contribution");
 
-  // iterate over particle pairs
-  for (auto& particlepair : neighborpairs_->get_ref_to_particle_pair_data())
+  // evaluate particle pair
+  auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
@@ -558,7 +564,10 @@ void ParticleInteraction::SPHDensityBase::continuity_equation_particle_contribut
     // sum contribution of neighboring particle i
     if (densdot_j and status_j == PARTICLEENGINE::Owned)
       densdot_j[0] += dens_j[0] * (mass_i[0] / dens_i[0]) * particlepair.dWdrji_ * e_ij_vel_ij;
-  }
+  };
+
+  // iterate over particle pairs
+  neighborpairs_->for_each_particle_pair(evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHDensityBase::continuity_equation_particle_wall_contribution() const
@@ -30,6 +30,8 @@
 
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
 /*---------------------------------------------------------------------------*
@@ -43,7 +45,8 @@ ParticleInteraction::SPHMomentum::SPHMomentum(const Teuchos::ParameterList& para
       transportvelocityformulation_(
           Teuchos::getIntegralValue<Inpar::PARTICLE::TransportVelocityFormulation>(
               params_sph_, "TRANSPORTVELOCITYFORMULATION")),
-      writeparticlewallinteraction_(params_sph_.get<bool>("WRITE_PARTICLE_WALL_INTERACTION"))
+      writeparticlewallinteraction_(params_sph_.get<bool>("WRITE_PARTICLE_WALL_INTERACTION")),
+      asyncghostrefresh_(params_sph_.get<bool>("ASYNC_GHOST_REFRESH"))
 {
   // empty constructor
 }
@@ -243,17 +246,9 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution()
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution");
 
-  // get relevant particle pair indices
-  std::vector<int> relindices;
-  neighborpairs_->get_relevant_particle_pair_indices_for_equal_combination(
-      allfluidtypes_, relindices);
-
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate particle pair
+  auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -400,7 +395,40 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_contribution()
           particlepair.dWdrji_, dens_ij, h_ij, c_ij, particlepair.absdist_, particlepair.e_ij_,
           acc_i, acc_j);
     }
+  };
+
+  // overlap pending refresh of ghosted particles with evaluation of pairs of owned particles
+  if (asyncghostrefresh_)
+  {
+    auto is_pair_of_owned_particles = [](const SPHParticlePair& particlepair)
+    {
+      return std::get<1>(particlepair.tuple_i_) == PARTICLEENGINE::Owned and
+             std::get<1>(particlepair.tuple_j_) == PARTICLEENGINE::Owned;
+    };
+
+    // iterate over relevant particle pairs of owned particles
+    neighborpairs_->for_each_particle_pair_of_equal_combination(allfluidtypes_,
+        [&](const SPHParticlePair& particlepair)
+        {
+          if (is_pair_of_owned_particles(particlepair)) evaluate_particle_pair(particlepair);
+        });
+
+    // finish pending refresh of ghosted particles
+    particleengineinterface_->finish_refresh_particles();
+
+    // iterate over relevant particle pairs involving ghosted particles
+    neighborpairs_->for_each_particle_pair_of_equal_combination(allfluidtypes_,
+        [&](const SPHParticlePair& particlepair)
+        {
+          if (not is_pair_of_owned_particles(particlepair)) evaluate_particle_pair(particlepair);
+        });
+
+    return;
   }
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair_of_equal_combination(
+      allfluidtypes_, evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contribution() const
@@ -408,17 +436,9 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contr
   TEUCHOS_FUNC_TIME_MONITOR(
       "ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contribution");
 
-  // get relevant particle pair indices
-  std::vector<int> relindices;
-  neighborpairs_->get_relevant_particle_pair_indices_for_disjoint_combination(
-      intfluidtypes_, boundarytypes_, relindices);
-
-  // iterate over relevant particle pairs
-  for (const int particlepairindex : relindices)
+  // evaluate particle pair
+  auto evaluate_particle_pair = [&](const SPHParticlePair& particlepair)
   {
-    const SPHParticlePair& particlepair =
-        neighborpairs_->get_ref_to_particle_pair_data()[particlepairindex];
-
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -580,7 +600,11 @@ void ParticleInteraction::SPHMomentum::momentum_equation_particle_boundary_contr
 
     // add contribution to neighboring boundary particle j
     if (force_j) Utils::vec_add_scale(force_j, -mass_i[0], acc_ij);
-  }
+  };
+
+  // iterate over relevant particle pairs
+  neighborpairs_->for_each_particle_pair_of_disjoint_combination(
+      intfluidtypes_, boundarytypes_, evaluate_particle_pair);
 }
 
 void ParticleInteraction::SPHMomentum::momentum_equation_particle_wall_contribution() const
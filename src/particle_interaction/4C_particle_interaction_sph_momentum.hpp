@@ -163,6 +163,9 @@ namespace ParticleInteraction
     //! write particle-wall interaction output
     const bool writeparticlewallinteraction_;
 
+    //! overlap refresh of ghosted particles with evaluation of pairs of owned particles
+    const bool asyncghostrefresh_;
+
     //! set of all fluid particle types
     std::set<PARTICLEENGINE::TypeEnum> allfluidtypes_;
 
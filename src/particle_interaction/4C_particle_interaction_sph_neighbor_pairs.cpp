@@ -16,16 +16,47 @@
 #include "4C_particle_interaction_utils.hpp"
 #include "4C_particle_wall_interface.hpp"
 
+#include <Teuchos_ParameterList.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 
+#include <algorithm>
+
 FOUR_C_NAMESPACE_OPEN
 
+namespace
+{
+  //! number of threads for evaluation of particle pairs, falling back to one without OpenMP
+  int number_of_threads(const Teuchos::ParameterList& params)
+  {
+    const int numthreads = params.get<int>("NUM_THREADS");
+    if (numthreads < 1) FOUR_C_THROW("number of threads must be positive!");
+
+#ifdef FOUR_C_WITH_OPENMP
+    return numthreads;
+#else
+    return 1;
+#endif
+  }
+}  // namespace
+
 /*---------------------------------------------------------------------------*
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
-ParticleInteraction::SPHNeighborPairs::SPHNeighborPairs()
+ParticleInteraction::SPHNeighborPairs::SPHNeighborPairs(const Teuchos::ParameterList& params)
+    : numthreads_(number_of_threads(params)), coloringbuildcount_(-1)
 {
-  // empty constructor
+
+  // skin distance of verlet list
+  const double skin = params.get<double>("VERLET_LIST_SKIN");
+
+  // create verlet list of particle pairs
+  if (skin > 0.0)
+  {
+    // interaction distance of particle pairs given by minimum support radius
+    auto interactiondistance = [](double rad_i, double rad_j) { return std::min(rad_i, rad_j); };
+
+    verletlist_ = std::make_unique<ParticleInteraction::VerletList>(skin, interactiondistance);
+  }
 }
 
 void ParticleInteraction::SPHNeighborPairs::init()
@@ -47,6 +78,9 @@ void ParticleInteraction::SPHNeighborPairs::setup(
   // set interface to particle wall handler
   particlewallinterface_ = particlewallinterface;
 
+  // setup verlet list of particle pairs
+  if (verletlist_) verletlist_->setup(particleengineinterface_);
+
   // set kernel handler
   kernel_ = kernel;
 
@@ -58,6 +92,14 @@ void ParticleInteraction::SPHNeighborPairs::setup(
 
   // allocate memory to hold index of particle wall pairs for each type
   indexofparticlewallpairs_.resize(typevectorsize);
+
+  // all combinations of particle types
+  for (const auto& type_i : particlecontainerbundle_->get_particle_types())
+    for (const auto& type_j : particlecontainerbundle_->get_particle_types())
+      alltypecombinations_.emplace_back(type_i, type_j);
+
+  // enforce coloring of particle pairs
+  coloringbuildcount_ = -1;
 }
 
 void ParticleInteraction::SPHNeighborPairs::
@@ -114,6 +156,21 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_neighbor_pairs()
   if (particlewallinterface_) evaluate_particle_wall_pairs();
 }
 
+const PARTICLEENGINE::PotentialParticleNeighbors&
+ParticleInteraction::SPHNeighborPairs::get_particle_pairs_to_evaluate()
+{
+  if (verletlist_) return verletlist_->get_particle_pairs();
+
+  return particleengineinterface_->get_potential_particle_neighbors();
+}
+
+int ParticleInteraction::SPHNeighborPairs::get_particle_pairs_to_evaluate_build_count() const
+{
+  if (verletlist_) return verletlist_->number_of_builds();
+
+  return particleengineinterface_->get_potential_particle_neighbors_build_count();
+}
+
 void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs");
@@ -126,12 +183,31 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
     for (const auto& type_j : particlecontainerbundle_->get_particle_types())
       indexofparticlepairs_[type_i][type_j].clear();
 
+  // get particle pairs to evaluate
+  const PARTICLEENGINE::PotentialParticleNeighbors& particlepairstoevaluate =
+      get_particle_pairs_to_evaluate();
+
+  // color particle pairs to evaluate for threaded evaluation unless unchanged since last coloring
+  if (numthreads_ > 1)
+  {
+    if (get_particle_pairs_to_evaluate_build_count() != coloringbuildcount_)
+      color_particle_pairs_to_evaluate(particlepairstoevaluate);
+
+    // clear index of particle pairs for each color and type
+    for (SPHIndexOfParticlePairs& indexofparticlepairsofcolor : indexofcoloredparticlepairs_)
+      for (const auto& type_i : particlecontainerbundle_->get_particle_types())
+        for (const auto& type_j : particlecontainerbundle_->get_particle_types())
+          indexofparticlepairsofcolor[type_i][type_j].clear();
+  }
+
   // index of particle pairs
   int particlepairindex = 0;
 
-  // iterate over potential particle neighbors
-  for (auto& potentialneighbors : particleengineinterface_->get_potential_particle_neighbors())
+  // iterate over particle pairs to evaluate
+  for (std::size_t k = 0; k < particlepairstoevaluate.size(); ++k)
   {
+    const auto& potentialneighbors = particlepairstoevaluate[k];
+
     // access values of local index tuples of particle i and j
     PARTICLEENGINE::TypeEnum type_i;
     PARTICLEENGINE::StatusEnum status_i;
@@ -186,6 +262,11 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
       // store index of particle pairs for each type
       indexofparticlepairs_[type_i][type_j].push_back(particlepairindex);
 
+      // store index of particle pairs for each color and type
+      if (numthreads_ > 1)
+        indexofcoloredparticlepairs_[colorofparticlepairstoevaluate_[k]][type_i][type_j].push_back(
+            particlepairindex);
+
       // increase index
       ++particlepairindex;
 
@@ -234,6 +315,99 @@ void ParticleInteraction::SPHNeighborPairs::evaluate_particle_pairs()
   }
 }
 
+void ParticleInteraction::SPHNeighborPairs::color_particle_pairs_to_evaluate(
+    const PARTICLEENGINE::PotentialParticleNeighbors& particlepairstoevaluate)
+{
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "ParticleInteraction::SPHNeighborPairs::color_particle_pairs_to_evaluate");
+
+  // determine offset of particles of each type and status in consecutive numbering
+  const int typevectorsize = *(--particlecontainerbundle_->get_particle_types().end()) + 1;
+  std::vector<std::vector<int>> offset(typevectorsize, std::vector<int>(2, 0));
+
+  int numparticles = 0;
+  for (const auto& type_i : particlecontainerbundle_->get_particle_types())
+  {
+    for (const auto& status_i : {PARTICLEENGINE::Owned, PARTICLEENGINE::Ghosted})
+    {
+      offset[type_i][status_i] = numparticles;
+      numparticles +=
+          particlecontainerbundle_->get_specific_container(type_i, status_i)->particles_stored();
+    }
+  }
+
+  auto particle_number = [&offset](const PARTICLEENGINE::LocalIndexTuple& tuple)
+  { return offset[std::get<0>(tuple)][std::get<1>(tuple)] + std::get<2>(tuple); };
+
+  const int numparticlepairs = particlepairstoevaluate.size();
+
+  // relate particles to particle pairs in compressed row storage
+  std::vector<int> particlepairsofparticleoffset(numparticles + 1, 0);
+  for (const auto& particlepair : particlepairstoevaluate)
+  {
+    ++particlepairsofparticleoffset[particle_number(particlepair.first) + 1];
+    ++particlepairsofparticleoffset[particle_number(particlepair.second) + 1];
+  }
+
+  for (int i = 0; i < numparticles; ++i)
+    particlepairsofparticleoffset[i + 1] += particlepairsofparticleoffset[i];
+
+  std::vector<int> particlepairsofparticle(particlepairsofparticleoffset[numparticles]);
+  {
+    std::vector<int> position(particlepairsofparticleoffset.begin(),
+        particlepairsofparticleoffset.end() - 1);
+
+    for (int particlepairindex = 0; particlepairindex < numparticlepairs; ++particlepairindex)
+    {
+      const auto& particlepair = particlepairstoevaluate[particlepairindex];
+      particlepairsofparticle[position[particle_number(particlepair.first)]++] = particlepairindex;
+      particlepairsofparticle[position[particle_number(particlepair.second)]++] = particlepairindex;
+    }
+  }
+
+  // greedy coloring of particle pairs
+  colorofparticlepairstoevaluate_.assign(numparticlepairs, -1);
+  int numcolors = 0;
+
+  // colors already taken by particle pairs sharing a particle with the current one, marked with
+  // the index of the current particle pair to avoid resetting the array in every step
+  std::vector<int> forbidden;
+
+  for (int particlepairindex = 0; particlepairindex < numparticlepairs; ++particlepairindex)
+  {
+    const auto& particlepair = particlepairstoevaluate[particlepairindex];
+
+    for (const int particle :
+        {particle_number(particlepair.first), particle_number(particlepair.second)})
+    {
+      for (int k = particlepairsofparticleoffset[particle];
+          k < particlepairsofparticleoffset[particle + 1]; ++k)
+      {
+        const int adjacentcolor = colorofparticlepairstoevaluate_[particlepairsofparticle[k]];
+        if (adjacentcolor >= 0) forbidden[adjacentcolor] = particlepairindex;
+      }
+    }
+
+    int color = 0;
+    while (color < numcolors and forbidden[color] == particlepairindex) ++color;
+
+    if (color == numcolors)
+    {
+      ++numcolors;
+      forbidden.emplace_back(-1);
+    }
+
+    colorofparticlepairstoevaluate_[particlepairindex] = color;
+  }
+
+  // allocate memory to hold index of particle pairs for each color and type
+  indexofcoloredparticlepairs_.assign(numcolors,
+      SPHIndexOfParticlePairs(typevectorsize, std::vector<std::vector<int>>(typevectorsize)));
+
+  // store build count of particle pairs of this coloring
+  coloringbuildcount_ = get_particle_pairs_to_evaluate_build_count();
+}
+
 void ParticleInteraction::SPHNeighborPairs::evaluate_particle_wall_pairs()
 {
   TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::SPHNeighborPairs::evaluate_particle_wall_pairs");
@@ -16,6 +16,12 @@
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 #include "4C_particle_interaction_sph_neighbor_pair_struct.hpp"
+#include "4C_particle_interaction_verlet_list.hpp"
+#include "4C_utils_parameter_list.fwd.hpp"
+
+#include <exception>
+#include <set>
+#include <utility>
 
 FOUR_C_NAMESPACE_OPEN
 
@@ -58,7 +64,7 @@ namespace ParticleInteraction
   {
    public:
     //! constructor
-    explicit SPHNeighborPairs();
+    explicit SPHNeighborPairs(const Teuchos::ParameterList& params);
 
     //! init neighbor pair handler
     void init();
@@ -97,7 +103,149 @@ namespace ParticleInteraction
     //! evaluate neighbor pairs
     void evaluate_neighbor_pairs();
 
+    //! get number of threads for evaluation of particle pairs
+    inline int num_threads() const { return numthreads_; };
+
+    /*!
+     * \brief apply function to all particle pairs
+     *
+     * In case of more than one thread, the particle pairs are processed color by color with
+     * particle pairs of one color sharing no particle, such that the function may scatter into
+     * both particles of a pair without write conflicts.
+     *
+     * \param[in] function function called with a particle pair
+     */
+    template <typename Function>
+    void for_each_particle_pair(Function function) const
+    {
+      if (numthreads_ <= 1)
+      {
+        for (const SPHParticlePair& particlepair : particlepairdata_) function(particlepair);
+        return;
+      }
+
+      for_each_particle_pair_of_type_combinations(alltypecombinations_, function);
+    }
+
+    /*!
+     * \brief apply function to particle pairs of disjoint combination of particle types
+     *
+     * The particle pairs are the ones given by
+     * get_relevant_particle_pair_indices_for_disjoint_combination().
+     *
+     * \param[in] types_a  first set of particle types
+     * \param[in] types_b  second set of particle types
+     * \param[in] function function called with a particle pair
+     */
+    template <typename Function>
+    void for_each_particle_pair_of_disjoint_combination(
+        const std::set<PARTICLEENGINE::TypeEnum>& types_a,
+        const std::set<PARTICLEENGINE::TypeEnum>& types_b, Function function) const
+    {
+      std::vector<std::pair<PARTICLEENGINE::TypeEnum, PARTICLEENGINE::TypeEnum>> typecombinations;
+      for (const auto& type_i : types_a)
+      {
+        for (const auto& type_j : types_b)
+        {
+          typecombinations.emplace_back(type_i, type_j);
+          typecombinations.emplace_back(type_j, type_i);
+        }
+      }
+
+      for_each_particle_pair_of_type_combinations(typecombinations, function);
+    }
+
+    /*!
+     * \brief apply function to particle pairs of equal combination of particle types
+     *
+     * The particle pairs are the ones given by
+     * get_relevant_particle_pair_indices_for_equal_combination().
+     *
+     * \param[in] types_a  set of particle types
+     * \param[in] function function called with a particle pair
+     */
+    template <typename Function>
+    void for_each_particle_pair_of_equal_combination(
+        const std::set<PARTICLEENGINE::TypeEnum>& types_a, Function function) const
+    {
+      std::vector<std::pair<PARTICLEENGINE::TypeEnum, PARTICLEENGINE::TypeEnum>> typecombinations;
+      for (const auto& type_i : types_a)
+        for (const auto& type_j : types_a) typecombinations.emplace_back(type_i, type_j);
+
+      for_each_particle_pair_of_type_combinations(typecombinations, function);
+    }
+
    private:
+    //! apply function to particle pairs of the given combinations of particle types
+    template <typename Function>
+    void for_each_particle_pair_of_type_combinations(
+        const std::vector<std::pair<PARTICLEENGINE::TypeEnum, PARTICLEENGINE::TypeEnum>>&
+            typecombinations,
+        Function& function) const
+    {
+      if (numthreads_ <= 1)
+      {
+        for (const auto& [type_i, type_j] : typecombinations)
+          for (const int particlepairindex : indexofparticlepairs_[type_i][type_j])
+            function(particlepairdata_[particlepairindex]);
+        return;
+      }
+
+      for (const SPHIndexOfParticlePairs& indexofparticlepairsofcolor :
+          indexofcoloredparticlepairs_)
+      {
+        // exceptions must not leave a parallel region, so the first one is kept and rethrown
+        std::exception_ptr exception = nullptr;
+
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp parallel num_threads(numthreads_)
+#endif
+        for (const auto& typecombination : typecombinations)
+        {
+          // particle pairs of one color share no particle, also across particle types
+          const std::vector<int>& colorindices =
+              indexofparticlepairsofcolor[typecombination.first][typecombination.second];
+          const int numpairs = colorindices.size();
+
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+          for (int k = 0; k < numpairs; ++k)
+          {
+            try
+            {
+              function(particlepairdata_[colorindices[k]]);
+            }
+            catch (...)
+            {
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp critical(sph_neighbor_pairs_exception)
+#endif
+              if (!exception) exception = std::current_exception();
+            }
+          }
+        }
+
+        if (exception) std::rethrow_exception(exception);
+      }
+    }
+
+    /*!
+     * \brief color particle pairs to evaluate such that particle pairs of one color share no
+     * particle
+     *
+     * The particle pairs to evaluate only change with a rebuild of the verlet list or of the
+     * potential particle neighbors, such that the coloring is kept in between.
+     */
+    void color_particle_pairs_to_evaluate(
+        const PARTICLEENGINE::PotentialParticleNeighbors& particlepairstoevaluate);
+
+    //! get build count of the particle pairs to evaluate
+    int get_particle_pairs_to_evaluate_build_count() const;
+
+    //! get particle pairs to evaluate either from verlet list or potential particle neighbors
+    const PARTICLEENGINE::PotentialParticleNeighbors& get_particle_pairs_to_evaluate();
+
     //! evaluate particle pairs
     void evaluate_particle_pairs();
 
@@ -116,6 +264,21 @@ namespace ParticleInteraction
     //! index of particle-wall pairs for each type
     SPHIndexOfParticleWallPairs indexofparticlewallpairs_;
 
+    //! all combinations of particle types
+    std::vector<std::pair<PARTICLEENGINE::TypeEnum, PARTICLEENGINE::TypeEnum>> alltypecombinations_;
+
+    //! number of threads for evaluation of particle pairs
+    const int numthreads_;
+
+    //! color of particle pairs to evaluate
+    std::vector<int> colorofparticlepairstoevaluate_;
+
+    //! build count of the particle pairs to evaluate at last coloring
+    int coloringbuildcount_;
+
+    //! index of particle pairs for each color and type
+    std::vector<SPHIndexOfParticlePairs> indexofcoloredparticlepairs_;
+
     //! interface to particle engine
     std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface_;
 
@@ -125,6 +288,9 @@ namespace ParticleInteraction
     //! interface to particle wall handler
     std::shared_ptr<PARTICLEWALL::WallHandlerInterface> particlewallinterface_;
 
+    //! verlet list of particle pairs
+    std::unique_ptr<ParticleInteraction::VerletList> verletlist_;
+
     //! kernel handler
     std::shared_ptr<ParticleInteraction::SPHKernelBase> kernel_;
   };
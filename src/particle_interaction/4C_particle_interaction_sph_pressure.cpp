@@ -21,7 +21,9 @@ FOUR_C_NAMESPACE_OPEN
 /*---------------------------------------------------------------------------*
  | definitions                                                               |
  *---------------------------------------------------------------------------*/
-ParticleInteraction::SPHPressure::SPHPressure()
+ParticleInteraction::SPHPressure::SPHPressure(const Teuchos::ParameterList& params)
+    : numthreads_(params.get<int>("NUM_THREADS")),
+      asyncghostrefresh_(params.get<bool>("ASYNC_GHOST_REFRESH"))
 {
   // empty constructor
 }
@@ -93,12 +95,19 @@ void ParticleInteraction::SPHPressure::compute_pressure() const
         equationofstatebundle_->get_ptr_to_specific_equation_of_state(type_i);
 
     // iterate over owned particles of current type
+#ifdef FOUR_C_WITH_OPENMP
+#pragma omp parallel for num_threads(numthreads_) schedule(static) if (numthreads_ > 1)
+#endif
     for (int i = 0; i < particlestored; ++i)
       press[i] = equationofstate->density_to_pressure(dens[i], material->initDensity_);
   }
 
   // refresh pressure of ghosted particles
-  particleengineinterface_->refresh_particles_of_specific_states_and_types(pressuretorefresh_);
+  if (asyncghostrefresh_)
+    particleengineinterface_->start_refresh_particles_of_specific_states_and_types(
+        pressuretorefresh_);
+  else
+    particleengineinterface_->refresh_particles_of_specific_states_and_types(pressuretorefresh_);
 }
 
 FOUR_C_NAMESPACE_CLOSE
@@ -13,6 +13,7 @@
  *---------------------------------------------------------------------------*/
 #include "4C_config.hpp"
 
+#include "4C_inpar_particle.hpp"
 #include "4C_particle_engine_enums.hpp"
 #include "4C_particle_engine_typedefs.hpp"
 
@@ -42,7 +43,7 @@ namespace ParticleInteraction
   {
    public:
     //! constructor
-    explicit SPHPressure();
+    explicit SPHPressure(const Teuchos::ParameterList& params);
 
     //! init pressure handler
     void init();
@@ -74,6 +75,12 @@ namespace ParticleInteraction
 
     //! set of fluid particle types
     std::set<PARTICLEENGINE::TypeEnum> fluidtypes_;
+
+    //! number of threads for evaluation of pressure
+    const int numthreads_;
+
+    //! start refresh of pressure of ghosted particles without waiting for its completion
+    const bool asyncghostrefresh_;
   };
 
 }  // namespace ParticleInteraction
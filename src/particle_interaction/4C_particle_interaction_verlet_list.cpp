@@ -0,0 +1,189 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "4C_particle_interaction_verlet_list.hpp"
+
+#include "4C_particle_engine_container.hpp"
+#include "4C_particle_engine_interface.hpp"
+#include "4C_particle_interaction_utils.hpp"
+
+#include <Teuchos_TimeMonitor.hpp>
+
+#include <algorithm>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*---------------------------------------------------------------------------*
+ | definitions                                                               |
+ *---------------------------------------------------------------------------*/
+ParticleInteraction::VerletList::VerletList(double skin, InteractionDistance interactiondistance)
+    : skin_(skin),
+      interactiondistance_(interactiondistance),
+      lastpotentialneighborsbuildcount_(-1),
+      numbuilds_(0)
+{
+  if (not(skin_ > 0.0)) FOUR_C_THROW("skin distance of verlet list must be positive!");
+}
+
+void ParticleInteraction::VerletList::setup(
+    const std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface)
+{
+  // set interface to particle engine
+  particleengineinterface_ = particleengineinterface;
+
+  // set particle container bundle
+  particlecontainerbundle_ = particleengineinterface_->get_particle_container_bundle();
+
+  // determine size of vectors indexed by particle types
+  const int typevectorsize = *(--particlecontainerbundle_->get_particle_types().end()) + 1;
+
+  // allocate memory to hold particle positions and radii at last build
+  lastbuildposition_.assign(typevectorsize, std::vector<std::vector<double>>(2));
+  lastbuildradius_.assign(typevectorsize, std::vector<std::vector<double>>(2));
+
+  // enforce build of verlet list
+  lastpotentialneighborsbuildcount_ = -1;
+}
+
+const PARTICLEENGINE::PotentialParticleNeighbors&
+ParticleInteraction::VerletList::get_particle_pairs()
+{
+  if (is_outdated()) build();
+
+  return particlepairs_;
+}
+
+bool ParticleInteraction::VerletList::is_outdated() const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::VerletList::is_outdated");
+
+  // local indices of particles changed with rebuild of potential particle neighbors
+  if (particleengineinterface_->get_potential_particle_neighbors_build_count() !=
+      lastpotentialneighborsbuildcount_)
+    return true;
+
+  // maximum displacement and maximum increase of radius of particles since last build
+  double maxdisp = 0.0;
+  double maxradiusincrease = 0.0;
+
+  for (const auto& type : particlecontainerbundle_->get_particle_types())
+  {
+    for (const auto& status : {PARTICLEENGINE::Owned, PARTICLEENGINE::Ghosted})
+    {
+      PARTICLEENGINE::ParticleContainer* container =
+          particlecontainerbundle_->get_specific_container(type, status);
+
+      const int particlestored = container->particles_stored();
+
+      const std::vector<double>& lastpos = lastbuildposition_[type][status];
+      const std::vector<double>& lastrad = lastbuildradius_[type][status];
+
+      // number of particles changed since last build
+      if (static_cast<int>(lastrad.size()) != particlestored) return true;
+
+      if (particlestored <= 0) continue;
+
+      const double* pos = container->get_ptr_to_state(PARTICLEENGINE::Position, 0);
+      const double* rad = container->get_ptr_to_state(PARTICLEENGINE::Radius, 0);
+
+      for (int i = 0; i < particlestored; ++i)
+      {
+        // displacement of particle considering periodic boundaries
+        double disp[3];
+        particleengineinterface_->distance_between_particles(&lastpos[3 * i], &pos[3 * i], disp);
+
+        maxdisp = std::max(maxdisp, Utils::vec_norm_two(disp));
+        maxradiusincrease = std::max(maxradiusincrease, rad[i] - lastrad[i]);
+      }
+    }
+  }
+
+  // particle pairs possibly entered their interaction distance
+  return (2.0 * maxdisp + 2.0 * maxradiusincrease >= skin_);
+}
+
+void ParticleInteraction::VerletList::build()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("ParticleInteraction::VerletList::build");
+
+  // clear particle pairs
+  particlepairs_.clear();
+
+  // iterate over potential particle neighbors
+  for (const auto& potentialneighbors :
+      particleengineinterface_->get_potential_particle_neighbors())
+  {
+    // access values of local index tuples of particle i and j
+    PARTICLEENGINE::TypeEnum type_i;
+    PARTICLEENGINE::StatusEnum status_i;
+    int particle_i;
+    std::tie(type_i, status_i, particle_i) = potentialneighbors.first;
+
+    PARTICLEENGINE::TypeEnum type_j;
+    PARTICLEENGINE::StatusEnum status_j;
+    int particle_j;
+    std::tie(type_j, status_j, particle_j) = potentialneighbors.second;
+
+    // get corresponding particle containers
+    PARTICLEENGINE::ParticleContainer* container_i =
+        particlecontainerbundle_->get_specific_container(type_i, status_i);
+
+    PARTICLEENGINE::ParticleContainer* container_j =
+        particlecontainerbundle_->get_specific_container(type_j, status_j);
+
+    // get pointer to particle states
+    const double* pos_i = container_i->get_ptr_to_state(PARTICLEENGINE::Position, particle_i);
+    const double* rad_i = container_i->get_ptr_to_state(PARTICLEENGINE::Radius, particle_i);
+
+    const double* pos_j = container_j->get_ptr_to_state(PARTICLEENGINE::Position, particle_j);
+    const double* rad_j = container_j->get_ptr_to_state(PARTICLEENGINE::Radius, particle_j);
+
+    // vector from particle i to j
+    double r_ji[3];
+
+    // distance between particles considering periodic boundaries
+    particleengineinterface_->distance_between_particles(pos_i, pos_j, r_ji);
+
+    // particles within interaction distance enlarged by skin distance
+    if (Utils::vec_norm_two(r_ji) < (interactiondistance_(rad_i[0], rad_j[0]) + skin_))
+      particlepairs_.push_back(potentialneighbors);
+  }
+
+  // store particle positions and radii at last build
+  for (const auto& type : particlecontainerbundle_->get_particle_types())
+  {
+    for (const auto& status : {PARTICLEENGINE::Owned, PARTICLEENGINE::Ghosted})
+    {
+      PARTICLEENGINE::ParticleContainer* container =
+          particlecontainerbundle_->get_specific_container(type, status);
+
+      const int particlestored = container->particles_stored();
+
+      std::vector<double>& lastpos = lastbuildposition_[type][status];
+      std::vector<double>& lastrad = lastbuildradius_[type][status];
+
+      lastpos.clear();
+      lastrad.clear();
+
+      if (particlestored <= 0) continue;
+
+      const double* pos = container->get_ptr_to_state(PARTICLEENGINE::Position, 0);
+      const double* rad = container->get_ptr_to_state(PARTICLEENGINE::Radius, 0);
+
+      lastpos.assign(pos, pos + 3 * particlestored);
+      lastrad.assign(rad, rad + particlestored);
+    }
+  }
+
+  // store build count of potential particle neighbors
+  lastpotentialneighborsbuildcount_ =
+      particleengineinterface_->get_potential_particle_neighbors_build_count();
+
+  ++numbuilds_;
+}
+
+FOUR_C_NAMESPACE_CLOSE
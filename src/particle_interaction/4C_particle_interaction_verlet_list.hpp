@@ -0,0 +1,119 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_PARTICLE_INTERACTION_VERLET_LIST_HPP
+#define FOUR_C_PARTICLE_INTERACTION_VERLET_LIST_HPP
+
+/*---------------------------------------------------------------------------*
+ | headers                                                                   |
+ *---------------------------------------------------------------------------*/
+#include "4C_config.hpp"
+
+#include "4C_particle_engine_enums.hpp"
+#include "4C_particle_engine_typedefs.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+FOUR_C_NAMESPACE_OPEN
+
+/*---------------------------------------------------------------------------*
+ | forward declarations                                                      |
+ *---------------------------------------------------------------------------*/
+namespace PARTICLEENGINE
+{
+  class ParticleEngineInterface;
+}  // namespace PARTICLEENGINE
+
+/*---------------------------------------------------------------------------*
+ | class declarations                                                        |
+ *---------------------------------------------------------------------------*/
+namespace ParticleInteraction
+{
+  /*!
+   * \brief Verlet list of particle pairs
+   *
+   * The Verlet list holds all potential particle neighbors of the particle engine closer than
+   * their interaction distance plus a skin distance. The list is reused as long as no particle
+   * pair could have entered its interaction distance since the last build, i.e., as long as twice
+   * the maximum particle displacement plus the maximum increase of the particle radius stays below
+   * the skin distance, and as long as the potential particle neighbors have not been rebuilt.
+   *
+   * The interaction distance of a particle pair is a function of the radii of both particles.
+   */
+  class VerletList final
+  {
+   public:
+    //! function returning the interaction distance of a particle pair given both radii
+    using InteractionDistance = std::function<double(double rad_i, double rad_j)>;
+
+    /*!
+     * \brief constructor
+     *
+     * \param[in] skin                skin distance of Verlet list
+     * \param[in] interactiondistance interaction distance of a particle pair
+     */
+    VerletList(double skin, InteractionDistance interactiondistance);
+
+    //! setup Verlet list
+    void setup(
+        const std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface);
+
+    /*!
+     * \brief get particle pairs of Verlet list
+     *
+     * The Verlet list is rebuilt if necessary.
+     *
+     * \return particle pairs possibly within their interaction distance
+     */
+    const PARTICLEENGINE::PotentialParticleNeighbors& get_particle_pairs();
+
+    //! get number of builds of Verlet list
+    inline int number_of_builds() const { return numbuilds_; };
+
+   private:
+    //! check whether Verlet list needs to be rebuilt
+    bool is_outdated() const;
+
+    //! build Verlet list from potential particle neighbors
+    void build();
+
+    //! skin distance of Verlet list
+    const double skin_;
+
+    //! interaction distance of a particle pair
+    const InteractionDistance interactiondistance_;
+
+    //! particle pairs of Verlet list
+    PARTICLEENGINE::PotentialParticleNeighbors particlepairs_;
+
+    //! particle positions at last build indexed by particle type and status
+    std::vector<std::vector<std::vector<double>>> lastbuildposition_;
+
+    //! particle radii at last build indexed by particle type and status
+    std::vector<std::vector<std::vector<double>>> lastbuildradius_;
+
+    //! build count of potential particle neighbors at last build
+    int lastpotentialneighborsbuildcount_;
+
+    //! number of builds of Verlet list
+    int numbuilds_;
+
+    //! interface to particle engine
+    std::shared_ptr<PARTICLEENGINE::ParticleEngineInterface> particleengineinterface_;
+
+    //! particle container bundle
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr particlecontainerbundle_;
+  };
+
+}  // namespace ParticleInteraction
+
+/*---------------------------------------------------------------------------*/
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
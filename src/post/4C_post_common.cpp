@@ -860,10 +860,15 @@ void PostResult::open_result_files(MAP* field_info)
   {
     num_output_procs = 1;
   }
+  int collective;
+  if (!map_find_int(field_info, "collective_output", &collective))
+  {
+    collective = 0;
+  }
   const std::string basename = map_read_string(field_info, "result_file");
   // field_->problem()->set_basename(basename);
   Epetra_Comm& comm = *field_->problem()->get_comm();
-  file_.open(basename, num_output_procs, comm.NumProc(), comm.MyPID());
+  file_.open(basename, num_output_procs, comm.NumProc(), comm.MyPID(), collective != 0);
 }
 
 /*----------------------------------------------------------------------*
@@ -2334,26 +2334,7 @@ void ScaTra::MeshtyingStrategyS2I::setup_meshtying()
         else
         {
           // match slave-side and master-side elements at mortar interface
-          switch (interface.search_alg())
-          {
-            case Inpar::Mortar::search_bfele:
-            {
-              interface.evaluate_search_brute_force(interface.search_param());
-              break;
-            }
-
-            case Inpar::Mortar::search_binarytree:
-            {
-              interface.evaluate_search_binarytree();
-              break;
-            }
-
-            default:
-            {
-              FOUR_C_THROW("Invalid search algorithm!");
-              break;
-            }
-          }
+          interface.evaluate_search();
 
           // evaluate normal vectors associated with slave-side nodes
           interface.evaluate_nodal_normals();
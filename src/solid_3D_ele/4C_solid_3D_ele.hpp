@@ -53,6 +53,21 @@ namespace Discret::Elements
     Core::LinAlg::SerialDenseMatrix compute_null_space(
         Core::Nodes::Node& node, const double* x0, const int numdof, const int dimnsp) override;
 
+    /*!
+     * @brief Evaluates force vector and stiffness matrix of all eligible elements in batches and
+     * assembles them into @p systemvector1 and @p systemmatrix1
+     *
+     * This is only done if the bool parameter "batched element evaluation" is set in @p p and the
+     * action is struct_calc_nlnstiff or struct_calc_internalforce. Eligible elements (see
+     * Solid::is_evaluated_in_batch()) skip these actions in Solid::evaluate() afterwards.
+     */
+    void pre_evaluate(Core::FE::Discretization& dis, Teuchos::ParameterList& p,
+        Teuchos::RCP<Core::LinAlg::SparseOperator> systemmatrix1,
+        Teuchos::RCP<Core::LinAlg::SparseOperator> systemmatrix2,
+        Teuchos::RCP<Core::LinAlg::Vector<double>> systemvector1,
+        Teuchos::RCP<Core::LinAlg::Vector<double>> systemvector2,
+        Teuchos::RCP<Core::LinAlg::Vector<double>> systemvector3) override;
+
     static SolidType& instance();
 
    private:
@@ -128,6 +143,8 @@ namespace Discret::Elements
         Core::LinAlg::SerialDenseVector& elevec2,
         Core::LinAlg::SerialDenseVector& elevec3) override;
 
+    bool has_state_independent_tangent(const Teuchos::ParameterList& params) const override;
+
     int evaluate_neumann(Teuchos::ParameterList& params, Core::FE::Discretization& discretization,
         Core::Conditions::Condition& condition, std::vector<int>& lm,
         Core::LinAlg::SerialDenseVector& elevec1,
@@ -199,6 +216,15 @@ namespace Discret::Elements
         const;
 
    private:
+    /*!
+     * @brief Whether force and stiffness of this element are evaluated in a batch in
+     * SolidType::pre_evaluate()
+     *
+     * This holds for hex8 and tet10 elements with nonlinear kinematics, the default integration
+     * rule, no element technology, no prestressing and a St. Venant-Kirchhoff material.
+     */
+    [[nodiscard]] bool is_evaluated_in_batch() const;
+
     //! cell type
     Core::FE::CellType celltype_ = Core::FE::CellType::dis_none;
 
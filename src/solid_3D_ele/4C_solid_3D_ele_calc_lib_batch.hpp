@@ -0,0 +1,321 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_SOLID_3D_ELE_CALC_LIB_BATCH_HPP
+#define FOUR_C_SOLID_3D_ELE_CALC_LIB_BATCH_HPP
+
+#include "4C_config.hpp"
+
+#include "4C_fem_general_cell_type.hpp"
+#include "4C_fem_general_cell_type_traits.hpp"
+#include "4C_fem_general_utils_gausspoints.hpp"
+#include "4C_linalg_fixedsizematrix.hpp"
+#include "4C_solid_3D_ele_calc_lib.hpp"
+
+#include <array>
+
+FOUR_C_NAMESPACE_OPEN
+
+namespace Discret::Elements
+{
+  /*!
+   * @brief Default number of elements that are evaluated simultaneously in one batch
+   *
+   * Eight lanes fill two AVX2 or one AVX-512 register with doubles.
+   */
+  inline constexpr int solid_batch_size = 8;
+
+  /*!
+   * @brief A batch of elements of the same cell type in struct-of-arrays layout
+   *
+   * Every nodal quantity is stored as an array over the elements (lanes) of the batch such that
+   * the innermost loops of the batched kernels run over contiguous memory and can be vectorized
+   * by the compiler.
+   *
+   * @note Lanes that are not occupied by an element must still hold a valid (non-degenerated)
+   * element, e.g. a copy of lane 0. Their results are simply ignored.
+   *
+   * @tparam celltype : Cell type of all elements in the batch
+   * @tparam batch_size : Number of elements in the batch
+   */
+  template <Core::FE::CellType celltype, int batch_size = solid_batch_size>
+  struct ElementNodesBatch
+  {
+    /// Reference coordinates, indexed by [node * num_dim + d][lane]
+    std::array<std::array<double, batch_size>, Internal::num_dof_per_ele<celltype>>
+        reference_coordinates{};
+
+    /// Nodal displacements, indexed by [node * num_dim + d][lane]
+    std::array<std::array<double, batch_size>, Internal::num_dof_per_ele<celltype>>
+        displacements{};
+  };
+
+  /*!
+   * @brief Force vectors and stiffness matrices of a batch of elements in struct-of-arrays layout
+   */
+  template <Core::FE::CellType celltype, int batch_size = solid_batch_size>
+  struct ForceStiffnessBatch
+  {
+    /// Internal force vector, indexed by [dof][lane]
+    std::array<std::array<double, batch_size>, Internal::num_dof_per_ele<celltype>> force{};
+
+    /// Stiffness matrix in row major order, indexed by [row * num_dof_per_ele + col][lane]
+    std::array<std::array<double, batch_size>,
+        Internal::num_dof_per_ele<celltype> * Internal::num_dof_per_ele<celltype>>
+        stiffness{};
+  };
+
+  /*!
+   * @brief Copies the nodal information of one element into lane @p lane of the batch
+   */
+  template <Core::FE::CellType celltype, int batch_size>
+  void pack_element_nodes_to_batch(const ElementNodes<celltype>& element_nodes, const int lane,
+      ElementNodesBatch<celltype, batch_size>& batch)
+  {
+    for (int i = 0; i < Internal::num_nodes<celltype>; ++i)
+    {
+      for (int d = 0; d < Internal::num_dim<celltype>; ++d)
+      {
+        batch.reference_coordinates[i * Internal::num_dim<celltype> + d][lane] =
+            element_nodes.reference_coordinates(i, d);
+        batch.displacements[i * Internal::num_dim<celltype> + d][lane] =
+            element_nodes.displacements(i, d);
+      }
+    }
+  }
+
+  /*!
+   * @brief Extracts force vector and stiffness matrix of lane @p lane from the batch
+   */
+  template <Core::FE::CellType celltype, int batch_size>
+  void extract_force_stiffness_from_batch(const ForceStiffnessBatch<celltype, batch_size>& batch,
+      const int lane, Core::LinAlg::Matrix<Internal::num_dof_per_ele<celltype>, 1>& force_vector,
+      Core::LinAlg::Matrix<Internal::num_dof_per_ele<celltype>,
+          Internal::num_dof_per_ele<celltype>>& stiffness_matrix)
+  {
+    constexpr int num_dof = Internal::num_dof_per_ele<celltype>;
+    for (int i = 0; i < num_dof; ++i)
+    {
+      force_vector(i) = batch.force[i][lane];
+      for (int j = 0; j < num_dof; ++j)
+        stiffness_matrix(i, j) = batch.stiffness[i * num_dof + j][lane];
+    }
+  }
+
+  /*!
+   * @brief Evaluates internal force vector and stiffness matrix of a batch of displacement based
+   * solid elements with nonlinear (total Lagrangian) kinematics
+   *
+   * This is the batched counterpart of the displacement based formulation evaluated by
+   * SolidEleCalc for materials with a constant material tangent @p cmat (i.e.
+   * St. Venant-Kirchhoff). The shape function derivatives are evaluated once per Gauss point for
+   * all elements, all element-specific quantities are evaluated lane-wise.
+   *
+   * @tparam celltype : Cell type of all elements in the batch
+   * @tparam batch_size : Number of elements in the batch
+   * @param nodes (in) : Nodal reference coordinates and displacements of the batch
+   * @param integration (in) : Gauss integration rule used for all elements of the batch
+   * @param cmat (in) : Constant material tangent in mixed Voigt notation
+   * @param result (out) : Force vectors and stiffness matrices of the batch
+   */
+  template <Core::FE::CellType celltype, int batch_size>
+  void evaluate_nonlinear_force_stiffness_batch(const ElementNodesBatch<celltype, batch_size>& nodes,
+      const Core::FE::GaussIntegration& integration,
+      const Core::LinAlg::Matrix<Internal::num_str<celltype>, Internal::num_str<celltype>>& cmat,
+      ForceStiffnessBatch<celltype, batch_size>& result)
+  {
+    static_assert(Internal::num_dim<celltype> == 3, "Batched evaluation is only available in 3D.");
+
+    constexpr int num_nodes = Internal::num_nodes<celltype>;
+    constexpr int num_dim = Internal::num_dim<celltype>;
+    constexpr int num_str = Internal::num_str<celltype>;
+    constexpr int num_dof = Internal::num_dof_per_ele<celltype>;
+
+    using Lanes = std::array<double, batch_size>;
+
+    for (auto& lanes : result.force) lanes.fill(0.0);
+    for (auto& lanes : result.stiffness) lanes.fill(0.0);
+
+    for (int gp = 0; gp < integration.num_points(); ++gp)
+    {
+      // shape function derivatives are identical for all elements of the batch
+      const Core::LinAlg::Matrix<num_dim, 1> xi =
+          evaluate_parameter_coordinate<celltype>(integration, gp);
+      Core::LinAlg::Matrix<num_dim, num_nodes> derivatives;
+      Core::FE::shape_function_deriv1<celltype>(xi, derivatives);
+
+      // Jacobian J(a,b) = dN_n/dxi_a * X_n,b
+      std::array<std::array<Lanes, num_dim>, num_dim> jacobian{};
+      for (int a = 0; a < num_dim; ++a)
+        for (int b = 0; b < num_dim; ++b)
+          for (int n = 0; n < num_nodes; ++n)
+          {
+            const double deriv = derivatives(a, n);
+            const Lanes& X = nodes.reference_coordinates[n * num_dim + b];
+            for (int l = 0; l < batch_size; ++l) jacobian[a][b][l] += deriv * X[l];
+          }
+
+      // inverse Jacobian by cofactors and integration factor
+      std::array<std::array<Lanes, num_dim>, num_dim> inverse_jacobian;
+      Lanes integration_factor;
+      for (int l = 0; l < batch_size; ++l)
+      {
+        const auto J = [&](int a, int b) { return jacobian[a][b][l]; };
+        const double cof00 = J(1, 1) * J(2, 2) - J(1, 2) * J(2, 1);
+        const double cof01 = J(1, 2) * J(2, 0) - J(1, 0) * J(2, 2);
+        const double cof02 = J(1, 0) * J(2, 1) - J(1, 1) * J(2, 0);
+        const double det = J(0, 0) * cof00 + J(0, 1) * cof01 + J(0, 2) * cof02;
+        const double inv_det = 1.0 / det;
+
+        inverse_jacobian[0][0][l] = cof00 * inv_det;
+        inverse_jacobian[1][0][l] = cof01 * inv_det;
+        inverse_jacobian[2][0][l] = cof02 * inv_det;
+        inverse_jacobian[0][1][l] = (J(0, 2) * J(2, 1) - J(0, 1) * J(2, 2)) * inv_det;
+        inverse_jacobian[1][1][l] = (J(0, 0) * J(2, 2) - J(0, 2) * J(2, 0)) * inv_det;
+        inverse_jacobian[2][1][l] = (J(0, 1) * J(2, 0) - J(0, 0) * J(2, 1)) * inv_det;
+        inverse_jacobian[0][2][l] = (J(0, 1) * J(1, 2) - J(0, 2) * J(1, 1)) * inv_det;
+        inverse_jacobian[1][2][l] = (J(0, 2) * J(1, 0) - J(0, 0) * J(1, 2)) * inv_det;
+        inverse_jacobian[2][2][l] = (J(0, 0) * J(1, 1) - J(0, 1) * J(1, 0)) * inv_det;
+
+        integration_factor[l] = det * integration.weight(gp);
+      }
+
+      // derivatives of the shape functions w.r.t. the reference coordinates
+      std::array<std::array<Lanes, num_nodes>, num_dim> N_XYZ{};
+      for (int a = 0; a < num_dim; ++a)
+        for (int n = 0; n < num_nodes; ++n)
+          for (int b = 0; b < num_dim; ++b)
+          {
+            const double deriv = derivatives(b, n);
+            for (int l = 0; l < batch_size; ++l)
+              N_XYZ[a][n][l] += inverse_jacobian[a][b][l] * deriv;
+          }
+
+      // deformation gradient F = I + u^T N_XYZ^T
+      std::array<std::array<Lanes, num_dim>, num_dim> defgrd{};
+      for (int i = 0; i < num_dim; ++i)
+      {
+        defgrd[i][i].fill(1.0);
+        for (int j = 0; j < num_dim; ++j)
+          for (int n = 0; n < num_nodes; ++n)
+          {
+            const Lanes& u = nodes.displacements[n * num_dim + i];
+            for (int l = 0; l < batch_size; ++l) defgrd[i][j][l] += u[l] * N_XYZ[j][n][l];
+          }
+      }
+
+      // Green-Lagrange strain in strain-like Voigt notation
+      std::array<Lanes, num_str> gl_strain{};
+      constexpr std::array<std::array<int, 2>, num_str> voigt_index = {
+          {{0, 0}, {1, 1}, {2, 2}, {0, 1}, {1, 2}, {2, 0}}};
+      for (int s = 0; s < num_str; ++s)
+      {
+        const int a = voigt_index[s][0];
+        const int b = voigt_index[s][1];
+        const double factor = (s < num_dim) ? 0.5 : 1.0;
+        for (int k = 0; k < num_dim; ++k)
+          for (int l = 0; l < batch_size; ++l)
+            gl_strain[s][l] += factor * defgrd[k][a][l] * defgrd[k][b][l];
+        if (s < num_dim)
+          for (int l = 0; l < batch_size; ++l) gl_strain[s][l] -= 0.5;
+      }
+
+      // 2nd Piola-Kirchhoff stress
+      std::array<Lanes, num_str> pk2{};
+      for (int s = 0; s < num_str; ++s)
+        for (int t = 0; t < num_str; ++t)
+        {
+          const double c = cmat(s, t);
+          for (int l = 0; l < batch_size; ++l) pk2[s][l] += c * gl_strain[t][l];
+        }
+
+      // nonlinear B-operator
+      std::array<std::array<Lanes, num_dof>, num_str> bop;
+      for (int n = 0; n < num_nodes; ++n)
+      {
+        for (int e = 0; e < num_dim; ++e)
+        {
+          const int dof = num_dim * n + e;
+          for (int l = 0; l < batch_size; ++l)
+          {
+            bop[0][dof][l] = defgrd[e][0][l] * N_XYZ[0][n][l];
+            bop[1][dof][l] = defgrd[e][1][l] * N_XYZ[1][n][l];
+            bop[2][dof][l] = defgrd[e][2][l] * N_XYZ[2][n][l];
+            bop[3][dof][l] = defgrd[e][0][l] * N_XYZ[1][n][l] + defgrd[e][1][l] * N_XYZ[0][n][l];
+            bop[4][dof][l] = defgrd[e][1][l] * N_XYZ[2][n][l] + defgrd[e][2][l] * N_XYZ[1][n][l];
+            bop[5][dof][l] = defgrd[e][2][l] * N_XYZ[0][n][l] + defgrd[e][0][l] * N_XYZ[2][n][l];
+          }
+        }
+      }
+
+      // internal force vector
+      for (int k = 0; k < num_dof; ++k)
+        for (int s = 0; s < num_str; ++s)
+          for (int l = 0; l < batch_size; ++l)
+            result.force[k][l] += integration_factor[l] * bop[s][k][l] * pk2[s][l];
+
+      // elastic stiffness B^T C B
+      std::array<std::array<Lanes, num_dof>, num_str> cbop{};
+      for (int s = 0; s < num_str; ++s)
+        for (int t = 0; t < num_str; ++t)
+        {
+          const double c = cmat(s, t);
+          for (int k = 0; k < num_dof; ++k)
+            for (int l = 0; l < batch_size; ++l) cbop[s][k][l] += c * bop[t][k][l];
+        }
+
+      for (int i = 0; i < num_dof; ++i)
+        for (int s = 0; s < num_str; ++s)
+        {
+          Lanes weighted_bop;
+          for (int l = 0; l < batch_size; ++l)
+            weighted_bop[l] = integration_factor[l] * bop[s][i][l];
+          for (int j = 0; j < num_dof; ++j)
+          {
+            Lanes& stiff = result.stiffness[i * num_dof + j];
+            for (int l = 0; l < batch_size; ++l) stiff[l] += weighted_bop[l] * cbop[s][j][l];
+          }
+        }
+
+      // geometric stiffness N_XYZ^T S N_XYZ
+      for (int inod = 0; inod < num_nodes; ++inod)
+      {
+        std::array<Lanes, num_dim> SmB_L;
+        for (int l = 0; l < batch_size; ++l)
+        {
+          SmB_L[0][l] = pk2[0][l] * N_XYZ[0][inod][l] + pk2[3][l] * N_XYZ[1][inod][l] +
+                        pk2[5][l] * N_XYZ[2][inod][l];
+          SmB_L[1][l] = pk2[3][l] * N_XYZ[0][inod][l] + pk2[1][l] * N_XYZ[1][inod][l] +
+                        pk2[4][l] * N_XYZ[2][inod][l];
+          SmB_L[2][l] = pk2[5][l] * N_XYZ[0][inod][l] + pk2[4][l] * N_XYZ[1][inod][l] +
+                        pk2[2][l] * N_XYZ[2][inod][l];
+        }
+
+        for (int jnod = 0; jnod < num_nodes; ++jnod)
+        {
+          Lanes bopstrbop;
+          for (int l = 0; l < batch_size; ++l)
+          {
+            bopstrbop[l] = integration_factor[l] *
+                           (N_XYZ[0][jnod][l] * SmB_L[0][l] + N_XYZ[1][jnod][l] * SmB_L[1][l] +
+                               N_XYZ[2][jnod][l] * SmB_L[2][l]);
+          }
+
+          for (int d = 0; d < num_dim; ++d)
+          {
+            Lanes& stiff = result.stiffness[(num_dim * inod + d) * num_dof + num_dim * jnod + d];
+            for (int l = 0; l < batch_size; ++l) stiff[l] += bopstrbop[l];
+          }
+        }
+      }
+    }
+  }
+}  // namespace Discret::Elements
+
+FOUR_C_NAMESPACE_CLOSE
+
+#endif
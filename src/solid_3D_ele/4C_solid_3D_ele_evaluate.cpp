@@ -10,9 +10,14 @@
 #include "4C_fem_general_extract_values.hpp"
 #include "4C_linalg_serialdensematrix.hpp"
 #include "4C_linalg_serialdensevector.hpp"
+#include "4C_linalg_utils_sparse_algebra_assemble.hpp"
+#include "4C_mat_so3_material.hpp"
+#include "4C_mat_stvenantkirchhoff.hpp"
 #include "4C_solid_3D_ele.hpp"
 #include "4C_solid_3D_ele_calc_interface.hpp"
 #include "4C_solid_3D_ele_calc_lib.hpp"
+#include "4C_solid_3D_ele_calc_lib_batch.hpp"
+#include "4C_solid_3D_ele_calc_lib_integration.hpp"
 #include "4C_solid_3D_ele_calc_lib_io.hpp"
 #include "4C_solid_3D_ele_calc_lib_nitsche.hpp"
 #include "4C_solid_3D_ele_calc_mulf.hpp"
@@ -20,6 +25,12 @@
 #include "4C_structure_new_elements_paramsinterface.hpp"
 #include "4C_utils_exceptions.hpp"
 
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 namespace
@@ -54,6 +65,164 @@ namespace
 
     evaluate_inertia_force(mass_matrix, acceleration_vector, inertia_force);
   }
+
+  /*!
+   * @brief Returns a pointer to the stiffness matrix, or nullptr if the caller does not request it
+   *
+   * The discretization hands an empty matrix if it reuses a cached stiffness matrix of an element
+   * with a state-independent tangent.
+   */
+  Core::LinAlg::SerialDenseMatrix* get_stiffness_matrix_ptr(
+      Core::LinAlg::SerialDenseMatrix& stiffness_matrix)
+  {
+    return stiffness_matrix.numRows() > 0 ? &stiffness_matrix : nullptr;
+  }
+
+  Core::Elements::ActionType get_action_type(const Teuchos::ParameterList& params)
+  {
+    if (params.isParameter("interface"))
+    {
+      return params.get<Teuchos::RCP<Core::Elements::ParamsInterface>>("interface")
+          ->get_action_type();
+    }
+    else if (params.isParameter("action"))
+      return Core::Elements::string_to_action_type(params.get<std::string>("action"));
+    else
+      return Core::Elements::none;
+  }
+
+  //! parameter that tells the elements whether they were already assembled in a batch
+  const std::string assembled_in_batches = "solid elements assembled in batches";
+
+  /*!
+   * @brief Collects elements of one cell type sharing the same St. Venant-Kirchhoff material,
+   * evaluates them batch-wise and assembles the results
+   *
+   * Only the data of a single batch is held, each batch is assembled as soon as it is full.
+   */
+  template <Core::FE::CellType celltype>
+  class SolidElementBatcher
+  {
+   public:
+    SolidElementBatcher(const Mat::StVenantKirchhoff& material,
+        Core::LinAlg::SparseOperator* stiffness_matrix, Core::LinAlg::Vector<double>* force_vector)
+        : integration_(Discret::Elements::create_gauss_integration<celltype>(
+              Discret::Elements::get_gauss_rule_stiffness_matrix<celltype>())),
+          stiffness_matrix_(stiffness_matrix),
+          force_vector_(force_vector),
+          element_force_(num_dof_per_ele_),
+          element_stiffness_(num_dof_per_ele_, num_dof_per_ele_)
+    {
+      Mat::StVenantKirchhoff::fill_cmat(cmat_, material.youngs(), material.poisson_ratio());
+    }
+
+    void add(const Core::Elements::Element& ele, const Core::FE::Discretization& dis)
+    {
+      LocationData& location = locations_[num_lanes_];
+      location.lm.clear();
+      location.lmowner.clear();
+      location.lmstride.clear();
+      ele.location_vector(dis, location.lm, location.lmowner, location.lmstride);
+
+      const Discret::Elements::ElementNodes<celltype> element_nodes =
+          Discret::Elements::evaluate_element_nodes<celltype>(ele, dis, location.lm);
+      Discret::Elements::ensure_positive_jacobian_determinant_at_element_nodes(element_nodes);
+
+      Discret::Elements::pack_element_nodes_to_batch(element_nodes, num_lanes_, nodes_);
+      ele_ids_[num_lanes_++] = ele.id();
+
+      if (num_lanes_ == Discret::Elements::solid_batch_size) evaluate_and_assemble();
+    }
+
+    void evaluate_and_assemble()
+    {
+      if (num_lanes_ == 0) return;
+
+      // unused lanes have to hold a valid element, so just repeat the first one
+      for (int lane = num_lanes_; lane < Discret::Elements::solid_batch_size; ++lane)
+      {
+        for (int i = 0; i < num_dof_per_ele_; ++i)
+        {
+          nodes_.reference_coordinates[i][lane] = nodes_.reference_coordinates[i][0];
+          nodes_.displacements[i][lane] = nodes_.displacements[i][0];
+        }
+      }
+
+      Discret::Elements::evaluate_nonlinear_force_stiffness_batch(
+          nodes_, integration_, cmat_, result_);
+
+      Core::LinAlg::Matrix<num_dof_per_ele_, 1> force(element_force_, true);
+      Core::LinAlg::Matrix<num_dof_per_ele_, num_dof_per_ele_> stiffness(element_stiffness_, true);
+      for (int lane = 0; lane < num_lanes_; ++lane)
+      {
+        Discret::Elements::extract_force_stiffness_from_batch(result_, lane, force, stiffness);
+
+        const LocationData& location = locations_[lane];
+        if (stiffness_matrix_ != nullptr)
+        {
+          stiffness_matrix_->assemble(
+              ele_ids_[lane], location.lmstride, element_stiffness_, location.lm, location.lmowner);
+        }
+        if (force_vector_ != nullptr)
+          Core::LinAlg::assemble(*force_vector_, element_force_, location.lm, location.lmowner);
+      }
+
+      num_lanes_ = 0;
+    }
+
+   private:
+    static constexpr int num_dof_per_ele_ = Discret::Elements::Internal::num_dof_per_ele<celltype>;
+
+    struct LocationData
+    {
+      std::vector<int> lm;
+      std::vector<int> lmowner;
+      std::vector<int> lmstride;
+    };
+
+    Core::FE::GaussIntegration integration_;
+    Core::LinAlg::Matrix<6, 6> cmat_;
+
+    Core::LinAlg::SparseOperator* stiffness_matrix_;
+    Core::LinAlg::Vector<double>* force_vector_;
+
+    Discret::Elements::ElementNodesBatch<celltype> nodes_;
+    Discret::Elements::ForceStiffnessBatch<celltype> result_;
+    std::array<int, Discret::Elements::solid_batch_size> ele_ids_{};
+    std::array<LocationData, Discret::Elements::solid_batch_size> locations_;
+    int num_lanes_ = 0;
+
+    Core::LinAlg::SerialDenseVector element_force_;
+    Core::LinAlg::SerialDenseMatrix element_stiffness_;
+  };
+
+  /*!
+   * @brief Batcher of every (cell type, material) pair of a discretization
+   */
+  template <Core::FE::CellType celltype>
+  using SolidElementBatchers =
+      std::map<const Core::Mat::PAR::Parameter*, std::unique_ptr<SolidElementBatcher<celltype>>>;
+
+  template <Core::FE::CellType celltype>
+  void add_to_batch(const Core::Elements::Element& ele, const Mat::StVenantKirchhoff& material,
+      const Core::FE::Discretization& dis, SolidElementBatchers<celltype>& batchers,
+      Core::LinAlg::SparseOperator* stiffness_matrix, Core::LinAlg::Vector<double>* force_vector)
+  {
+    auto& batcher = batchers[material.parameter()];
+    if (batcher == nullptr)
+    {
+      batcher =
+          std::make_unique<SolidElementBatcher<celltype>>(material, stiffness_matrix, force_vector);
+    }
+
+    batcher->add(ele, dis);
+  }
+
+  template <Core::FE::CellType celltype>
+  void evaluate_and_assemble_remaining(SolidElementBatchers<celltype>& batchers)
+  {
+    for (auto& [material, batcher] : batchers) batcher->evaluate_and_assemble();
+  }
 }  // namespace
 
 int Discret::Elements::Solid::evaluate(Teuchos::ParameterList& params,
@@ -85,17 +254,24 @@ int Discret::Elements::Solid::evaluate(Teuchos::ParameterList& params,
   {
     case Core::Elements::struct_calc_nlnstiff:
     {
+      // force and stiffness were already assembled in SolidType::pre_evaluate()
+      if (params.get<bool>(assembled_in_batches, false) && is_evaluated_in_batch()) return 0;
+
       std::visit(
           [&](auto& interface)
           {
             interface->evaluate_nonlinear_force_stiffness_mass(
-                *this, *solid_material(), discretization, lm, params, &elevec1, &elemat1, nullptr);
+                *this, *solid_material(), discretization, lm, params, &elevec1,
+                get_stiffness_matrix_ptr(elemat1), nullptr);
           },
           solid_calc_variant_);
       return 0;
     }
     case Core::Elements::struct_calc_internalforce:
     {
+      // the force was already assembled in SolidType::pre_evaluate()
+      if (params.get<bool>(assembled_in_batches, false) && is_evaluated_in_batch()) return 0;
+
       std::visit(
           [&](auto& interface)
           {
@@ -112,7 +288,8 @@ int Discret::Elements::Solid::evaluate(Teuchos::ParameterList& params,
           [&](auto& interface)
           {
             interface->evaluate_nonlinear_force_stiffness_mass(
-                *this, *solid_material(), discretization, lm, params, &elevec1, &elemat1, &elemat2);
+                *this, *solid_material(), discretization, lm, params, &elevec1,
+                get_stiffness_matrix_ptr(elemat1), &elemat2);
           },
           solid_calc_variant_);
 
@@ -125,7 +302,8 @@ int Discret::Elements::Solid::evaluate(Teuchos::ParameterList& params,
           [&](auto& interface)
           {
             interface->evaluate_nonlinear_force_stiffness_mass(
-                *this, *solid_material(), discretization, lm, params, &elevec1, &elemat1, &elemat2);
+                *this, *solid_material(), discretization, lm, params, &elevec1,
+                get_stiffness_matrix_ptr(elemat1), &elemat2);
           },
           solid_calc_variant_);
 
@@ -256,6 +434,97 @@ int Discret::Elements::Solid::evaluate(Teuchos::ParameterList& params,
   return 0;
 }
 
+bool Discret::Elements::Solid::has_state_independent_tangent(
+    const Teuchos::ParameterList& params) const
+{
+  // linear kinematics and a constant material tangent without any further element technology
+  if (solid_ele_property_.kintype != Inpar::Solid::KinemType::linear ||
+      solid_ele_property_.element_technology != ElementTechnology::none ||
+      solid_ele_property_.prestress_technology != PrestressTechnology::none)
+    return false;
+
+  if (solid_material()->material_type() != Core::Materials::m_stvenant) return false;
+
+  // elemat1 is the stiffness matrix only for these actions
+  switch (get_action_type(params))
+  {
+    case Core::Elements::struct_calc_nlnstiff:
+    case Core::Elements::struct_calc_nlnstiffmass:
+    case Core::Elements::struct_calc_nlnstifflmass:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool Discret::Elements::Solid::is_evaluated_in_batch() const
+{
+  if (celltype_ != Core::FE::CellType::hex8 && celltype_ != Core::FE::CellType::tet10) return false;
+
+  if (solid_ele_property_.kintype != Inpar::Solid::KinemType::nonlinearTotLag ||
+      solid_ele_property_.element_technology != ElementTechnology::none ||
+      solid_ele_property_.prestress_technology != PrestressTechnology::none)
+    return false;
+
+  if (solid_material()->material_type() != Core::Materials::m_stvenant) return false;
+
+  // elements with a non-default integration rule are evaluated in the element loop
+  switch (celltype_)
+  {
+    case Core::FE::CellType::hex8:
+      return compare_gauss_integration(
+          get_gauss_rule(), create_gauss_integration<Core::FE::CellType::hex8>(
+                                get_gauss_rule_stiffness_matrix<Core::FE::CellType::hex8>()));
+    case Core::FE::CellType::tet10:
+      return compare_gauss_integration(
+          get_gauss_rule(), create_gauss_integration<Core::FE::CellType::tet10>(
+                                get_gauss_rule_stiffness_matrix<Core::FE::CellType::tet10>()));
+    default:
+      return false;
+  }
+}
+
+void Discret::Elements::SolidType::pre_evaluate(Core::FE::Discretization& dis,
+    Teuchos::ParameterList& p, Teuchos::RCP<Core::LinAlg::SparseOperator> systemmatrix1,
+    Teuchos::RCP<Core::LinAlg::SparseOperator> systemmatrix2,
+    Teuchos::RCP<Core::LinAlg::Vector<double>> systemvector1,
+    Teuchos::RCP<Core::LinAlg::Vector<double>> systemvector2,
+    Teuchos::RCP<Core::LinAlg::Vector<double>> systemvector3)
+{
+  // the parameter list may be reused for several evaluations, so always reset the switch
+  p.set<bool>(assembled_in_batches, false);
+
+  if (!p.get<bool>("batched element evaluation", false) || !dis.has_state("displacement")) return;
+
+  const Core::Elements::ActionType action = get_action_type(p);
+  if (action != Core::Elements::struct_calc_nlnstiff &&
+      action != Core::Elements::struct_calc_internalforce)
+    return;
+
+  Core::LinAlg::SparseOperator* stiffness_matrix =
+      action == Core::Elements::struct_calc_nlnstiff ? systemmatrix1.get() : nullptr;
+
+  SolidElementBatchers<Core::FE::CellType::hex8> hex8_batchers;
+  SolidElementBatchers<Core::FE::CellType::tet10> tet10_batchers;
+
+  for (int i = 0; i < dis.num_my_col_elements(); ++i)
+  {
+    const auto* ele = dynamic_cast<const Solid*>(dis.l_col_element(i));
+    if (ele == nullptr || !ele->is_evaluated_in_batch()) continue;
+
+    const auto& material = dynamic_cast<const Mat::StVenantKirchhoff&>(*ele->material());
+    if (ele->celltype_ == Core::FE::CellType::hex8)
+      add_to_batch(*ele, material, dis, hex8_batchers, stiffness_matrix, systemvector1.get());
+    else
+      add_to_batch(*ele, material, dis, tet10_batchers, stiffness_matrix, systemvector1.get());
+  }
+
+  evaluate_and_assemble_remaining(hex8_batchers);
+  evaluate_and_assemble_remaining(tet10_batchers);
+
+  p.set<bool>(assembled_in_batches, true);
+}
+
 void Discret::Elements::Solid::set_integration_rule(
     const Core::FE::GaussIntegration& integration_rule)
 {
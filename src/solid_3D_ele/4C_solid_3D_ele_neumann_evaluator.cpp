@@ -15,6 +15,9 @@
 #include "4C_solid_3D_ele_calc_lib_integration.hpp"
 #include "4C_utils_function.hpp"
 
+#include <algorithm>
+#include <vector>
+
 FOUR_C_NAMESPACE_OPEN
 
 void Discret::Elements::evaluate_neumann_by_element(Core::Elements::Element& element,
@@ -104,49 +107,101 @@ void Discret::Elements::evaluate_neumann(Core::Elements::Element& element,
   const ElementNodes<celltype> nodal_coordinates =
       evaluate_element_nodes<celltype>(element, discretization, dof_index_array);
 
+  const auto check_jacobian_determinant = [&](const JacobianMapping<celltype>& jacobian_mapping)
+  {
+    if (jacobian_mapping.determinant_ == 0.0)
+      FOUR_C_THROW("The determinant of the jacobian is zero for element with id %i", element.id());
+    else if (jacobian_mapping.determinant_ < 0.0)
+      FOUR_C_THROW("The determinant of the jacobian is negative (%d) for element with id %i",
+          jacobian_mapping.determinant_, element.id());
+  };
+
+  // Evaluates the Neumann boundary condition: f_{x,y,z}^i=\sum_j N^i(xi^j) * value(t) *
+  // integration_factor_j
+  // assembles the element force vector [f_x^1, f_y^1, f_z^1, ..., f_x^n, f_y^n, f_z^n]
+  const auto add_gauss_point_contribution =
+      [&](const Core::LinAlg::Matrix<numnod, 1>& shape_functions, int dim,
+          double value_times_integration_factor)
+  {
+    for (auto nodeid = 0; nodeid < numnod; ++nodeid)
+    {
+      element_force_vector[nodeid * numdim + dim] +=
+          shape_functions(nodeid) * value_times_integration_factor;
+    }
+  };
+
+  bool has_function = false;
+  for (auto dim = 0; dim < numdim; dim++) has_function |= onoff[dim] and function_ids[dim] > 0;
+
+  // constant loads are integrated directly
+  if (!has_function)
+  {
+    for_each_gauss_point<celltype>(nodal_coordinates, gauss_integration,
+        [&](const Core::LinAlg::Matrix<Internal::num_dim<celltype>, 1>& xi,
+            const ShapeFunctionsAndDerivatives<celltype>& shape_functions,
+            const JacobianMapping<celltype>& jacobian_mapping, double integration_factor, int gp)
+        {
+          check_jacobian_determinant(jacobian_mapping);
+
+          for (auto dim = 0; dim < numdim; dim++)
+          {
+            if (onoff[dim])
+            {
+              add_gauss_point_contribution(
+                  shape_functions.shapefunctions_, dim, value[dim] * integration_factor);
+            }
+          }
+        });
+    return;
+  }
+
+  // collect the Gauss point data first, so that the functions are evaluated for all Gauss points
+  // of the element at once
+  static_assert(numdim == 3, "The functions are evaluated at points in 3-dimensional space.");
+  const int numgp = gauss_integration.num_points();
+  std::vector<double> gauss_point_reference_coordinates(numdim * numgp);
+  std::vector<Core::LinAlg::Matrix<numnod, 1>> gauss_point_shape_functions(numgp);
+  std::vector<double> gauss_point_integration_factors(numgp);
+
   for_each_gauss_point<celltype>(nodal_coordinates, gauss_integration,
       [&](const Core::LinAlg::Matrix<Internal::num_dim<celltype>, 1>& xi,
           const ShapeFunctionsAndDerivatives<celltype>& shape_functions,
           const JacobianMapping<celltype>& jacobian_mapping, double integration_factor, int gp)
       {
-        if (jacobian_mapping.determinant_ == 0.0)
-          FOUR_C_THROW(
-              "The determinant of the jacobian is zero for element with id %i", element.id());
-        else if (jacobian_mapping.determinant_ < 0.0)
-          FOUR_C_THROW("The determinant of the jacobian is negative (%d) for element with id %i",
-              jacobian_mapping.determinant_, element.id());
+        check_jacobian_determinant(jacobian_mapping);
 
         // material/reference co-ordinates of Gauss point
-        Core::LinAlg::Matrix<numdim, 1> gauss_point_reference_coordinates;
-        gauss_point_reference_coordinates.multiply_tn(
+        Core::LinAlg::Matrix<numdim, 1> reference_coordinates(
+            &gauss_point_reference_coordinates[numdim * gp], true);
+        reference_coordinates.multiply_tn(
             nodal_coordinates.reference_coordinates, shape_functions.shapefunctions_);
 
-        for (auto dim = 0; dim < numdim; dim++)
-        {
-          if (onoff[dim])
-          {
-            // function evaluation
-            const int function_number = function_ids[dim];
-            const double function_scale_factor =
-                (function_number > 0)
-                    ? Global::Problem::instance()
-                          ->function_by_id<Core::Utils::FunctionOfSpaceTime>(function_number - 1)
-                          .evaluate(gauss_point_reference_coordinates.data(), total_time, dim)
-                    : 1.0;
-
-            const double value_times_integration_factor =
-                value[dim] * function_scale_factor * integration_factor;
-
-            for (auto nodeid = 0; nodeid < numnod; ++nodeid)
-            {
-              // Evaluates the Neumann boundary condition: f_{x,y,z}^i=\sum_j N^i(xi^j) * value(t) *
-              // integration_factor_j
-              // assembles the element force vector [f_x^1, f_y^1, f_z^1, ..., f_x^n, f_y^n, f_z^n]
-              element_force_vector[nodeid * numdim + dim] +=
-                  shape_functions.shapefunctions_(nodeid) * value_times_integration_factor;
-            }
-          }
-        }
+        gauss_point_shape_functions[gp] = shape_functions.shapefunctions_;
+        gauss_point_integration_factors[gp] = integration_factor;
       });
+
+  std::vector<double> function_scale_factors(numgp);
+  for (auto dim = 0; dim < numdim; dim++)
+  {
+    if (!onoff[dim]) continue;
+
+    // function evaluation
+    const int function_number = function_ids[dim];
+    if (function_number > 0)
+    {
+      Global::Problem::instance()
+          ->function_by_id<Core::Utils::FunctionOfSpaceTime>(function_number - 1)
+          .evaluate_points(gauss_point_reference_coordinates.data(), numgp, total_time, dim,
+              function_scale_factors.data());
+    }
+    else
+      std::fill(function_scale_factors.begin(), function_scale_factors.end(), 1.0);
+
+    for (int gp = 0; gp < numgp; ++gp)
+    {
+      add_gauss_point_contribution(gauss_point_shape_functions[gp], dim,
+          value[dim] * function_scale_factors[gp] * gauss_point_integration_factors[gp]);
+    }
+  }
 }
 FOUR_C_NAMESPACE_CLOSE
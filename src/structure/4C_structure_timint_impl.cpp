@@ -17,6 +17,7 @@
 #include "4C_contact_defines.hpp"
 #include "4C_contact_meshtying_contact_bridge.hpp"
 #include "4C_fem_condition_locsys.hpp"
+#include "4C_fem_discretization_matrix_free_operator.hpp"
 #include "4C_fem_discretization_nullspace.hpp"
 #include "4C_global_data.hpp"
 #include "4C_inpar_beamcontact.hpp"
@@ -109,7 +110,9 @@ Solid::TimIntImpl::TimIntImpl(const Teuchos::ParameterList& timeparams,
       stcscale_(Teuchos::getIntegralValue<Inpar::Solid::StcScale>(sdynparams, "STC_SCALING")),
       stclayer_(sdynparams.get<int>("STC_LAYER")),
       ptcdt_(sdynparams.get<double>("PTCDT")),
-      dti_(1.0 / ptcdt_)
+      dti_(1.0 / ptcdt_),
+      matrixfree_(sdynparams.get<bool>("MATRIX_FREE_SOLVE")),
+      batchedevaluation_(sdynparams.get<bool>("BATCHED_ELEMENT_EVALUATION"))
 {
   // Keep this constructor empty!
   // First do everything on the more basic objects like the discretizations, like e.g.
@@ -213,6 +216,31 @@ void Solid::TimIntImpl::setup()
         Inpar::Solid::nonlin_sol_tech_string(itertype_).c_str());
   }
 
+  // the matrix-free operator only reproduces the stiffness assembled by the elements
+  if (matrixfree_)
+  {
+    if (method_name() != Inpar::Solid::dyna_statics or
+        itertype_ != Inpar::Solid::soltech_newtonfull)
+      FOUR_C_THROW("MATRIX_FREE_SOLVE is only implemented for statics with a full Newton method.");
+    if (have_contact_meshtying() or have_beam_contact() or conman_->have_constraint() or
+        cardvasc0dman_->have_cardiovascular0_d() or springman_->have_spring_dashpot() or
+        locsysman_ != Teuchos::null or stcscale_ != Inpar::Solid::stc_none)
+    {
+      FOUR_C_THROW(
+          "MATRIX_FREE_SOLVE does not support contact, constraints, Cardiovascular0D or spring "
+          "dashpot conditions, local coordinate systems and STC.");
+    }
+    if (pred_ == Inpar::Solid::pred_tangdis or sdynparams_.get<bool>("LOADLIN"))
+    {
+      FOUR_C_THROW(
+          "MATRIX_FREE_SOLVE does not support the tangential predictor and linearized loads, "
+          "since both require the assembled stiffness matrix.");
+    }
+
+    // the stiffness matrix is never assembled, so release the memory reserved for its entries
+    stiff_ = Teuchos::make_rcp<Core::LinAlg::SparseMatrix>(*dof_row_map_view(), 0, false, true);
+  }
+
   // setup tolerances and binary operators for convergence check of contact/meshtying problems
   // in saddlepoint formulation
   tolcontconstr_ = tolfres_;
@@ -868,13 +896,15 @@ void Solid::TimIntImpl::apply_force_stiff_internal(const double time, const doub
   double dtcpu = timer_->wallTime();
   // *********** time measurement ***********
 
-  // action for elements
-  const std::string action = "calc_struct_nlnstiff";
+  // action for elements, without a stiffness matrix only the internal force is evaluated
+  const std::string action =
+      stiff != Teuchos::null ? "calc_struct_nlnstiff" : "calc_struct_internalforce";
   params.set("action", action);
   // other parameters that might be needed by the elements
   params.set("total time", time);
   params.set("delta time", dt);
   params.set("damping", damping_);
+  params.set("batched element evaluation", batchedevaluation_);
   if (pressure_ != Teuchos::null) params.set("volume", 0.0);
 
   // set vector values needed by elements
@@ -900,6 +930,32 @@ void Solid::TimIntImpl::apply_force_stiff_internal(const double time, const doub
   // *********** time measurement ***********
 }
 
+/*----------------------------------------------------------------------*/
+/* solve with the matrix-free stiffness operator */
+int Solid::TimIntImpl::matrix_free_linear_solve(const Core::LinAlg::SolverParams& solver_params)
+{
+  // the elements are evaluated at the current state, like in apply_force_stiff_internal(), but
+  // with a zero displacement increment, such that repeated evaluations within the Krylov method do
+  // not update internal element variables any further
+  Teuchos::ParameterList params;
+  params.set("action", "calc_struct_nlnstiff");
+  params.set("total time", timen_);
+  params.set("delta time", (*dt_)[0]);
+  params.set("damping", damping_);
+
+  discret_->clear_state();
+  discret_->set_state(0, "residual displacement", zeros_);
+  discret_->set_state(0, "displacement", disn_);
+
+  auto stiffness =
+      Teuchos::make_rcp<Core::FE::MatrixFreeOperator>(discret_, params, dbcmaps_->cond_map());
+  const int error = solver_->solve(stiffness, disi_, fres_, solver_params);
+
+  discret_->clear_state();
+
+  return error;
+}
+
 /*----------------------------------------------------------------------*/
 /* evaluate inertia force and its linearization */
 void Solid::TimIntImpl::apply_force_stiff_internal_and_inertial(const double time, const double dt,
@@ -1456,7 +1512,7 @@ int Solid::TimIntImpl::newton_full()
   // --> On #stiff_ is the effective dynamic stiffness matrix
 
   // check whether we have a sanely filled stiffness matrix
-  if (not stiff_->filled())
+  if (not matrixfree_ and not stiff_->filled())
   {
     FOUR_C_THROW("Effective stiffness matrix must be filled here");
   }
@@ -1492,7 +1548,12 @@ int Solid::TimIntImpl::newton_full()
 
     // apply Dirichlet BCs to system of equations
     disi_->PutScalar(0.0);  // Useful? depends on solver and more
-    if (get_loc_sys_trafo() != Teuchos::null)
+    if (matrixfree_)
+    {
+      // the matrix-free operator treats the Dirichlet rows as identity itself
+      Core::LinAlg::apply_dirichlet_to_system(*disi_, *fres_, *zeros_, *(dbcmaps_->cond_map()));
+    }
+    else if (get_loc_sys_trafo() != Teuchos::null)
     {
       Core::LinAlg::apply_dirichlet_to_system(
           *Core::LinAlg::cast_to_sparse_matrix_and_check_success(stiff_), *disi_, *fres_,
@@ -1526,7 +1587,10 @@ int Solid::TimIntImpl::newton_full()
       solver_params.refactor = true;
       solver_params.reset = iter_ == 1;
       solver_params.projector = projector_;
-      linsolve_error = solver_->solve(stiff_->epetra_operator(), disi_, fres_, solver_params);
+      if (matrixfree_)
+        linsolve_error = matrix_free_linear_solve(solver_params);
+      else
+        linsolve_error = solver_->solve(stiff_->epetra_operator(), disi_, fres_, solver_params);
       // check for problems in linear solver
       // however we only care about this if we have a fancy divcont action (meaning function will
       // return 0 )
@@ -28,6 +28,7 @@ namespace Core::LinAlg
 {
   class MultiMapExtractor;
   class KrylovProjector;
+  struct SolverParams;
 }  // namespace Core::LinAlg
 
 /*----------------------------------------------------------------------*/
@@ -271,6 +272,9 @@ namespace Solid
             Teuchos::null  //!< material damping matrix
     );
 
+    //! Solve for the residual displacements with the matrix-free stiffness operator
+    int matrix_free_linear_solve(const Core::LinAlg::SolverParams& solver_params);
+
     //! Evaluate internal and inertia forces and their linearizations
     void apply_force_stiff_internal_and_inertial(const double time,  //!< evaluation time
         const double dt,                                             //!< step size
@@ -1050,6 +1054,12 @@ namespace Solid
     double dti_;    //!< scaling factor for PTC (initially 1/ptcdt_, then adapted)
     //@}
 
+    //! solve the linear systems with the matrix-free operator instead of the assembled stiffness
+    bool matrixfree_;
+
+    //! evaluate eligible solid elements in batches
+    bool batchedevaluation_;
+
   };  // class TimIntImpl
 
 }  // namespace Solid
@@ -188,14 +188,18 @@ void Solid::TimIntStatics::evaluate_force_stiff_residual(Teuchos::ParameterList&
   bool predict = false;
   if (params.isParameter("predict")) predict = params.get<bool>("predict");
 
+  // the matrix-free linear solver applies the stiffness through the elements, so only the
+  // residual is evaluated in this case
+  Teuchos::RCP<Core::LinAlg::SparseOperator> stiff = matrixfree_ ? Teuchos::null : stiff_;
+
   // initialize stiffness matrix to zero
-  stiff_->zero();
+  if (stiff != Teuchos::null) stiff->zero();
 
   // ************************** (1) EXTERNAL FORCES ***************************
 
   // build new external forces
   fextn_->PutScalar(0.0);
-  apply_force_stiff_external(timen_, (*dis_)(0), disn_, (*vel_)(0), *fextn_, stiff_);
+  apply_force_stiff_external(timen_, (*dis_)(0), disn_, (*vel_)(0), *fextn_, stiff);
 
   // additional external forces are added (e.g. interface forces)
   fextn_->Update(1.0, *fifc_, 1.0);
@@ -206,20 +210,20 @@ void Solid::TimIntStatics::evaluate_force_stiff_residual(Teuchos::ParameterList&
   fintn_->PutScalar(0.0);
 
   // ordinary internal force and stiffness
-  apply_force_stiff_internal(timen_, (*dt_)[0], disn_, disi_, veln_, fintn_, stiff_, params);
+  apply_force_stiff_internal(timen_, (*dt_)[0], disn_, disi_, veln_, fintn_, stiff, params);
 
   // apply forces and stiffness due to constraints
   Teuchos::ParameterList pcon;  // apply empty parameterlist, no scaling necessary
-  apply_force_stiff_constraint(timen_, (*dis_)(0), disn_, fintn_, stiff_, pcon);
+  apply_force_stiff_constraint(timen_, (*dis_)(0), disn_, fintn_, stiff, pcon);
 
   // add forces and stiffness due to Cardiovascular0D bcs
   Teuchos::ParameterList pwindk;
   pwindk.set("time_step_size", (*dt_)[0]);
-  apply_force_stiff_cardiovascular0_d(timen_, disn_, fintn_, stiff_, pwindk);
+  apply_force_stiff_cardiovascular0_d(timen_, disn_, fintn_, stiff, pwindk);
 
   // add forces and stiffness due to spring dashpot condition
   Teuchos::ParameterList psprdash;
-  apply_force_stiff_spring_dashpot(stiff_, fintn_, disn_, veln_, predict, psprdash);
+  apply_force_stiff_spring_dashpot(stiff, fintn_, disn_, veln_, predict, psprdash);
 
   // ************************** (3) INERTIAL FORCES ***************************
   // This is statics, so there are no intertial forces.
@@ -247,13 +251,13 @@ void Solid::TimIntStatics::evaluate_force_stiff_residual(Teuchos::ParameterList&
   // i.e. do nothing here
 
   // apply forces and stiffness due to beam contact
-  apply_force_stiff_beam_contact(*stiff_, *fres_, *disn_, predict);
+  if (stiff != Teuchos::null) apply_force_stiff_beam_contact(*stiff, *fres_, *disn_, predict);
 
   // apply forces and stiffness due to contact / meshtying
-  apply_force_stiff_contact_meshtying(stiff_, fres_, disn_, predict);
+  apply_force_stiff_contact_meshtying(stiff, fres_, disn_, predict);
 
   // close stiffness matrix
-  stiff_->complete();
+  if (stiff != Teuchos::null) stiff->complete();
 
   return;
 }
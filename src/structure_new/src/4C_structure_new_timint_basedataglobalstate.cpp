@@ -641,6 +641,7 @@ Core::LinAlg::SparseOperator*
 Solid::TimeInt::BaseDataGlobalState::create_structural_stiffness_matrix_block()
 {
   stiff_ = Teuchos::make_rcp<Core::LinAlg::SparseMatrix>(*dof_row_map_view(), 81, true, true);
+  if (datasdyn_->is_freeze_matrix_pattern()) stiff_->freeze_pattern();
 
   return stiff_.get();
 }
@@ -33,6 +33,8 @@ Solid::TimeInt::BaseDataSDyn::BaseDataSDyn()
       masslintype_(Inpar::Solid::ml_none),
       lumpmass_(false),
       neglectinertia_(false),
+      freezematrixpattern_(false),
+      batchedelementevaluation_(false),
       modeltypes_(Teuchos::null),
       eletechs_(Teuchos::null),
       coupling_model_ptr_(Teuchos::null),
@@ -150,6 +152,11 @@ void Solid::TimeInt::BaseDataSDyn::init(const Teuchos::RCP<Core::FE::Discretizat
     neglectinertia_ = sdynparams.get<bool>("NEGLECTINERTIA");
   }
   // ---------------------------------------------------------------------------
+  // initialize the assembly control parameters
+  // ---------------------------------------------------------------------------
+  freezematrixpattern_ = sdynparams.get<bool>("FREEZE_MATRIX_PATTERN");
+  batchedelementevaluation_ = sdynparams.get<bool>("BATCHED_ELEMENT_EVALUATION");
+  // ---------------------------------------------------------------------------
   // initialize model evaluator control parameters
   // ---------------------------------------------------------------------------
   {
@@ -311,6 +311,20 @@ namespace Solid
       }
       ///@}
 
+      /// Returns whether element assembly into the stiffness matrix uses cached positions
+      bool is_freeze_matrix_pattern() const
+      {
+        check_init_setup();
+        return freezematrixpattern_;
+      }
+
+      /// Returns whether eligible solid elements are evaluated in batches
+      bool is_batched_element_evaluation() const
+      {
+        check_init_setup();
+        return batchedelementevaluation_;
+      }
+
       /// @name Get model evaluator control parameters (read only access)
       ///@{
       /// Returns types of the current models
@@ -736,6 +750,12 @@ namespace Solid
       bool neglectinertia_;
       ///@}
 
+      /// cache the positions of the element matrices in the stiffness matrix?
+      bool freezematrixpattern_;
+
+      /// evaluate eligible solid elements in batches?
+      bool batchedelementevaluation_;
+
       /// @name Model evaluator control parameters
       ///@{
 
@@ -1196,6 +1196,8 @@ void Solid::ModelEvaluator::Structure::evaluate_internal(Teuchos::ParameterList&
   // FixMe as soon as possible: write data to the parameter list.
   // this is about to go, once the old time integration is deleted
   params_interface2_parameter_list(eval_data_ptr(), p);
+  p.set<bool>(
+      "batched element evaluation", tim_int().get_data_sdyn().is_batched_element_evaluation());
 
   discret().evaluate(p, eval_mat[0], eval_mat[1], eval_vec[0], eval_vec[1], eval_vec[2]);
   discret().clear_state();
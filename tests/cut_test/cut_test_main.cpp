@@ -64,6 +64,8 @@ void test_hex8_quad4_woelbung();
 void test_hex8_tet4_touch();
 void test_hex8_tet4_touch2();
 void test_hex8_mesh();
+void test_hex8_mesh_cut_teardown();
+void test_hex8_mesh_threaded_direct_divergence();
 void test_hex8_double();
 void test_hex8_multiple();
 void test_hex8_bad1();
@@ -502,6 +504,8 @@ int main(int argc, char** argv)
   functable["hex8_tet4_touch"] = test_hex8_tet4_touch;
   functable["hex8_tet4_touch2"] = test_hex8_tet4_touch2;
   functable["hex8_mesh"] = test_hex8_mesh;
+  functable["hex8_mesh_cut_teardown"] = test_hex8_mesh_cut_teardown;
+  functable["hex8_mesh_threaded_direct_divergence"] = test_hex8_mesh_threaded_direct_divergence;
   functable["hex8_double"] = test_hex8_double;
   functable["hex8_bad1"] = test_hex8_bad1;
   functable["hex8_bad2"] = test_hex8_bad2;
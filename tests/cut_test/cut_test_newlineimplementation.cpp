@@ -469,9 +469,9 @@ void test_christoph_1()
 
   std::vector<double> dirDivVol;
 
-  Cut::Mesh mesh = intersection.normal_mesh();
-  const std::list<Teuchos::RCP<Cut::VolumeCell>>& other_cells = mesh.volume_cells();
-  for (std::list<Teuchos::RCP<Cut::VolumeCell>>::const_iterator i = other_cells.begin();
+  Cut::Mesh& mesh = intersection.normal_mesh();
+  const std::vector<Cut::VolumeCell*>& other_cells = mesh.volume_cells();
+  for (std::vector<Cut::VolumeCell*>::const_iterator i = other_cells.begin();
        i != other_cells.end(); ++i)
   {
     Cut::VolumeCell* vc = &**i;
@@ -5,11 +5,26 @@
 //
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
+#include "4C_config.hpp"
+
 #include "4C_cut_element.hpp"
 #include "4C_cut_mesh.hpp"
+#include "4C_cut_meshintersection.hpp"
 #include "4C_cut_options.hpp"
 #include "4C_cut_position.hpp"
 #include "4C_cut_triangulateFacet.hpp"
+#include "4C_cut_volumecell.hpp"
+#include "4C_fem_general_utils_gausspoints.hpp"
+#include "4C_inpar_cut.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
 
 #include "cut_test_utils.hpp"
 
@@ -398,6 +413,189 @@ void test_hex8_mesh()
   cutmesh(mesh);
 }
 
+/// Cut a hex8 mesh several times, each time in a new mesh that is destroyed afterwards. This
+/// measures the cut together with the release of the lines, facets and cells of the mesh.
+void test_hex8_mesh_cut_teardown()
+{
+  const int repetitions = 5;
+  std::size_t num_volume_cells = 0;
+
+  for (int r = 0; r < repetitions; ++r)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t num_cells = 0;
+    {
+      Cut::Options options;
+      options.init_for_cuttests();
+      Cut::Mesh mesh(options);
+
+      create_hex8_mesh(mesh, 10, 10, 10);
+
+      Cut::Side* s = create_quad4(mesh, 0.5, 0.5, 0);
+
+      Cut::plain_element_set done;
+      Cut::plain_element_set elements_done;
+      mesh.cut(*(s), done, elements_done);
+
+      cutmesh(mesh);
+
+      num_cells = mesh.volume_cells().size();
+    }
+    const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "cut and teardown " << r << ": " << time.count() << " s\n";
+
+    if (r == 0)
+      num_volume_cells = num_cells;
+    else if (num_cells != num_volume_cells)
+      FOUR_C_THROW("Repeated cut created %d instead of %d volume cells",
+          static_cast<int>(num_cells), static_cast<int>(num_volume_cells));
+  }
+}
+
+namespace
+{
+  //! Gauss points (coordinates and weight) of the volume cells of every element, sorted
+  using ElementGaussRules = std::map<int, std::vector<std::vector<std::array<double, 4>>>>;
+
+  /// Cut a 4x4x2 hex8 mesh with a tilted plane of 3x3 quad4 sides, such that several elements are
+  /// cut by the same sides, and create the DirectDivergence integration rules with num_threads.
+  ElementGaussRules direct_divergence_gauss_rules(int num_threads)
+  {
+    Teuchos::ParameterList parameters;
+    Inpar::Cut::set_valid_parameters(parameters);
+    Teuchos::ParameterList& cut_general = parameters.sublist("CUT GENERAL");
+    cut_general.set("FINALIZE_NUM_THREADS", num_threads);
+
+    Cut::MeshIntersection intersection;
+    intersection.get_options().init_by_paramlist(cut_general);
+
+    const int nx = 4;
+    const int ny = 4;
+    const int nz = 2;
+    const double h = 0.25;
+    auto node_id = [&](int i, int j, int k) { return (k * (ny + 1) + j) * (nx + 1) + i; };
+
+    int eid = 0;
+    for (int k = 0; k < nz; ++k)
+    {
+      for (int j = 0; j < ny; ++j)
+      {
+        for (int i = 0; i < nx; ++i)
+        {
+          const std::array<std::array<int, 3>, 8> corners = {{{i, j, k}, {i + 1, j, k},
+              {i + 1, j + 1, k}, {i, j + 1, k}, {i, j, k + 1}, {i + 1, j, k + 1},
+              {i + 1, j + 1, k + 1}, {i, j + 1, k + 1}}};
+
+          Core::LinAlg::SerialDenseMatrix hex8_xyze(3, 8);
+          std::vector<int> nids;
+          for (int n = 0; n < 8; ++n)
+          {
+            for (int d = 0; d < 3; ++d) hex8_xyze(d, n) = h * corners[n][d];
+            nids.push_back(node_id(corners[n][0], corners[n][1], corners[n][2]));
+          }
+          intersection.add_element(++eid, nids, hex8_xyze, Core::FE::CellType::hex8);
+        }
+      }
+    }
+
+    // the plane z = 0.21 + 0.13 x + 0.07 y does not pass through any node of the hex8 mesh
+    const int ns = 3;
+    const double hs = 1.2 / ns;
+    int sid = 0;
+    for (int j = 0; j < ns; ++j)
+    {
+      for (int i = 0; i < ns; ++i)
+      {
+        const std::array<std::array<int, 2>, 4> corners = {
+            {{i, j}, {i + 1, j}, {i + 1, j + 1}, {i, j + 1}}};
+
+        Core::LinAlg::SerialDenseMatrix quad4_xyze(3, 4);
+        std::vector<int> nids;
+        for (int n = 0; n < 4; ++n)
+        {
+          const double x = -0.1 + hs * corners[n][0];
+          const double y = -0.1 + hs * corners[n][1];
+          quad4_xyze(0, n) = x;
+          quad4_xyze(1, n) = y;
+          quad4_xyze(2, n) = 0.21 + 0.13 * x + 0.07 * y;
+          nids.push_back(1000 + corners[n][1] * (ns + 1) + corners[n][0]);
+        }
+        intersection.add_cut_side(++sid, nids, quad4_xyze, Core::FE::CellType::quad4);
+      }
+    }
+
+    intersection.cut_test_cut(true, Cut::VCellGaussPts_DirectDivergence,
+        Cut::BCellGaussPts_Tessellation, true, false);
+
+    // volume cells and their Gauss points are ordered independently of memory addresses
+    ElementGaussRules rules;
+    for (int e = 1; e <= eid; ++e)
+    {
+      for (Cut::VolumeCell* vc : intersection.normal_mesh().get_element(e)->volume_cells())
+      {
+        std::vector<std::array<double, 4>> rule;
+        Teuchos::RCP<Core::FE::GaussPoints> gp = vc->get_gauss_rule();
+        for (int q = 0; gp != Teuchos::null and q < gp->num_points(); ++q)
+        {
+          const double* x = gp->point(q);
+          rule.push_back({x[0], x[1], x[2], gp->weight(q)});
+        }
+        std::sort(rule.begin(), rule.end());
+        rules[e].push_back(rule);
+      }
+      std::sort(rules[e].begin(), rules[e].end());
+    }
+
+    return rules;
+  }
+}  // namespace
+
+/// The DirectDivergence integration rules created on several threads are the serial ones
+void test_hex8_mesh_threaded_direct_divergence()
+{
+#ifdef FOUR_C_WITH_OPENMP
+  const ElementGaussRules serial = direct_divergence_gauss_rules(1);
+  const ElementGaussRules threaded = direct_divergence_gauss_rules(4);
+
+  int num_cut_elements = 0;
+  for (const auto& [eid, serial_rules] : serial)
+  {
+    if (serial_rules.size() > 1) ++num_cut_elements;
+
+    const auto& threaded_rules = threaded.at(eid);
+    if (threaded_rules.size() != serial_rules.size())
+      FOUR_C_THROW("Element %d has %d threaded but %d serial volume cells", eid,
+          static_cast<int>(threaded_rules.size()), static_cast<int>(serial_rules.size()));
+
+    for (std::size_t c = 0; c < serial_rules.size(); ++c)
+    {
+      if (threaded_rules[c].size() != serial_rules[c].size())
+        FOUR_C_THROW("Volume cell %d of element %d has a different number of Gauss points",
+            static_cast<int>(c), eid);
+
+      for (std::size_t q = 0; q < serial_rules[c].size(); ++q)
+      {
+        for (int d = 0; d < 4; ++d)
+        {
+          const double reference = serial_rules[c][q][d];
+          if (std::abs(threaded_rules[c][q][d] - reference) >
+              1.0e-14 * std::max(1.0, std::abs(reference)))
+            FOUR_C_THROW("Gauss point %d of volume cell %d of element %d differs",
+                static_cast<int>(q), static_cast<int>(c), eid);
+        }
+      }
+    }
+  }
+
+  // the plane passes through every column of elements
+  if (num_cut_elements < 16)
+    FOUR_C_THROW("Only %d elements were cut by the plane", num_cut_elements);
+#else
+  std::cout << "Threaded DirectDivergence integration requires OpenMP, test skipped\n";
+#endif
+}
+
 void test_hex8_double()
 {
   Cut::Options options;
@@ -208,15 +208,15 @@ void test_sud_sc1()
   std::vector<double> tessVol, momFitVol, dirDivVol;
 
   Cut::Mesh mesh = intersection.NormalMesh();
-  const std::list<Teuchos::RCP<Cut::VolumeCell>>& other_cells = mesh.VolumeCells();
-  for (std::list<Teuchos::RCP<Cut::VolumeCell>>::const_iterator i = other_cells.begin();
+  const std::vector<Cut::VolumeCell*>& other_cells = mesh.VolumeCells();
+  for (std::vector<Cut::VolumeCell*>::const_iterator i = other_cells.begin();
        i != other_cells.end(); ++i)
   {
     Cut::VolumeCell* vc = &**i;
     tessVol.push_back(vc->Volume());
   }
 
-  for (std::list<Teuchos::RCP<Cut::VolumeCell>>::const_iterator i = other_cells.begin();
+  for (std::vector<Cut::VolumeCell*>::const_iterator i = other_cells.begin();
        i != other_cells.end(); ++i)
   {
     Cut::VolumeCell* vc = &**i;
@@ -224,7 +224,7 @@ void test_sud_sc1()
     momFitVol.push_back(vc->Volume());
   }
 
-  for (std::list<Teuchos::RCP<Cut::VolumeCell>>::const_iterator i = other_cells.begin();
+  for (std::vector<Cut::VolumeCell*>::const_iterator i = other_cells.begin();
        i != other_cells.end(); ++i)
   {
     Cut::VolumeCell* vc = &**i;
@@ -0,0 +1,180 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_cut_kernel_double_double.hpp"
+
+#include <cmath>
+
+namespace
+{
+  using namespace FourC;
+  using namespace Cut::Kernel;
+
+  TEST(DoubleDoubleArithmeticTest, TwoSumIsExact)
+  {
+    // the small summand is completely lost in the double sum and kept in the error term
+    const double tiny = std::ldexp(1.0, -60);
+    const DoubleDouble sum = DoubleDoubleArithmetic::two_sum(1.0, tiny);
+    EXPECT_EQ(sum.hi, 1.0);
+    EXPECT_EQ(sum.lo, tiny);
+
+    // cancellation is exact
+    const double epsilon = std::ldexp(1.0, -52);
+    const DoubleDouble difference = DoubleDoubleArithmetic::two_sum(1.0 + epsilon, -1.0);
+    EXPECT_EQ(difference.hi, epsilon);
+    EXPECT_EQ(difference.lo, 0.0);
+
+    const DoubleDouble rounded = DoubleDoubleArithmetic::two_sum(0.1, 0.2);
+    EXPECT_EQ(rounded.hi, 0.1 + 0.2);
+    EXPECT_EQ(rounded.lo, std::ldexp(-1.0, -55));
+  }
+
+  TEST(DoubleDoubleArithmeticTest, TwoProdIsExact)
+  {
+    // (1 + 2^-30)^2 = 1 + 2^-29 + 2^-60
+    const double a = 1.0 + std::ldexp(1.0, -30);
+    const DoubleDouble product = DoubleDoubleArithmetic::two_prod(a, a);
+    EXPECT_EQ(product.hi, 1.0 + std::ldexp(1.0, -29));
+    EXPECT_EQ(product.lo, std::ldexp(1.0, -60));
+
+    const DoubleDouble exact = DoubleDoubleArithmetic::two_prod(3.0, 0.5);
+    EXPECT_EQ(exact.hi, 1.5);
+    EXPECT_EQ(exact.lo, 0.0);
+  }
+
+  TEST(DoubleDoubleArithmeticTest, OperatorsKeepLowOrderPart)
+  {
+    const double tiny = std::ldexp(1.0, -70);
+    const DoubleDouble sum = DoubleDouble(1.0) + DoubleDouble(tiny);
+    const DoubleDouble difference = sum - DoubleDouble(1.0);
+    EXPECT_EQ(difference.hi, tiny);
+
+    const DoubleDouble product = DoubleDouble(1.0, tiny) * DoubleDouble(2.0);
+    EXPECT_EQ(product.hi, 2.0);
+    EXPECT_EQ(product.lo, 2.0 * tiny);
+  }
+
+  TEST(DoubleDoubleRefinementTest, NearlyParallelEdgeSideIntersection)
+  {
+    // side [-1,1]^2 in the plane z = 0, its local coordinates are the global x and y
+    Core::LinAlg::Matrix<3, 4> xyze_side(true);
+    const double corners[4][2] = {{-1.0, -1.0}, {1.0, -1.0}, {1.0, 1.0}, {-1.0, 1.0}};
+    for (int k = 0; k < 4; ++k)
+    {
+      xyze_side(0, k) = corners[k][0];
+      xyze_side(1, k) = corners[k][1];
+    }
+
+    // the edge crosses the side at its midpoint (0.25, 0.125, 0) with a slope of 2^-24 only
+    const double h = std::ldexp(1.0, -24);
+    Core::LinAlg::Matrix<3, 2> xyze_edge;
+    xyze_edge(0, 0) = -0.25;
+    xyze_edge(1, 0) = -0.375;
+    xyze_edge(2, 0) = -h;
+    xyze_edge(0, 1) = 0.75;
+    xyze_edge(1, 1) = 0.625;
+    xyze_edge(2, 1) = h;
+
+    // double-like solution with errors far above the limit of the cut kernel
+    Core::LinAlg::Matrix<3, 1> xsi;
+    xsi(0) = 0.25 + 1.0e-7;
+    xsi(1) = 0.125 - 1.0e-7;
+    xsi(2) = 3.0e-8;
+
+    const double residual =
+        refine_intersection_double_double<Core::FE::CellType::line2, Core::FE::CellType::quad4>(
+            xyze_side, xyze_edge, xsi);
+
+    ASSERT_GE(residual, 0.0);
+    EXPECT_LT(residual, 1.0e-20);
+    EXPECT_NEAR(xsi(0), 0.25, 1.0e-15);
+    EXPECT_NEAR(xsi(1), 0.125, 1.0e-15);
+    EXPECT_NEAR(xsi(2), 0.0, 1.0e-15);
+  }
+
+  TEST(DoubleDoubleRefinementTest, SingularEdgeSideIntersection)
+  {
+    Core::LinAlg::Matrix<3, 3> xyze_side(true);
+    xyze_side(0, 1) = 1.0;
+    xyze_side(1, 2) = 1.0;
+
+    // the edge lies in the plane of the side
+    Core::LinAlg::Matrix<3, 2> xyze_edge(true);
+    xyze_edge(0, 0) = 0.1;
+    xyze_edge(0, 1) = 0.5;
+    xyze_edge(1, 1) = 0.2;
+
+    Core::LinAlg::Matrix<3, 1> xsi;
+    xsi(0) = 0.2;
+    xsi(1) = 0.1;
+    xsi(2) = 0.0;
+
+    EXPECT_LT(
+        (refine_intersection_double_double<Core::FE::CellType::line2, Core::FE::CellType::tri3>(
+            xyze_side, xyze_edge, xsi)),
+        0.0);
+  }
+
+  TEST(DoubleDoubleRefinementTest, PointSideDistance)
+  {
+    // tri3 side with the unscaled normal (0, 0, 4)
+    Core::LinAlg::Matrix<3, 3> xyze_side(true);
+    xyze_side(0, 1) = 2.0;
+    xyze_side(1, 2) = 2.0;
+
+    const double distance = 1.0e-3;
+    Core::LinAlg::Matrix<3, 1> px;
+    px(0) = 0.5;
+    px(1) = 0.5;
+    px(2) = distance;
+
+    Core::LinAlg::Matrix<3, 1> xsi;
+    xsi(0) = 0.25 + 1.0e-9;
+    xsi(1) = 0.25 - 1.0e-9;
+    xsi(2) = distance * (1.0 + 1.0e-9);
+
+    const double residual =
+        refine_distance_double_double<Core::FE::CellType::tri3>(xyze_side, px, xsi);
+
+    ASSERT_GE(residual, 0.0);
+    EXPECT_LT(residual, 1.0e-20);
+    EXPECT_NEAR(xsi(0), 0.25, 1.0e-16);
+    EXPECT_NEAR(xsi(1), 0.25, 1.0e-16);
+    EXPECT_NEAR(xsi(2), distance, 1.0e-18);
+  }
+
+  TEST(DoubleDoubleRefinementTest, PointWarpedSideDistance)
+  {
+    // warped quad4 side, the point lies on the unit normal at the side center
+    Core::LinAlg::Matrix<3, 4> xyze_side(true);
+    const double corners[4][3] = {
+        {-1.0, -1.0, 0.1}, {1.0, -1.0, -0.1}, {1.0, 1.0, 0.1}, {-1.0, 1.0, -0.1}};
+    for (int k = 0; k < 4; ++k)
+      for (int i = 0; i < 3; ++i) xyze_side(i, k) = corners[k][i];
+
+    // at r = s = 0: x = 0, x_r = (1, 0, 0), x_s = (0, 1, 0), so the unit normal is (0, 0, 1)
+    const double distance = -0.3;
+    Core::LinAlg::Matrix<3, 1> px(true);
+    px(2) = distance;
+
+    Core::LinAlg::Matrix<3, 1> xsi;
+    xsi(0) = 1.0e-8;
+    xsi(1) = -2.0e-8;
+    xsi(2) = distance + 1.0e-8;
+
+    const double residual =
+        refine_distance_double_double<Core::FE::CellType::quad4>(xyze_side, px, xsi);
+
+    ASSERT_GE(residual, 0.0);
+    EXPECT_LT(residual, 1.0e-20);
+    EXPECT_NEAR(xsi(0), 0.0, 1.0e-15);
+    EXPECT_NEAR(xsi(1), 0.0, 1.0e-15);
+    EXPECT_NEAR(xsi(2), distance, 1.0e-15);
+  }
+}  // namespace
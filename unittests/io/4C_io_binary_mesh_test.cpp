@@ -0,0 +1,172 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_io_binary_mesh.hpp"
+
+#include "4C_comm_pack_buffer.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <Epetra_MpiComm.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  template <typename Object>
+  std::vector<char> pack(const Object& object)
+  {
+    Core::Communication::PackBuffer buffer;
+    object.pack(buffer);
+    return buffer();
+  }
+
+  void write_file(const std::filesystem::path& file, const std::string& content)
+  {
+    std::ofstream stream(file);
+    stream << content;
+  }
+
+  class BinaryMeshTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = Teuchos::make_rcp<Epetra_MpiComm>(MPI_COMM_WORLD);
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      directory_ = std::filesystem::temp_directory_path() / "4C_io_binary_mesh_test";
+      std::filesystem::remove_all(directory_);
+      std::filesystem::create_directories(directory_);
+
+      // a top-level input file that includes a second one
+      input_files_ = {directory_ / "main.dat", directory_ / "include.dat"};
+      write_file(input_files_[0], "--INCLUDES\ninclude.dat\n");
+      write_file(input_files_[1], "--STRUCTURE ELEMENTS\n");
+
+      mesh_file_ = Core::IO::binary_mesh_file_path(input_files_[0], comm_->NumProc());
+    }
+
+    void TearDown() override
+    {
+      Core::IO::cout.close();
+      std::filesystem::remove_all(directory_);
+    }
+
+    Teuchos::RCP<Core::FE::Discretization> create_discretization() const
+    {
+      Core::IO::GridGenerator::RectangularCuboidInputs inputs{};
+      inputs.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputs.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputs.interval_ = std::array<int, 3>{3, 3, 3};
+      inputs.node_gid_of_first_new_node_ = 0;
+      inputs.elementtype_ = "SOLID";
+      inputs.distype_ = "HEX8";
+      inputs.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      auto dis = Teuchos::make_rcp<Core::FE::Discretization>("structure", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(*dis, inputs, true);
+      dis->fill_complete(true, false, false);
+      return dis;
+    }
+
+    //! try to read the binary mesh file into an empty discretization
+    bool read(Teuchos::RCP<Core::FE::Discretization>& dis, int& max_node_id) const
+    {
+      dis = Teuchos::make_rcp<Core::FE::Discretization>("structure", comm_, 3);
+      return Core::IO::read_binary_mesh(mesh_file_, input_files_, {dis}, max_node_id, *comm_);
+    }
+
+    Teuchos::RCP<Epetra_Comm> comm_;
+    std::filesystem::path directory_;
+    std::vector<std::filesystem::path> input_files_;
+    std::filesystem::path mesh_file_;
+  };
+
+  TEST_F(BinaryMeshTest, WriteThenReadRoundTrip)
+  {
+    Teuchos::RCP<Core::FE::Discretization> dis = create_discretization();
+    Core::IO::write_binary_mesh(mesh_file_, input_files_, {dis}, 63, *comm_);
+
+    Teuchos::RCP<Core::FE::Discretization> read_dis;
+    int max_node_id = 0;
+    ASSERT_TRUE(read(read_dis, max_node_id));
+    read_dis->fill_complete(true, false, false);
+
+    EXPECT_EQ(max_node_id, 63);
+    ASSERT_EQ(read_dis->num_my_row_nodes(), dis->num_my_row_nodes());
+    ASSERT_EQ(read_dis->num_my_row_elements(), dis->num_my_row_elements());
+    EXPECT_TRUE(read_dis->node_row_map()->SameAs(*dis->node_row_map()));
+    EXPECT_TRUE(read_dis->element_row_map()->SameAs(*dis->element_row_map()));
+
+    for (const auto* node : dis->my_row_node_range())
+      EXPECT_EQ(pack(*read_dis->g_node(node->id())), pack(*node));
+
+    for (const auto* element : dis->my_row_element_range())
+      EXPECT_EQ(pack(*read_dis->g_element(element->id())), pack(*element));
+  }
+
+  TEST_F(BinaryMeshTest, MissingFileIsNotRead)
+  {
+    Teuchos::RCP<Core::FE::Discretization> read_dis;
+    int max_node_id = 0;
+    EXPECT_FALSE(read(read_dis, max_node_id));
+  }
+
+  TEST_F(BinaryMeshTest, ChangedIncludedFileInvalidatesMesh)
+  {
+    Core::IO::write_binary_mesh(mesh_file_, input_files_, {create_discretization()}, 63, *comm_);
+
+    // only the modification time of the included file changes
+    const auto modification_time = std::filesystem::last_write_time(input_files_[1]);
+    if (comm_->MyPID() == 0)
+      std::filesystem::last_write_time(input_files_[1], modification_time + std::chrono::hours(1));
+    comm_->Barrier();
+
+    Teuchos::RCP<Core::FE::Discretization> read_dis;
+    int max_node_id = 0;
+    EXPECT_FALSE(read(read_dis, max_node_id));
+  }
+
+  TEST_F(BinaryMeshTest, AdditionalIncludedFileInvalidatesMesh)
+  {
+    Core::IO::write_binary_mesh(mesh_file_, input_files_, {create_discretization()}, 63, *comm_);
+
+    if (comm_->MyPID() == 0) write_file(directory_ / "include2.dat", "--DESIGN DESCRIPTION\n");
+    comm_->Barrier();
+    input_files_.emplace_back(directory_ / "include2.dat");
+
+    Teuchos::RCP<Core::FE::Discretization> read_dis;
+    int max_node_id = 0;
+    EXPECT_FALSE(read(read_dis, max_node_id));
+  }
+}  // namespace
@@ -0,0 +1,143 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_discretization.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io.hpp"
+#include "4C_io_control.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_vector.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <Epetra_MpiComm.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  class CollectiveResultFileTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = Teuchos::make_rcp<Epetra_MpiComm>(MPI_COMM_WORLD);
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      directory_ = std::filesystem::temp_directory_path() / "4C_io_collective_result_file_test";
+      if (comm_->MyPID() == 0)
+      {
+        std::filesystem::remove_all(directory_);
+        std::filesystem::create_directories(directory_);
+      }
+      comm_->Barrier();
+      prefix_ = (directory_ / "result").string();
+
+      Core::IO::GridGenerator::RectangularCuboidInputs inputs{};
+      inputs.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputs.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputs.interval_ = std::array<int, 3>{3, 3, 3};
+      inputs.node_gid_of_first_new_node_ = 0;
+      inputs.elementtype_ = "SOLID";
+      inputs.distype_ = "HEX8";
+      inputs.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      dis_ = Teuchos::make_rcp<Core::FE::Discretization>("structure", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(*dis_, inputs, true);
+      dis_->fill_complete(true, false, false);
+    }
+
+    void TearDown() override
+    {
+      comm_->Barrier();
+      if (comm_->MyPID() == 0) std::filesystem::remove_all(directory_);
+      Core::IO::cout.close();
+    }
+
+    std::string control_file_content() const
+    {
+      std::ifstream file(prefix_ + ".control");
+      std::stringstream content;
+      content << file.rdbuf();
+      return content.str();
+    }
+
+    Teuchos::RCP<Epetra_Comm> comm_;
+    std::filesystem::path directory_;
+    std::string prefix_;
+    Teuchos::RCP<Core::FE::Discretization> dis_;
+  };
+
+  TEST_F(CollectiveResultFileTest, WriteAndReadBack)
+  {
+#ifndef H5_HAVE_PARALLEL
+    GTEST_SKIP() << "Collective binary output requires HDF5 with MPI support.";
+#endif
+
+    const Epetra_Map& dofrowmap = *dis_->dof_row_map();
+    auto vector = Teuchos::make_rcp<Core::LinAlg::Vector<double>>(dofrowmap);
+    for (int lid = 0; lid < dofrowmap.NumMyElements(); ++lid)
+      (*vector)[lid] = 0.5 * dofrowmap.GID(lid);
+
+    std::vector<double> doubles = {1.0, 2.5, -3.0};
+    std::vector<int> ints = {4, 5, 6, 7};
+
+    {
+      auto output = Teuchos::make_rcp<Core::IO::OutputControl>(*comm_, "Structure",
+          Core::FE::ShapeFunctionType::polynomial, "dummy.dat", prefix_, 3, 0, 1000, true);
+      output->set_write_collective_binary_output(true);
+      Core::IO::DiscretizationWriter writer(dis_, output, Core::FE::ShapeFunctionType::polynomial);
+
+      writer.write_mesh(1, 0.1);
+      writer.new_step(1, 0.1);
+      writer.write_vector("displacement", vector);
+      writer.write_redundant_double_vector("doubles", doubles);
+      writer.write_redundant_int_vector("ints", ints);
+    }
+    comm_->Barrier();
+
+    if (comm_->MyPID() == 0)
+      EXPECT_NE(control_file_content().find("collective_output = 1"), std::string::npos);
+
+    auto input = Teuchos::make_rcp<Core::IO::InputControl>(prefix_, *comm_);
+    Core::IO::DiscretizationReader reader(dis_, input, 1);
+
+    auto read_vector = Teuchos::make_rcp<Core::LinAlg::Vector<double>>(dofrowmap, true);
+    reader.read_vector(read_vector, "displacement");
+    for (int lid = 0; lid < dofrowmap.NumMyElements(); ++lid)
+      EXPECT_EQ((*read_vector)[lid], (*vector)[lid]);
+
+    // the redundant vectors are only written by the first processor but read on all of them
+    auto read_doubles = Teuchos::make_rcp<std::vector<double>>();
+    reader.read_redundant_double_vector(read_doubles, "doubles");
+    EXPECT_EQ(*read_doubles, doubles);
+
+    auto read_ints = Teuchos::make_rcp<std::vector<int>>();
+    reader.read_redundant_int_vector(read_ints, "ints");
+    EXPECT_EQ(*read_ints, ints);
+  }
+}  // namespace
@@ -0,0 +1,144 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_comm_pack_buffer.hpp"
+#include "4C_fem_discretization.hpp"
+#include "4C_fem_general_element.hpp"
+#include "4C_fem_general_node.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io.hpp"
+#include "4C_io_control.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <Epetra_SerialComm.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.1);
+    mat_stvenant.add("DENS", 2.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  template <typename Object>
+  std::vector<char> pack(const Object& object)
+  {
+    Core::Communication::PackBuffer buffer;
+    object.pack(buffer);
+    return buffer();
+  }
+
+  class DiscretizationRestartTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = Teuchos::make_rcp<Epetra_SerialComm>();
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      directory_ = std::filesystem::temp_directory_path() / "4C_io_discretization_restart_test";
+      std::filesystem::remove_all(directory_);
+      std::filesystem::create_directories(directory_);
+      prefix_ = (directory_ / "restart").string();
+    }
+
+    void TearDown() override
+    {
+      Core::IO::cout.close();
+      std::filesystem::remove_all(directory_);
+    }
+
+    Teuchos::RCP<Core::FE::Discretization> create_discretization() const
+    {
+      Core::IO::GridGenerator::RectangularCuboidInputs inputs{};
+      inputs.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputs.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputs.interval_ = std::array<int, 3>{3, 3, 3};
+      inputs.node_gid_of_first_new_node_ = 0;
+      inputs.elementtype_ = "SOLID";
+      inputs.distype_ = "HEX8";
+      inputs.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      auto dis = Teuchos::make_rcp<Core::FE::Discretization>("structure", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(*dis, inputs, true);
+      dis->fill_complete(true, false, false);
+      return dis;
+    }
+
+    std::string control_file_content() const
+    {
+      std::ifstream file(prefix_ + ".control");
+      std::stringstream content;
+      content << file.rdbuf();
+      return content.str();
+    }
+
+    Teuchos::RCP<Epetra_Comm> comm_;
+    std::filesystem::path directory_;
+    std::string prefix_;
+  };
+
+  TEST_F(DiscretizationRestartTest, IncrementalMeshGroupRoundTrip)
+  {
+    Teuchos::RCP<Core::FE::Discretization> dis = create_discretization();
+    const int changed_node = dis->node_row_map()->GID(0);
+    std::vector<double> changed_position = dis->g_node(changed_node)->x();
+    for (int dim = 0; dim < 3; ++dim) changed_position[dim] += 0.01 * (dim + 1);
+
+    {
+      auto output = Teuchos::make_rcp<Core::IO::OutputControl>(*comm_, "Structure",
+          Core::FE::ShapeFunctionType::polynomial, "dummy.dat", prefix_, 3, 0, 1000, true);
+      Core::IO::DiscretizationWriter writer(dis, output, Core::FE::ShapeFunctionType::polynomial);
+
+      writer.write_mesh(1, 0.1);
+      writer.new_step(1, 0.1);
+
+      // only a single node changes, so the second mesh group only contains this node
+      dis->g_node(changed_node)->set_pos(changed_position);
+
+      writer.write_mesh(2, 0.2);
+      writer.new_step(2, 0.2);
+    }
+
+    EXPECT_NE(control_file_content().find("mesh_base_step = 1"), std::string::npos);
+
+    // restart into a discretization that still holds the initial mesh
+    Teuchos::RCP<Core::FE::Discretization> restarted_dis = create_discretization();
+    auto input = Teuchos::make_rcp<Core::IO::InputControl>(prefix_, true);
+    Core::IO::DiscretizationReader reader(restarted_dis, input, 2);
+    reader.read_history_data(2);
+
+    ASSERT_EQ(restarted_dis->num_my_row_nodes(), dis->num_my_row_nodes());
+    ASSERT_EQ(restarted_dis->num_my_row_elements(), dis->num_my_row_elements());
+
+    EXPECT_EQ(restarted_dis->g_node(changed_node)->x(), changed_position);
+
+    for (const auto* node : dis->my_row_node_range())
+      EXPECT_EQ(pack(*restarted_dis->g_node(node->id())), pack(*node));
+
+    for (const auto* element : dis->my_row_element_range())
+      EXPECT_EQ(pack(*restarted_dis->g_element(element->id())), pack(*element));
+  }
+}  // namespace
@@ -0,0 +1,130 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_config.hpp"
+
+#ifdef FOUR_C_WITH_ARBORX
+
+#include "4C_mortar_bounding_volume_search.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_mortar_element.hpp"
+#include "4C_mortar_node.hpp"
+
+#include <Epetra_SerialComm.h>
+
+#include <algorithm>
+
+namespace
+{
+  using namespace FourC;
+
+  class BoundingVolumeSearchTest : public ::testing::Test
+  {
+   public:
+    static void SetUpTestSuite() { Kokkos::initialize(); }
+
+    static void TearDownTestSuite() { Kokkos::finalize(); }
+
+   protected:
+    BoundingVolumeSearchTest()
+    {
+      comm_ = Teuchos::make_rcp<Epetra_SerialComm>();
+      discret_ = Teuchos::make_rcp<Core::FE::Discretization>("mortar", comm_, 3);
+
+      // slave element on [0,1]^2, master element 1 slightly above it, master element 2 far away
+      add_quad(0, 0, 0.0, 0.0, true);
+      add_quad(1, 4, 0.0, 0.01, false);
+      add_quad(2, 8, 5.0, 0.01, false);
+
+      discret_->fill_complete(false, false, false);
+      dynamic_cast<Mortar::Element*>(discret_->g_element(0))->initialize_data_container();
+
+      const std::vector<int> slaveelements = {0};
+      const std::vector<int> masterelements = {1, 2};
+      search_ = std::make_unique<Mortar::BoundingVolumeSearch>(*discret_,
+          Teuchos::make_rcp<Epetra_Map>(-1, 1, slaveelements.data(), 0, *comm_),
+          Teuchos::make_rcp<Epetra_Map>(-1, 2, masterelements.data(), 0, *comm_), 3, 0.3, false);
+    }
+
+    //! add a unit square element in the plane z = @p z starting at x = @p x
+    void add_quad(int eleid, int firstnodeid, double x, double z, bool isslave)
+    {
+      const std::vector<std::vector<double>> coords = {
+          {x, 0.0, z}, {x + 1.0, 0.0, z}, {x + 1.0, 1.0, z}, {x, 1.0, z}};
+
+      std::vector<int> nodeids;
+      for (int i = 0; i < 4; ++i)
+      {
+        const int nodeid = firstnodeid + i;
+        const std::vector<int> dofs = {3 * nodeid, 3 * nodeid + 1, 3 * nodeid + 2};
+        discret_->add_node(Teuchos::make_rcp<Mortar::Node>(nodeid, coords[i], 0, dofs, isslave));
+        nodeids.push_back(nodeid);
+      }
+
+      discret_->add_element(Teuchos::make_rcp<Mortar::Element>(
+          eleid, 0, Core::FE::CellType::quad4, 4, nodeids.data(), isslave));
+    }
+
+    //! move all nodes of element @p eleid in x-direction
+    void move_element_in_x(int eleid, double disp)
+    {
+      Core::Elements::Element* element = discret_->g_element(eleid);
+      for (int i = 0; i < element->num_node(); ++i)
+        dynamic_cast<Mortar::Node*>(element->nodes()[i])->xspatial()[0] += disp;
+    }
+
+    //! sorted master element candidates of the slave element
+    std::vector<int> search_elements() const
+    {
+      std::vector<int> searchelements =
+          dynamic_cast<Mortar::Element*>(discret_->g_element(0))->mo_data().search_elements();
+      std::sort(searchelements.begin(), searchelements.end());
+      return searchelements;
+    }
+
+    Teuchos::RCP<Epetra_Comm> comm_;
+    Teuchos::RCP<Core::FE::Discretization> discret_;
+    std::unique_ptr<Mortar::BoundingVolumeSearch> search_;
+  };
+
+  TEST_F(BoundingVolumeSearchTest, FindsOverlappingMasterElements)
+  {
+    search_->evaluate_search();
+
+    EXPECT_EQ(search_elements(), std::vector<int>({1}));
+    EXPECT_EQ(search_->number_of_collision_searches(), 1);
+  }
+
+  TEST_F(BoundingVolumeSearchTest, ReusesCandidatesForSmallMotion)
+  {
+    search_->evaluate_search();
+
+    // the refitted bounding volumes stay inside the ones of the first collision search
+    move_element_in_x(0, 0.1);
+    search_->evaluate_search();
+
+    EXPECT_EQ(search_elements(), std::vector<int>({1}));
+    EXPECT_EQ(search_->number_of_collision_searches(), 1);
+  }
+
+  TEST_F(BoundingVolumeSearchTest, SearchesAgainForLargeMotion)
+  {
+    search_->evaluate_search();
+
+    // the far master element moves onto the slave element
+    move_element_in_x(2, -5.0);
+    search_->evaluate_search();
+
+    EXPECT_EQ(search_elements(), std::vector<int>({1, 2}));
+    EXPECT_EQ(search_->number_of_collision_searches(), 2);
+  }
+}  // namespace
+
+#endif
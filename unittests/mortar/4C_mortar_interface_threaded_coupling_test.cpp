@@ -0,0 +1,151 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_mortar_interface.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_inpar_contact.hpp"
+#include "4C_inpar_mortar.hpp"
+#include "4C_mortar_element.hpp"
+#include "4C_mortar_node.hpp"
+
+#include <Epetra_SerialComm.h>
+
+#include <map>
+
+namespace
+{
+  using namespace FourC;
+
+  //! mortar matrix entries of the slave nodes, i.e., the rows of D and M
+  struct MortarMatrixRows
+  {
+    std::map<int, std::map<int, double>> d;
+    std::map<int, std::map<int, double>> m;
+  };
+
+  class MortarInterfaceThreadedCouplingTest : public ::testing::Test
+  {
+   protected:
+    MortarInterfaceThreadedCouplingTest() : comm_(Teuchos::make_rcp<Epetra_SerialComm>()) {}
+
+    //! couple a 4x4 slave grid with a non-matching 3x3 master grid on the unit square
+    MortarMatrixRows evaluate_coupling(int numthreads) const
+    {
+      Teuchos::ParameterList validparameters;
+      Inpar::Mortar::set_valid_parameters(validparameters);
+      Inpar::CONTACT::set_valid_parameters(validparameters);
+
+      Teuchos::ParameterList input;
+      input.setParameters(validparameters.sublist("MORTAR COUPLING"));
+      input.setParameters(validparameters.sublist("CONTACT DYNAMIC"));
+      input.set<bool>("NURBS", false);
+      input.set<std::string>("LM_SHAPEFCN", "dual");
+      input.set<Inpar::Mortar::ConsistentDualType>(
+          "LM_DUAL_CONSISTENT", Inpar::Mortar::ConsistentDualType::consistent_none);
+      input.sublist("PARALLEL REDISTRIBUTION")
+          .set<Inpar::Mortar::ParallelRedist>(
+              "PARALLEL_REDIST", Inpar::Mortar::ParallelRedist::redist_none);
+      input.set<int>("DIMENSION", 3);
+      input.set<int>("NUM_THREADS", numthreads);
+
+      Teuchos::RCP<Mortar::Interface> interface = Mortar::Interface::create(
+          0, *comm_, 3, input, Teuchos::null, Core::FE::ShapeFunctionType::polynomial);
+
+      add_grid(*interface, 4, 0, 0, true);
+      add_grid(*interface, 3, 100, 100, false);
+
+      const Teuchos::ParameterList binningparams;
+      interface->fill_complete(
+          {}, binningparams, Teuchos::null, Core::FE::ShapeFunctionType::polynomial, true);
+      interface->create_search_tree();
+
+      interface->initialize();
+      interface->evaluate();
+
+      MortarMatrixRows rows;
+      const Epetra_Map& slavenodes = *interface->slave_row_nodes();
+      for (int i = 0; i < slavenodes.NumMyElements(); ++i)
+      {
+        const int gid = slavenodes.GID(i);
+        auto* node = dynamic_cast<Mortar::Node*>(interface->discret().g_node(gid));
+
+        for (const auto& [column, value] : node->mo_data().get_d()) rows.d[gid][column] = value;
+        rows.m[gid] = node->mo_data().get_m();
+      }
+
+      return rows;
+    }
+
+    /*!
+     * \brief add an n x n grid of quad4 elements on the unit square in the plane z = 0
+     *
+     * The slave elements are oriented with normals in positive, the master elements with normals
+     * in negative z-direction.
+     */
+    static void add_grid(
+        Mortar::Interface& interface, int n, int firstnodeid, int firsteleid, bool isslave)
+    {
+      auto node_id = [&](int i, int j) { return firstnodeid + j * (n + 1) + i; };
+
+      for (int j = 0; j <= n; ++j)
+      {
+        for (int i = 0; i <= n; ++i)
+        {
+          const int nodeid = node_id(i, j);
+          const std::vector<double> coords = {1.0 * i / n, 1.0 * j / n, 0.0};
+          const std::vector<int> dofs = {3 * nodeid, 3 * nodeid + 1, 3 * nodeid + 2};
+          interface.add_mortar_node(
+              Teuchos::make_rcp<Mortar::Node>(nodeid, coords, 0, dofs, isslave));
+        }
+      }
+
+      for (int j = 0; j < n; ++j)
+      {
+        for (int i = 0; i < n; ++i)
+        {
+          std::vector<int> nodeids = {
+              node_id(i, j), node_id(i + 1, j), node_id(i + 1, j + 1), node_id(i, j + 1)};
+          if (not isslave) std::swap(nodeids[1], nodeids[3]);
+
+          interface.add_mortar_element(Teuchos::make_rcp<Mortar::Element>(firsteleid + j * n + i,
+              0, Core::FE::CellType::quad4, 4, nodeids.data(), isslave));
+        }
+      }
+    }
+
+    static void expect_near_rows(const std::map<int, std::map<int, double>>& rows,
+        const std::map<int, std::map<int, double>>& referencerows)
+    {
+      ASSERT_EQ(rows.size(), referencerows.size());
+      for (const auto& [row, referenceentries] : referencerows)
+      {
+        const std::map<int, double>& entries = rows.at(row);
+        ASSERT_EQ(entries.size(), referenceentries.size());
+        for (const auto& [column, referencevalue] : referenceentries)
+          EXPECT_NEAR(entries.at(column), referencevalue, 1.0e-14);
+      }
+    }
+
+    Teuchos::RCP<Epetra_Comm> comm_;
+  };
+
+  TEST_F(MortarInterfaceThreadedCouplingTest, ThreadedCouplingMatchesSerialCoupling)
+  {
+    const MortarMatrixRows serial = evaluate_coupling(1);
+    const MortarMatrixRows threaded = evaluate_coupling(4);
+
+    // every slave node is coupled
+    EXPECT_EQ(serial.d.size(), 25);
+    EXPECT_EQ(serial.m.size(), 25);
+
+    expect_near_rows(threaded.d, serial.d);
+    expect_near_rows(threaded.m, serial.m);
+  }
+}  // namespace
@@ -245,6 +245,33 @@ namespace
     }
   }
 
+  TEST_F(ParticleContainerTest, ReorderParticles)
+  {
+    int globalid(0);
+
+    PARTICLEENGINE::ParticleStates particle;
+    particle.assign(statesvectorsize_, std::vector<double>{});
+
+    container_->reorder_particles({2, 0, 1});
+    EXPECT_EQ(container_->particles_stored(), 3);
+
+    const std::vector<int> globalid_reference = {3, 1, 2};
+    const std::vector<PARTICLEENGINE::ParticleStates> particle_reference = {
+        create_test_particle({61.0, -2.63, 0.11}, {-7.35, -5.98, 1.11}, {0.5}),
+        create_test_particle({1.20, 0.70, 2.10}, {0.23, 1.76, 3.89}, {0.12}),
+        create_test_particle({-1.05, 12.6, -8.54}, {0.25, -21.5, 1.0}, {12.34})};
+
+    for (int index = 0; index < 3; ++index)
+    {
+      SCOPED_TRACE("Particle " + std::to_string(index));
+      PARTICLEENGINE::ParticleStates reference = particle_reference[index];
+
+      container_->get_particle(index, globalid, particle);
+      EXPECT_EQ(globalid_reference[index], globalid);
+      compare_particle_states(reference, particle);
+    }
+  }
+
   TEST_F(ParticleContainerTest, GetStateDim)
   {
     EXPECT_EQ(container_->get_state_dim(PARTICLEENGINE::Position), 3);
@@ -0,0 +1,179 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FOUR_C_PARTICLE_INTERACTION_ENGINE_STUB_TEST_HPP
+#define FOUR_C_PARTICLE_INTERACTION_ENGINE_STUB_TEST_HPP
+
+#include "4C_particle_engine_container.hpp"
+#include "4C_particle_engine_interface.hpp"
+#include "4C_utils_exceptions.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  /*!
+   * \brief particle engine providing particle containers and potential particle neighbors only
+   */
+  class ParticleEngineStub : public PARTICLEENGINE::ParticleEngineInterface
+  {
+   public:
+    ParticleEngineStub() : particlecontainerbundle_(new PARTICLEENGINE::ParticleContainerBundle())
+    {
+      particlecontainerbundle_->init();
+    }
+
+    void free_unique_global_ids(std::vector<int>& freeuniquegids) override { not_implemented(); }
+
+    void get_unique_global_ids_for_all_particles(
+        std::vector<PARTICLEENGINE::ParticleObjShrdPtr>& particlestogetuniquegids) override
+    {
+      not_implemented();
+    }
+
+    void refresh_particles_of_specific_states_and_types(
+        const PARTICLEENGINE::StatesOfTypesToRefresh& particlestatestotypes) const override
+    {
+      not_implemented();
+    }
+
+    void start_refresh_particles_of_specific_states_and_types(
+        const PARTICLEENGINE::StatesOfTypesToRefresh& particlestatestotypes) const override
+    {
+      not_implemented();
+    }
+
+    void finish_refresh_particles() const override { not_implemented(); }
+
+    void hand_over_particles_to_be_removed(
+        std::vector<std::set<int>>& particlestoremove) override
+    {
+      not_implemented();
+    }
+
+    void hand_over_particles_to_be_inserted(
+        std::vector<std::vector<std::pair<int, PARTICLEENGINE::ParticleObjShrdPtr>>>&
+            particlestoinsert) override
+    {
+      not_implemented();
+    }
+
+    PARTICLEENGINE::ParticleContainerBundleShrdPtr get_particle_container_bundle() const override
+    {
+      return particlecontainerbundle_;
+    }
+
+    const PARTICLEENGINE::PotentialParticleNeighbors& get_potential_particle_neighbors()
+        const override
+    {
+      return potentialparticleneighbors_;
+    }
+
+    int get_potential_particle_neighbors_build_count() const override
+    {
+      return potentialneighborsbuildcount_;
+    }
+
+    const std::vector<std::vector<int>>& get_communicated_particle_targets() const override
+    {
+      not_implemented();
+      return communicatedparticletargets_;
+    }
+
+    PARTICLEENGINE::LocalIndexTupleShrdPtr get_local_index_in_specific_container(
+        int globalid) const override
+    {
+      not_implemented();
+      return nullptr;
+    }
+
+    std::shared_ptr<Core::IO::DiscretizationWriter> get_bin_discretization_writer() const override
+    {
+      not_implemented();
+      return nullptr;
+    }
+
+    void relate_all_particles_to_all_procs(std::vector<int>& particlestoproc) const override
+    {
+      not_implemented();
+    }
+
+    void get_particles_within_radius(const double* position, const double radius,
+        std::vector<PARTICLEENGINE::LocalIndexTuple>& neighboringparticles) const override
+    {
+      not_implemented();
+    }
+
+    std::array<double, 3> bin_size() const override
+    {
+      not_implemented();
+      return {};
+    }
+
+    double min_bin_size() const override
+    {
+      not_implemented();
+      return 0.0;
+    }
+
+    bool have_periodic_boundary_conditions() const override { return false; }
+
+    bool have_periodic_boundary_conditions_in_spatial_direction(const int dim) const override
+    {
+      return false;
+    }
+
+    double length_of_binning_domain_in_a_spatial_direction(const int dim) const override
+    {
+      not_implemented();
+      return 0.0;
+    }
+
+    Core::LinAlg::Matrix<3, 2> const& domain_bounding_box_corner_positions() const override
+    {
+      not_implemented();
+      return boundingbox_;
+    }
+
+    void distance_between_particles(
+        const double* pos_i, const double* pos_j, double* r_ji) const override
+    {
+      for (int dim = 0; dim < 3; ++dim) r_ji[dim] = pos_j[dim] - pos_i[dim];
+    }
+
+    int get_number_of_particles() const override
+    {
+      not_implemented();
+      return 0;
+    }
+
+    int get_number_of_particles_of_specific_type(
+        const PARTICLEENGINE::ParticleType type) const override
+    {
+      not_implemented();
+      return 0;
+    }
+
+    //! particle container bundle
+    std::shared_ptr<PARTICLEENGINE::ParticleContainerBundle> particlecontainerbundle_;
+
+    //! potential particle neighbors
+    PARTICLEENGINE::PotentialParticleNeighbors potentialparticleneighbors_;
+
+    //! build count of potential particle neighbors
+    int potentialneighborsbuildcount_ = 0;
+
+   private:
+    static void not_implemented() { FOUR_C_THROW("not implemented in particle engine stub"); }
+
+    std::vector<std::vector<int>> communicatedparticletargets_;
+
+    Core::LinAlg::Matrix<3, 2> boundingbox_;
+  };
+}  // namespace
+
+#endif
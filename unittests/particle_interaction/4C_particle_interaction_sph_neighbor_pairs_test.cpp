@@ -0,0 +1,264 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_interaction_sph_neighbor_pairs.hpp"
+
+#include "4C_inpar_particle.hpp"
+#include "4C_particle_interaction_engine_stub_test.hpp"
+#include "4C_particle_interaction_sph_kernel.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_StandardParameterEntryValidators.hpp>
+
+#include <map>
+#include <set>
+
+namespace
+{
+  using namespace FourC;
+
+  using ParticlePairTuples =
+      std::multiset<std::pair<PARTICLEENGINE::LocalIndexTuple, PARTICLEENGINE::LocalIndexTuple>>;
+
+  class SPHNeighborPairsTest : public ::testing::Test
+  {
+   protected:
+    std::shared_ptr<ParticleEngineStub> particleengine_;
+
+    std::shared_ptr<ParticleInteraction::SPHKernelCubicSpline> kernel_;
+
+    //! neighbor pair handler evaluating on a single thread
+    std::unique_ptr<ParticleInteraction::SPHNeighborPairs> serialneighborpairs_;
+
+    //! neighbor pair handler evaluating on several threads
+    std::unique_ptr<ParticleInteraction::SPHNeighborPairs> threadedneighborpairs_;
+
+    SPHNeighborPairsTest()
+    {
+      particleengine_ = std::make_shared<ParticleEngineStub>();
+
+      std::map<PARTICLEENGINE::TypeEnum, std::set<PARTICLEENGINE::StateEnum>>
+          particlestatestotypes;
+      for (const auto& type : {PARTICLEENGINE::Phase1, PARTICLEENGINE::Phase2})
+        particlestatestotypes[type] = {PARTICLEENGINE::Position, PARTICLEENGINE::Radius};
+      particleengine_->particlecontainerbundle_->setup(particlestatestotypes);
+
+      // particles of both types on a regular grid, each one interacting with its direct and
+      // diagonal neighbors
+      int globalid = 0;
+      for (int i = 0; i < 5; ++i)
+      {
+        for (int j = 0; j < 5; ++j)
+        {
+          const auto type = ((i + j) % 3 == 0) ? PARTICLEENGINE::Phase2 : PARTICLEENGINE::Phase1;
+          add_particle(type, globalid++, {1.0 * i, 1.0 * j, 0.0});
+        }
+      }
+
+      build_potential_particle_neighbors();
+
+      Teuchos::ParameterList params_sph;
+      Teuchos::setStringToIntegralParameter<Inpar::PARTICLE::KernelSpaceDimension>(
+          "KERNEL_SPACE_DIM", "Kernel2D", "kernel space dimension number",
+          Teuchos::tuple<std::string>("Kernel2D"),
+          Teuchos::tuple<Inpar::PARTICLE::KernelSpaceDimension>(Inpar::PARTICLE::Kernel2D),
+          &params_sph);
+      params_sph.set<double>("VERLET_LIST_SKIN", 0.5);
+
+      kernel_ = std::make_shared<ParticleInteraction::SPHKernelCubicSpline>(params_sph);
+      kernel_->init();
+      kernel_->setup();
+
+      params_sph.set<int>("NUM_THREADS", 1);
+      serialneighborpairs_ = create_neighbor_pairs(params_sph);
+
+      params_sph.set<int>("NUM_THREADS", 4);
+      threadedneighborpairs_ = create_neighbor_pairs(params_sph);
+    }
+
+    std::unique_ptr<ParticleInteraction::SPHNeighborPairs> create_neighbor_pairs(
+        const Teuchos::ParameterList& params_sph)
+    {
+      auto neighborpairs = std::make_unique<ParticleInteraction::SPHNeighborPairs>(params_sph);
+      neighborpairs->init();
+      neighborpairs->setup(particleengine_, nullptr, kernel_);
+      return neighborpairs;
+    }
+
+    void add_particle(PARTICLEENGINE::TypeEnum type, int globalid, std::vector<double> pos)
+    {
+      PARTICLEENGINE::ParticleStates particle(PARTICLEENGINE::Radius + 1);
+      particle[PARTICLEENGINE::Position] = pos;
+      particle[PARTICLEENGINE::Radius] = {1.5};
+
+      int index(0);
+      particleengine_->particlecontainerbundle_
+          ->get_specific_container(type, PARTICLEENGINE::Owned)
+          ->add_particle(index, globalid, particle);
+    }
+
+    //! all particles are potential neighbors of each other
+    void build_potential_particle_neighbors()
+    {
+      std::vector<PARTICLEENGINE::LocalIndexTuple> particles;
+      for (const auto& type : {PARTICLEENGINE::Phase1, PARTICLEENGINE::Phase2})
+      {
+        const int particlestored = particleengine_->particlecontainerbundle_
+                                       ->get_specific_container(type, PARTICLEENGINE::Owned)
+                                       ->particles_stored();
+        for (int i = 0; i < particlestored; ++i)
+          particles.emplace_back(type, PARTICLEENGINE::Owned, i);
+      }
+
+      particleengine_->potentialparticleneighbors_.clear();
+      for (std::size_t i = 0; i < particles.size(); ++i)
+        for (std::size_t j = i + 1; j < particles.size(); ++j)
+          particleengine_->potentialparticleneighbors_.emplace_back(particles[i], particles[j]);
+
+      particleengine_->potentialneighborsbuildcount_++;
+    }
+
+    void move_particle(PARTICLEENGINE::TypeEnum type, int index, std::vector<double> disp)
+    {
+      double* pos = particleengine_->particlecontainerbundle_
+                        ->get_specific_container(type, PARTICLEENGINE::Owned)
+                        ->get_ptr_to_state(PARTICLEENGINE::Position, index);
+      for (int dim = 0; dim < 3; ++dim) pos[dim] += disp[dim];
+    }
+
+    void evaluate_neighbor_pairs()
+    {
+      serialneighborpairs_->evaluate_neighbor_pairs();
+      threadedneighborpairs_->evaluate_neighbor_pairs();
+    }
+
+    //! apply the function of the given neighbor pair handler and collect the visited pairs
+    template <typename ForEach>
+    static ParticlePairTuples visited_particle_pairs(
+        const ParticleInteraction::SPHNeighborPairs& neighborpairs, ForEach for_each)
+    {
+      const ParticleInteraction::SPHParticlePairData& particlepairdata =
+          neighborpairs.get_ref_to_particle_pair_data();
+
+      // every particle pair is visited by one thread only
+      std::vector<int> numvisits(particlepairdata.size(), 0);
+      for_each([&](const ParticleInteraction::SPHParticlePair& particlepair)
+          { ++numvisits[&particlepair - particlepairdata.data()]; });
+
+      ParticlePairTuples tuples;
+      for (std::size_t k = 0; k < particlepairdata.size(); ++k)
+      {
+        EXPECT_LE(numvisits[k], 1);
+        for (int visit = 0; visit < numvisits[k]; ++visit)
+          tuples.emplace(particlepairdata[k].tuple_i_, particlepairdata[k].tuple_j_);
+      }
+
+      return tuples;
+    }
+
+    //! expect the same particle pairs visited by the serial and the threaded handler
+    void expect_equal_visited_particle_pairs()
+    {
+      auto all = [](const auto& neighborpairs)
+      {
+        return visited_particle_pairs(neighborpairs,
+            [&](auto function) { neighborpairs.for_each_particle_pair(function); });
+      };
+
+      auto disjoint = [](const auto& neighborpairs)
+      {
+        return visited_particle_pairs(neighborpairs,
+            [&](auto function)
+            {
+              neighborpairs.for_each_particle_pair_of_disjoint_combination(
+                  {PARTICLEENGINE::Phase1}, {PARTICLEENGINE::Phase2}, function);
+            });
+      };
+
+      auto equal = [](const auto& neighborpairs)
+      {
+        return visited_particle_pairs(neighborpairs,
+            [&](auto function)
+            {
+              neighborpairs.for_each_particle_pair_of_equal_combination(
+                  {PARTICLEENGINE::Phase1}, function);
+            });
+      };
+
+      const ParticlePairTuples allpairs = all(*serialneighborpairs_);
+      EXPECT_EQ(allpairs.size(), serialneighborpairs_->get_ref_to_particle_pair_data().size());
+      EXPECT_EQ(all(*threadedneighborpairs_), allpairs);
+
+      const ParticlePairTuples disjointpairs = disjoint(*serialneighborpairs_);
+      EXPECT_GT(disjointpairs.size(), 0);
+      EXPECT_EQ(disjoint(*threadedneighborpairs_), disjointpairs);
+
+      const ParticlePairTuples equalpairs = equal(*serialneighborpairs_);
+      EXPECT_GT(equalpairs.size(), 0);
+      EXPECT_EQ(equal(*threadedneighborpairs_), equalpairs);
+
+      // the particle pairs are the relevant ones
+      std::vector<int> relindices;
+      serialneighborpairs_->get_relevant_particle_pair_indices_for_disjoint_combination(
+          {PARTICLEENGINE::Phase1}, {PARTICLEENGINE::Phase2}, relindices);
+      EXPECT_EQ(disjointpairs.size(), relindices.size());
+    }
+  };
+
+  TEST_F(SPHNeighborPairsTest, NumberOfThreads)
+  {
+    EXPECT_EQ(serialneighborpairs_->num_threads(), 1);
+#ifdef FOUR_C_WITH_OPENMP
+    EXPECT_EQ(threadedneighborpairs_->num_threads(), 4);
+#else
+    EXPECT_EQ(threadedneighborpairs_->num_threads(), 1);
+#endif
+  }
+
+  TEST_F(SPHNeighborPairsTest, ThreadedEvaluationVisitsSameParticlePairs)
+  {
+    evaluate_neighbor_pairs();
+    expect_equal_visited_particle_pairs();
+  }
+
+  TEST_F(SPHNeighborPairsTest, ParticlePairsWithinSkinKeepColoring)
+  {
+    evaluate_neighbor_pairs();
+    const std::size_t numpairs = serialneighborpairs_->get_ref_to_particle_pair_data().size();
+
+    // a particle pair leaves its interaction distance without rebuild of the verlet list
+    move_particle(PARTICLEENGINE::Phase1, 0, {-0.2, 0.0, 0.0});
+    evaluate_neighbor_pairs();
+    EXPECT_LT(serialneighborpairs_->get_ref_to_particle_pair_data().size(), numpairs);
+    expect_equal_visited_particle_pairs();
+  }
+
+  TEST_F(SPHNeighborPairsTest, RebuildOfPotentialParticleNeighborsRecolors)
+  {
+    evaluate_neighbor_pairs();
+    const std::size_t numpairs = serialneighborpairs_->get_ref_to_particle_pair_data().size();
+
+    // an additional particle interacting with existing ones
+    add_particle(PARTICLEENGINE::Phase2, 25, {2.5, 2.5, 0.0});
+    build_potential_particle_neighbors();
+
+    evaluate_neighbor_pairs();
+    EXPECT_GT(serialneighborpairs_->get_ref_to_particle_pair_data().size(), numpairs);
+    expect_equal_visited_particle_pairs();
+  }
+
+  TEST_F(SPHNeighborPairsTest, ExceptionOfThreadedFunctionIsRethrown)
+  {
+    evaluate_neighbor_pairs();
+
+    EXPECT_ANY_THROW(threadedneighborpairs_->for_each_particle_pair(
+        [](const ParticleInteraction::SPHParticlePair&)
+        { FOUR_C_THROW("failed evaluation of particle pair"); }));
+  }
+}  // namespace
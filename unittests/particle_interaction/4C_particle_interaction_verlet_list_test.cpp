@@ -0,0 +1,140 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_particle_interaction_verlet_list.hpp"
+
+#include "4C_particle_interaction_engine_stub_test.hpp"
+
+namespace
+{
+  using namespace FourC;
+
+  class VerletListTest : public ::testing::Test
+  {
+   protected:
+    std::shared_ptr<ParticleEngineStub> particleengine_;
+
+    std::unique_ptr<ParticleInteraction::VerletList> verletlist_;
+
+    PARTICLEENGINE::ParticleContainer* container_;
+
+    VerletListTest()
+    {
+      particleengine_ = std::make_shared<ParticleEngineStub>();
+
+      std::map<PARTICLEENGINE::TypeEnum, std::set<PARTICLEENGINE::StateEnum>>
+          particlestatestotypes;
+      particlestatestotypes[PARTICLEENGINE::Phase1] = {
+          PARTICLEENGINE::Position, PARTICLEENGINE::Radius};
+      particleengine_->particlecontainerbundle_->setup(particlestatestotypes);
+
+      container_ = particleengine_->particlecontainerbundle_->get_specific_container(
+          PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned);
+
+      // three particles on a line: only the first two are within their interaction distance
+      add_particle(0, {0.0, 0.0, 0.0});
+      add_particle(1, {1.0, 0.0, 0.0});
+      add_particle(2, {2.5, 0.0, 0.0});
+
+      // all particles are potential neighbors of each other
+      for (int i = 0; i < 3; ++i)
+        for (int j = i + 1; j < 3; ++j)
+          particleengine_->potentialparticleneighbors_.emplace_back(
+              std::make_tuple(PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned, i),
+              std::make_tuple(PARTICLEENGINE::Phase1, PARTICLEENGINE::Owned, j));
+
+      // interaction distance is the sum of both radii
+      verletlist_ = std::make_unique<ParticleInteraction::VerletList>(
+          0.4, [](double rad_i, double rad_j) { return rad_i + rad_j; });
+      verletlist_->setup(particleengine_);
+    }
+
+    void add_particle(int globalid, std::vector<double> pos)
+    {
+      PARTICLEENGINE::ParticleStates particle(PARTICLEENGINE::Radius + 1);
+      particle[PARTICLEENGINE::Position] = pos;
+      particle[PARTICLEENGINE::Radius] = {0.5};
+
+      int index(0);
+      container_->add_particle(index, globalid, particle);
+    }
+
+    void move_particle_in_x(int index, double disp)
+    {
+      container_->get_ptr_to_state(PARTICLEENGINE::Position, index)[0] += disp;
+    }
+  };
+
+  TEST_F(VerletListTest, BuildKeepsPairsWithinSkin)
+  {
+    const PARTICLEENGINE::PotentialParticleNeighbors& pairs = verletlist_->get_particle_pairs();
+
+    ASSERT_EQ(pairs.size(), 1);
+    EXPECT_EQ(std::get<2>(pairs[0].first), 0);
+    EXPECT_EQ(std::get<2>(pairs[0].second), 1);
+    EXPECT_EQ(verletlist_->number_of_builds(), 1);
+  }
+
+  TEST_F(VerletListTest, ReuseWhileDisplacementWithinSkin)
+  {
+    verletlist_->get_particle_pairs();
+
+    // twice the displacement stays below the skin
+    move_particle_in_x(2, -0.15);
+    EXPECT_EQ(verletlist_->get_particle_pairs().size(), 1);
+    EXPECT_EQ(verletlist_->number_of_builds(), 1);
+  }
+
+  TEST_F(VerletListTest, RebuildOnceDisplacementReachesSkin)
+  {
+    verletlist_->get_particle_pairs();
+
+    // twice the displacement reaches the skin, the second and third particle become neighbors
+    move_particle_in_x(2, -0.25);
+    EXPECT_EQ(verletlist_->get_particle_pairs().size(), 2);
+    EXPECT_EQ(verletlist_->number_of_builds(), 2);
+  }
+
+  TEST_F(VerletListTest, RebuildOnceRadiusIncreaseReachesSkin)
+  {
+    verletlist_->get_particle_pairs();
+
+    container_->get_ptr_to_state(PARTICLEENGINE::Radius, 1)[0] += 0.1;
+    verletlist_->get_particle_pairs();
+    EXPECT_EQ(verletlist_->number_of_builds(), 1);
+
+    container_->get_ptr_to_state(PARTICLEENGINE::Radius, 1)[0] += 0.15;
+    verletlist_->get_particle_pairs();
+    EXPECT_EQ(verletlist_->number_of_builds(), 2);
+  }
+
+  TEST_F(VerletListTest, RebuildWithPotentialParticleNeighbors)
+  {
+    verletlist_->get_particle_pairs();
+
+    particleengine_->potentialneighborsbuildcount_++;
+    verletlist_->get_particle_pairs();
+    EXPECT_EQ(verletlist_->number_of_builds(), 2);
+  }
+
+  TEST_F(VerletListTest, RebuildWithChangedNumberOfParticles)
+  {
+    verletlist_->get_particle_pairs();
+
+    add_particle(3, {10.0, 0.0, 0.0});
+    EXPECT_EQ(verletlist_->get_particle_pairs().size(), 1);
+    EXPECT_EQ(verletlist_->number_of_builds(), 2);
+  }
+
+  TEST(VerletList, NonPositiveSkinThrows)
+  {
+    EXPECT_ANY_THROW(ParticleInteraction::VerletList(
+        0.0, [](double rad_i, double rad_j) { return rad_i + rad_j; }));
+  }
+}  // namespace
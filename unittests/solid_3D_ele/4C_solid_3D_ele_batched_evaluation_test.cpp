@@ -0,0 +1,123 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_discretization.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_utils_sparse_algebra_create.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <Epetra_SerialComm.h>
+
+#include <cmath>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.3);
+    mat_stvenant.add("DENS", 1.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  class BatchedEvaluationTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = Teuchos::make_rcp<Epetra_SerialComm>();
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      Core::IO::GridGenerator::RectangularCuboidInputs inputs{};
+      inputs.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputs.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      // more elements than fit into a single batch
+      inputs.interval_ = std::array<int, 3>{3, 2, 2};
+      inputs.node_gid_of_first_new_node_ = 0;
+      inputs.elementtype_ = "SOLID";
+      inputs.distype_ = "HEX8";
+      inputs.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      discret_ = Teuchos::make_rcp<Core::FE::Discretization>("structure", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(*discret_, inputs, true);
+      discret_->fill_complete(true, true, true);
+
+      // evaluate in a deformed configuration
+      auto displacement = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
+      for (int i = 0; i < displacement->MyLength(); ++i)
+        (*displacement)[i] = 0.05 * std::sin(1.0 + 0.7 * i);
+      discret_->set_state("residual displacement",
+          Core::LinAlg::create_vector(*discret_->dof_row_map(), true));
+      discret_->set_state("displacement", displacement);
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    std::pair<Teuchos::RCP<Core::LinAlg::SparseMatrix>,
+        Teuchos::RCP<Core::LinAlg::Vector<double>>>
+    evaluate(bool batched)
+    {
+      Teuchos::ParameterList params;
+      params.set("action", "calc_struct_nlnstiff");
+      params.set("total time", 1.0);
+      params.set("delta time", 1.0);
+      params.set("batched element evaluation", batched);
+
+      auto stiffness = Teuchos::make_rcp<Core::LinAlg::SparseMatrix>(*discret_->dof_row_map(), 81);
+      auto force = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
+      discret_->evaluate(params, stiffness, Teuchos::null, force, Teuchos::null, Teuchos::null);
+      stiffness->complete();
+
+      // the batched path has to be taken if requested
+      EXPECT_EQ(params.get<bool>("solid elements assembled in batches"), batched);
+
+      return {stiffness, force};
+    }
+
+    Teuchos::RCP<Epetra_Comm> comm_;
+    Teuchos::RCP<Core::FE::Discretization> discret_;
+  };
+
+  TEST_F(BatchedEvaluationTest, MatchesElementLoop)
+  {
+    const auto [stiffness, force] = evaluate(false);
+    const auto [batched_stiffness, batched_force] = evaluate(true);
+
+    const Epetra_Map& dofrowmap = *discret_->dof_row_map();
+    for (int rlid = 0; rlid < dofrowmap.NumMyElements(); ++rlid)
+    {
+      EXPECT_NEAR((*batched_force)[rlid], (*force)[rlid], 1e-12);
+
+      int length, batched_length;
+      double *values, *batched_values;
+      int *indices, *batched_indices;
+      stiffness->epetra_matrix()->ExtractMyRowView(rlid, length, values, indices);
+      batched_stiffness->epetra_matrix()->ExtractMyRowView(
+          rlid, batched_length, batched_values, batched_indices);
+
+      ASSERT_EQ(length, batched_length);
+      for (int i = 0; i < length; ++i)
+      {
+        EXPECT_EQ(indices[i], batched_indices[i]);
+        EXPECT_NEAR(values[i], batched_values[i], 1e-12);
+      }
+    }
+  }
+}  // namespace
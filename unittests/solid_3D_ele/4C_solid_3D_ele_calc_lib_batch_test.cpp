@@ -0,0 +1,139 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_solid_3D_ele_calc_lib_batch.hpp"
+
+#include "4C_fem_general_utils_local_connectivity_matrices.hpp"
+#include "4C_solid_3D_ele_calc_lib.hpp"
+#include "4C_solid_3D_ele_calc_lib_integration.hpp"
+#include "4C_unittest_utils_assertions_test.hpp"
+
+#include <cmath>
+
+namespace
+{
+  using namespace FourC;
+
+  Core::LinAlg::Matrix<6, 6> st_venant_kirchhoff_tangent(const double young, const double nu)
+  {
+    const double lambda = young * nu / ((1.0 + nu) * (1.0 - 2.0 * nu));
+    const double mu = young / (2.0 * (1.0 + nu));
+
+    Core::LinAlg::Matrix<6, 6> cmat(true);
+    for (int i = 0; i < 3; ++i)
+    {
+      for (int j = 0; j < 3; ++j) cmat(i, j) = lambda;
+      cmat(i, i) += 2.0 * mu;
+      cmat(i + 3, i + 3) = mu;
+    }
+    return cmat;
+  }
+
+  // distorted and deformed element, different for every lane
+  template <Core::FE::CellType celltype>
+  Discret::Elements::ElementNodes<celltype> create_element_nodes(const int lane)
+  {
+    Discret::Elements::ElementNodes<celltype> element_nodes;
+    const auto xi_nodes = Core::FE::get_element_nodes_in_parameter_space<celltype>();
+    for (int i = 0; i < Core::FE::num_nodes<celltype>; ++i)
+    {
+      for (int d = 0; d < 3; ++d)
+      {
+        const double seed = 1.0 + i * 3 + d + 7 * lane;
+        element_nodes.reference_coordinates(i, d) =
+            (1.0 + 0.1 * lane) * xi_nodes[i][d] + 0.05 * std::sin(seed);
+        element_nodes.displacements(i, d) = 0.02 * std::cos(1.3 * seed);
+        element_nodes.current_coordinates(i, d) =
+            element_nodes.reference_coordinates(i, d) + element_nodes.displacements(i, d);
+      }
+    }
+    return element_nodes;
+  }
+
+  template <Core::FE::CellType celltype>
+  void evaluate_scalar_reference(const Discret::Elements::ElementNodes<celltype>& element_nodes,
+      const Core::FE::GaussIntegration& integration, const Core::LinAlg::Matrix<6, 6>& cmat,
+      Core::LinAlg::Matrix<Discret::Elements::Internal::num_dof_per_ele<celltype>, 1>& force,
+      Core::LinAlg::Matrix<Discret::Elements::Internal::num_dof_per_ele<celltype>,
+          Discret::Elements::Internal::num_dof_per_ele<celltype>>& stiffness)
+  {
+    Discret::Elements::for_each_gauss_point(element_nodes, integration,
+        [&](const Core::LinAlg::Matrix<3, 1>& xi,
+            const Discret::Elements::ShapeFunctionsAndDerivatives<celltype>& shape_functions,
+            const Discret::Elements::JacobianMapping<celltype>& jacobian_mapping,
+            double integration_factor, int gp)
+        {
+          const Discret::Elements::SpatialMaterialMapping<celltype> spatial_material_mapping =
+              Discret::Elements::evaluate_spatial_material_mapping(jacobian_mapping, element_nodes);
+
+          const Core::LinAlg::Matrix<6, 1> gl_strain =
+              Discret::Elements::evaluate_green_lagrange_strain(
+                  Discret::Elements::evaluate_cauchy_green(spatial_material_mapping));
+
+          const auto bop =
+              Discret::Elements::evaluate_strain_gradient(jacobian_mapping, spatial_material_mapping);
+
+          Discret::Elements::Stress<celltype> stress;
+          stress.cmat_ = cmat;
+          stress.pk2_.multiply(cmat, gl_strain);
+
+          Discret::Elements::add_internal_force_vector(bop, stress, integration_factor, force);
+          Discret::Elements::add_elastic_stiffness_matrix(
+              bop, stress, integration_factor, stiffness);
+          Discret::Elements::add_geometric_stiffness_matrix(
+              jacobian_mapping.N_XYZ_, stress, integration_factor, stiffness);
+        });
+  }
+
+  template <Core::FE::CellType celltype>
+  void compare_batch_with_scalar_evaluation()
+  {
+    constexpr int num_dof = Discret::Elements::Internal::num_dof_per_ele<celltype>;
+    const Core::FE::GaussIntegration integration =
+        Discret::Elements::create_gauss_integration<celltype>(
+            Discret::Elements::get_gauss_rule_stiffness_matrix<celltype>());
+    const Core::LinAlg::Matrix<6, 6> cmat = st_venant_kirchhoff_tangent(100.0, 0.3);
+
+    Discret::Elements::ElementNodesBatch<celltype> batch_nodes;
+    for (int lane = 0; lane < Discret::Elements::solid_batch_size; ++lane)
+    {
+      Discret::Elements::pack_element_nodes_to_batch(
+          create_element_nodes<celltype>(lane), lane, batch_nodes);
+    }
+
+    Discret::Elements::ForceStiffnessBatch<celltype> batch_result;
+    Discret::Elements::evaluate_nonlinear_force_stiffness_batch(
+        batch_nodes, integration, cmat, batch_result);
+
+    for (int lane = 0; lane < Discret::Elements::solid_batch_size; ++lane)
+    {
+      Core::LinAlg::Matrix<num_dof, 1> force_ref(true);
+      Core::LinAlg::Matrix<num_dof, num_dof> stiffness_ref(true);
+      evaluate_scalar_reference<celltype>(
+          create_element_nodes<celltype>(lane), integration, cmat, force_ref, stiffness_ref);
+
+      Core::LinAlg::Matrix<num_dof, 1> force;
+      Core::LinAlg::Matrix<num_dof, num_dof> stiffness;
+      Discret::Elements::extract_force_stiffness_from_batch(batch_result, lane, force, stiffness);
+
+      FOUR_C_EXPECT_NEAR(force, force_ref, 1e-12);
+      FOUR_C_EXPECT_NEAR(stiffness, stiffness_ref, 1e-10);
+    }
+  }
+
+  TEST(EvaluateNonlinearForceStiffnessBatch, Hex8)
+  {
+    compare_batch_with_scalar_evaluation<Core::FE::CellType::hex8>();
+  }
+
+  TEST(EvaluateNonlinearForceStiffnessBatch, Tet10)
+  {
+    compare_batch_with_scalar_evaluation<Core::FE::CellType::tet10>();
+  }
+}  // namespace
@@ -0,0 +1,159 @@
+// This file is part of 4C multiphysics licensed under the
+// GNU Lesser General Public License v3.0 or later.
+//
+// See the LICENSE.md file in the top-level for license information.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "4C_fem_discretization_matrix_free_operator.hpp"
+
+#include "4C_fem_discretization.hpp"
+#include "4C_global_data.hpp"
+#include "4C_io_gridgenerator.hpp"
+#include "4C_io_pstream.hpp"
+#include "4C_linalg_sparsematrix.hpp"
+#include "4C_linalg_utils_sparse_algebra_create.hpp"
+#include "4C_mat_material_factory.hpp"
+#include "4C_mat_par_bundle.hpp"
+#include "4C_material_parameter_base.hpp"
+
+#include <Epetra_SerialComm.h>
+
+#include <cmath>
+
+namespace
+{
+  using namespace FourC;
+
+  void create_material_in_global_problem()
+  {
+    Core::IO::InputParameterContainer mat_stvenant;
+    mat_stvenant.add("YOUNG", 1.0);
+    mat_stvenant.add("NUE", 0.3);
+    mat_stvenant.add("DENS", 1.0);
+
+    Global::Problem::instance()->materials()->insert(
+        1, Mat::make_parameter(1, Core::Materials::MaterialType::m_stvenant, mat_stvenant));
+  }
+
+  //! deterministic, non-trivial vector entries
+  void fill(Core::LinAlg::Vector<double>& vector, double scale)
+  {
+    for (int i = 0; i < vector.MyLength(); ++i) vector[i] = scale * std::sin(1.0 + 0.7 * i);
+  }
+
+  class MatrixFreeOperatorTest : public ::testing::Test
+  {
+   protected:
+    void SetUp() override
+    {
+      create_material_in_global_problem();
+      comm_ = Teuchos::make_rcp<Epetra_SerialComm>();
+      Core::IO::cout.setup(false, false, false, Core::IO::standard, comm_, 0, 0, "dummyFilePrefix");
+
+      Core::IO::GridGenerator::RectangularCuboidInputs inputs{};
+      inputs.bottom_corner_point_ = std::array<double, 3>{0.0, 0.0, 0.0};
+      inputs.top_corner_point_ = std::array<double, 3>{1.0, 1.0, 1.0};
+      inputs.interval_ = std::array<int, 3>{2, 2, 2};
+      inputs.node_gid_of_first_new_node_ = 0;
+      inputs.elementtype_ = "SOLID";
+      inputs.distype_ = "HEX8";
+      inputs.elearguments_ = "MAT 1 KINEM nonlinear";
+
+      discret_ = Teuchos::make_rcp<Core::FE::Discretization>("structure", comm_, 3);
+      Core::IO::GridGenerator::create_rectangular_cuboid_discretization(*discret_, inputs, true);
+      discret_->fill_complete(true, true, true);
+
+      // evaluate the tangent in a deformed configuration
+      auto displacement = Core::LinAlg::create_vector(*discret_->dof_row_map(), true);
+      fill(*displacement, 0.05);
+      discret_->set_state("residual displacement",
+          Core::LinAlg::create_vector(*discret_->dof_row_map(), true));
+      discret_->set_state("displacement", displacement);
+
+      params_.set("action", "calc_struct_nlnstiff");
+      params_.set("total time", 1.0);
+      params_.set("delta time", 1.0);
+    }
+
+    void TearDown() override { Core::IO::cout.close(); }
+
+    //! assembled stiffness matrix with the same element evaluation as the matrix-free operator
+    Teuchos::RCP<Core::LinAlg::SparseMatrix> assemble_stiffness(
+        Teuchos::RCP<const Epetra_Map> dbcmap)
+    {
+      auto stiffness = Teuchos::make_rcp<Core::LinAlg::SparseMatrix>(*discret_->dof_row_map(), 81);
+      Teuchos::ParameterList params(params_);
+      discret_->evaluate(params, stiffness, Teuchos::null);
+      stiffness->complete();
+      if (!dbcmap.is_null()) stiffness->apply_dirichlet(*dbcmap, true);
+      return stiffness;
+    }
+
+    void expect_same_action(Teuchos::RCP<const Epetra_Map> dbcmap)
+    {
+      Teuchos::RCP<Core::LinAlg::SparseMatrix> stiffness = assemble_stiffness(dbcmap);
+      Core::FE::MatrixFreeOperator matrix_free(discret_, params_, dbcmap);
+
+      Core::LinAlg::Vector<double> x(*discret_->dof_row_map(), true);
+      fill(x, 1.0);
+      Core::LinAlg::Vector<double> y_assembled(*discret_->dof_row_map(), true);
+      Core::LinAlg::Vector<double> y_matrix_free(*discret_->dof_row_map(), true);
+
+      ASSERT_EQ(stiffness->epetra_matrix()->Apply(x, y_assembled), 0);
+      ASSERT_EQ(matrix_free.Apply(x, y_matrix_free), 0);
+
+      Core::LinAlg::Vector<double> diagonal_assembled(*discret_->dof_row_map(), true);
+      Core::LinAlg::Vector<double> diagonal_matrix_free(*discret_->dof_row_map(), true);
+      ASSERT_EQ(stiffness->epetra_matrix()->ExtractDiagonalCopy(diagonal_assembled), 0);
+      matrix_free.extract_diagonal(diagonal_matrix_free);
+
+      for (int i = 0; i < x.MyLength(); ++i)
+      {
+        EXPECT_NEAR(y_matrix_free[i], y_assembled[i], 1e-12);
+        EXPECT_NEAR(diagonal_matrix_free[i], diagonal_assembled[i], 1e-12);
+      }
+    }
+
+    Teuchos::RCP<Epetra_Comm> comm_;
+    Teuchos::RCP<Core::FE::Discretization> discret_;
+    Teuchos::ParameterList params_;
+  };
+
+  TEST_F(MatrixFreeOperatorTest, ApplyMatchesAssembledStiffness)
+  {
+    expect_same_action(Teuchos::null);
+  }
+
+  TEST_F(MatrixFreeOperatorTest, ApplyMatchesAssembledStiffnessWithDirichletRows)
+  {
+    // fix all dofs of the nodes on the bottom face z = 0
+    std::vector<int> dbcdofs;
+    for (const auto* node : discret_->my_row_node_range())
+    {
+      if (std::abs(node->x()[2]) > 1e-12) continue;
+      for (int dof : discret_->dof(node)) dbcdofs.push_back(dof);
+    }
+    ASSERT_FALSE(dbcdofs.empty());
+
+    expect_same_action(Teuchos::make_rcp<Epetra_Map>(
+        -1, static_cast<int>(dbcdofs.size()), dbcdofs.data(), 0, *comm_));
+  }
+
+  TEST_F(MatrixFreeOperatorTest, RepeatedApplyGivesSameResult)
+  {
+    Core::FE::MatrixFreeOperator matrix_free(discret_, params_, Teuchos::null);
+
+    Core::LinAlg::Vector<double> x(*discret_->dof_row_map(), true);
+    fill(x, 1.0);
+    Core::LinAlg::Vector<double> y_first(*discret_->dof_row_map(), true);
+    Core::LinAlg::Vector<double> y_second(*discret_->dof_row_map(), true);
+
+    ASSERT_EQ(matrix_free.Apply(x, y_first), 0);
+    ASSERT_EQ(matrix_free.Apply(x, y_second), 0);
+
+    for (int i = 0; i < x.MyLength(); ++i) EXPECT_EQ(y_second[i], y_first[i]);
+  }
+}  // namespace